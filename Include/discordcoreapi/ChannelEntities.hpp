@@ -174,6 +174,20 @@ namespace discord_core_api {
 		/// @return a co_routine containing a channel.
 		static channel_cache_data getCachedChannel(get_channel_data dataPackage);
 
+		/// @brief Collects a read-only snapshot of a channel from the library's cache, without copying it.
+		/// @param dataPackage a get_channel_data structure.
+		/// @return a cache_snapshot of the channel, which is empty if the channel is not cached.
+		static cache_snapshot<channel_cache_data> getCachedChannelSnapshot(get_channel_data dataPackage);
+
+		/// @brief Reads a channel in the library's cache in place, without copying it.
+		/// @tparam function_type the type of the function to invoke.
+		/// @param dataPackage a get_channel_data structure.
+		/// @param function the function to invoke, which receives a const reference to the channel_cache_data.
+		/// @return `true` if the channel was cached and the function was invoked, `false` otherwise.
+		template<typename function_type> DCA_INLINE static bool withCachedChannel(get_channel_data dataPackage, function_type&& function) {
+			return cache.visit(dataPackage.channelId, std::forward<function_type>(function));
+		}
+
 		/// @brief Modifies a channel's properties.
 		/// @param dataPackage a modify_channel_data structure.
 		/// @return a co_routine containing a channel.
@@ -255,7 +269,7 @@ namespace discord_core_api {
 		static bool doWeCacheChannels();
 
 	  protected:
-		static object_cache<channel_cache_data> cache;
+		static entity_cache<channel_cache_data> cache;
 		static discord_core_internal::https_client* httpsClient;
 		static bool doWeCacheChannelsBool;
 	};
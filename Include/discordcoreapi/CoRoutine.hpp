@@ -470,8 +470,8 @@ namespace discord_core_api {
 		}
 
 		DCA_INLINE void await_suspend(std::coroutine_handle<typename co_routine<return_type, timeOut>::promise_type> coroHandleNew) {
-			new_thread_awaiter_base::threadPool.submitTask(coroHandleNew);
 			coroHandle = coroHandleNew;
+			new_thread_awaiter_base::threadPool.submitTask(coroHandleNew);
 		}
 
 		DCA_INLINE auto await_resume() {
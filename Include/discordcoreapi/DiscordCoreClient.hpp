@@ -190,6 +190,18 @@ namespace discord_core_api {
 		/// @return milliseconds a size, in milliseconds, since the bot has come online.
 		milliseconds getTotalUpTime();
 
+		/// @brief For collecting the global rate-limit and invalid-request counters of the Https client.
+		/// @return rate_limit_metrics a snapshot of the current counters.
+		discord_core_internal::rate_limit_metrics getRateLimitMetrics();
+
+		/// @brief For collecting the request latencies of each of the Https client's priority lanes.
+		/// @return std::array a latency histogram snapshot for each lane, indexed by https_workload_priority.
+		std::array<discord_core_internal::latency_histogram::snapshot, discord_core_internal::httpsLaneCount> getLaneLatencies();
+
+		/// @brief For collecting the resolver cache and tls session resumption counters of every tcp connection.
+		/// @return connection_metrics a snapshot of the current counters.
+		static discord_core_internal::connection_metrics getConnectionMetrics();
+
 		/// @brief For collecting a copy of the current bot's user_data.
 		/// @return bot_user an instance of bot_user.
 		static bot_user getBotUser();
@@ -109,6 +109,10 @@ namespace discord_core_api {
 
 		enum class payload_type : uint8_t { Application_Json = 1, Multipart_Form = 2 };
 
+		/// @brief The priority lane of an https workload, which decides the order it is handed connections in, and what gets shed first as the
+		/// invalid-request budget runs low.
+		enum class https_workload_priority : uint8_t { Background = 0, Normal = 1, Critical = 2 };
+
 		enum class https_workload_type : uint8_t {
 			Unset											= 0,
 			Get_Global_Application_Commands					= 1,
@@ -290,6 +294,7 @@ namespace discord_core_api {
 			friend class https_client;
 
 			unordered_map<jsonifier::string, jsonifier::string> headersToInsert{};
+			https_workload_priority priority{ https_workload_priority::Normal };
 			payload_type payloadType{ payload_type::Application_Json };
 			https_workload_class workloadClass{};
 			jsonifier::string relativePath{};
@@ -923,7 +928,7 @@ namespace discord_core_api {
 		role_cache_data& operator=(const role_data&);
 		role_cache_data(const role_data&);
 
-		operator role_data();
+		operator role_data() const;
 
 		DCA_INLINE bool operator==(const snowflake& other) const {
 			return id == other;
@@ -1175,7 +1180,7 @@ namespace discord_core_api {
 		channel_cache_data(const channel_data& snowFlake);
 
 		/// @brief For converting this into a channel_data instance.
-		operator channel_data();
+		operator channel_data() const;
 
 		DCA_INLINE bool operator==(const snowflake& other) const {
 			return id == other;
@@ -2557,7 +2562,7 @@ namespace discord_core_api {
 
 		guild_cache_data(const guild_data&);
 
-		operator guild_data();
+		operator guild_data() const;
 
 		discord_core_client* getDiscordCoreClient();
 
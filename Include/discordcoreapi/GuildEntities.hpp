@@ -328,6 +328,20 @@ namespace discord_core_api {
 		/// @return A co_routine containing a guild.
 		static guild_cache_data getCachedGuild(get_guild_data dataPackage);
 
+		/// @brief Collects a read-only snapshot of a guild from the library's cache, without copying it.
+		/// @param dataPackage a get_guild_data structure.
+		/// @return a cache_snapshot of the guild, which is empty if the guild is not cached.
+		static cache_snapshot<guild_cache_data> getCachedGuildSnapshot(get_guild_data dataPackage);
+
+		/// @brief Reads a guild in the library's cache in place, without copying it.
+		/// @tparam function_type the type of the function to invoke.
+		/// @param dataPackage a get_guild_data structure.
+		/// @param function the function to invoke, which receives a const reference to the guild_cache_data.
+		/// @return `true` if the guild was cached and the function was invoked, `false` otherwise.
+		template<typename function_type> DCA_INLINE static bool withCachedGuild(get_guild_data dataPackage, function_type&& function) {
+			return cache.visit(dataPackage.guildId, std::forward<function_type>(function));
+		}
+
 		/// @brief Acquires the preview data of a chosen guild.
 		/// @param dataPackage a get_guild_preview_data structure.
 		/// @return A co_routine containing a guild_preview_data.
@@ -495,15 +509,22 @@ namespace discord_core_api {
 			}
 		}
 
+		/// @brief Collects the locked store of cached guilds.
+		/// @details this is only populated while cache_options::snapshotReads is off, otherwise use getEntityCache().
+		/// @return the object_cache of guilds.
 		static object_cache<guild_cache_data>& getCache();
 
+		/// @brief Collects the cache of guilds, whichever store backs it.
+		/// @return the entity_cache of guilds.
+		static entity_cache<guild_cache_data>& getEntityCache();
+
 		static void removeGuild(const guild_cache_data& guild_id);
 
 		static bool doWeCacheGuilds();
 
 	  protected:
 		static discord_core_internal::https_client* httpsClient;
-		static object_cache<guild_cache_data> cache;
+		static entity_cache<guild_cache_data> cache;
 		static bool doWeCacheGuildsBool;
 	};
 	/**@}*/
@@ -115,6 +115,82 @@ namespace discord_core_api {
 	/**@}*/
 
 
+	/**
+	 * \addtogroup utilities
+	 * @{
+	 */
+
+	/// @brief A guild_member cache which lays the members of each guild out in contiguous columns, rather than allocating each member separately.
+	class DiscordCoreAPI_Dll guild_member_store {
+	  public:
+		static constexpr uint64_t shardCount{ 16 };
+		static constexpr uint64_t compactionThreshold{ 4096 };
+
+		/// @brief The members of a single guild, stored one column per field.
+		struct guild_member_columns {
+			unordered_map<snowflake, uint32_t> rowIndices{};///< Maps each user id to its row.
+			jsonifier::vector<guild_member_flags> flags{};///< The flags of each row.
+			jsonifier::vector<uint32_t> roleOffsets{};///< The offset of each row's roles within the role pool.
+			jsonifier::vector<uint32_t> nickOffsets{};///< The offset of each row's nick within the nick pool.
+			jsonifier::vector<uint64_t> permissions{};///< The base permissions of each row.
+			jsonifier::vector<uint32_t> nickLengths{};///< The length of each row's nick.
+			jsonifier::vector<uint32_t> roleCounts{};///< The number of roles held by each row.
+			jsonifier::vector<snowflake> rolePool{};///< The role ids of every row, back to back.
+			jsonifier::vector<icon_hash> avatars{};///< The guild avatar of each row.
+			jsonifier::vector<uint64_t> joinedAt{};///< The join time of each row.
+			jsonifier::vector<snowflake> userIds{};///< The user id of each row.
+			jsonifier::string nickPool{};///< The nicks of every row, back to back.
+			uint64_t staleNickBytes{};///< The number of bytes in the nick pool which no row refers to.
+			uint64_t staleRoles{};///< The number of ids in the role pool which no row refers to.
+		};
+
+		/// @brief Adds a guild_member to the store, replacing any existing entry for the same guild and user.
+		/// @param member the guild_member to be stored.
+		void emplace(const guild_member_cache_data& member);
+
+		/// @brief Collects a copy of a guild_member from the store.
+		/// @param key the guild and user ids of the guild_member.
+		/// @param member the guild_member_cache_data to fill in.
+		/// @return `true` if the guild_member was found, `false` otherwise.
+		bool find(const two_id_key& key, guild_member_cache_data& member);
+
+		/// @brief Check if the store contains a guild_member.
+		/// @param key the guild and user ids of the guild_member.
+		/// @return `true` if the guild_member was found, `false` otherwise.
+		bool contains(const two_id_key& key);
+
+		/// @brief Removes a guild_member from the store.
+		/// @param key the guild and user ids of the guild_member.
+		void erase(const two_id_key& key);
+
+		/// @brief Get the number of guild_members currently in the store.
+		/// @return the number of guild_members in the store.
+		uint64_t count();
+
+		/// @brief Estimates the number of bytes of heap memory held by the store.
+		/// @return the estimated number of bytes.
+		uint64_t getMemoryUsage();
+
+	  protected:
+		/// @brief A single shard of the store, holding the guilds whose ids hash into it.
+		struct alignas(64) store_shard {
+			unordered_map<snowflake, guild_member_columns> guilds{};///< The columns of each guild in this shard.
+			std::shared_mutex storeMutex{};///< Mutex for ensuring thread-safe access to this shard.
+		};
+
+		std::array<store_shard, shardCount> shards{};///< The independently locked shards of the store.
+
+		store_shard& getShard(snowflake guildId);
+
+		static void writeRow(guild_member_columns& columns, uint32_t row, const guild_member_cache_data& member);
+
+		static void eraseRow(guild_member_columns& columns, uint32_t row);
+
+		static void compact(guild_member_columns& columns);
+	};
+
+	/**@}*/
+
 	/**
 	 * \addtogroup main_endpoints
 	 * @{
@@ -189,7 +265,11 @@ namespace discord_core_api {
 				if (guildMember.guildId == 0 || guildMember.user.id == 0) {
 					throw dca_exception{ "Sorry, but there was no id set for that guildmember." };
 				}
-				cache.emplace(static_cast<guild_member_cache_data>(std::forward<guild_member_type>(guildMember)));
+				if (doWeUseColumnarStoreBool) {
+					memberStore.emplace(static_cast<guild_member_cache_data>(std::forward<guild_member_type>(guildMember)));
+				} else {
+					cache.emplace(static_cast<guild_member_cache_data>(std::forward<guild_member_type>(guildMember)));
+				}
 			}
 		}
 
@@ -206,12 +286,24 @@ namespace discord_core_api {
 
 		static bool doWeCacheVoiceStates();
 
+		/// @brief Get the number of guild_members currently in the library's cache.
+		/// @return the number of cached guild_members.
+		static uint64_t getCachedGuildMemberCount();
+
+		/// @brief Estimates the number of bytes of heap memory held by the library's guild_member cache, whichever layout it uses.
+		/// @return the estimated number of bytes.
+		static uint64_t getCacheMemoryUsage();
+
 	  protected:
 		static discord_core_internal::https_client* httpsClient;
 		static object_cache<voice_state_data_light> vsCache;
 		static object_cache<guild_member_cache_data> cache;
+		static guild_member_store memberStore;
 		static bool doWeCacheGuildMembersBool;
+		static bool doWeUseColumnarStoreBool;
 		static bool doWeCacheVoiceStatesBool;
+
+		static bool findGuildMember(const two_id_key& key, guild_member_cache_data& member);
 	};
 	/**@}*/
 };
@@ -413,7 +413,7 @@ namespace discord_core_api {
 	  public:
 		friend class discord_core_client;
 
-		static unordered_map<jsonifier::string, unbounded_message_block<interaction_data>*> selectMenuInteractionBuffersMap;
+		static unordered_map<jsonifier::string, collector_message_block<interaction_data, 32>*> selectMenuInteractionBuffersMap;
 		static discord_core_internal::trigger_event<void, interaction_data> selectMenuInteractionEventsMap;
 
 		/// @brief Constructor.
@@ -438,7 +438,7 @@ namespace discord_core_api {
 		~select_menu_collector();
 
 	  protected:
-		unbounded_message_block<interaction_data> selectMenuIncomingInteractionBuffer{};
+		collector_message_block<interaction_data, 32> selectMenuIncomingInteractionBuffer{};
 		unique_ptr<interaction_data> interactionData{ makeUnique<interaction_data>() };
 		jsonifier::vector<select_menu_response_data> responseVector{};
 		create_interaction_response_data errorMessageData{};
@@ -510,7 +510,7 @@ namespace discord_core_api {
 	  public:
 		friend class discord_core_client;
 
-		static unordered_map<jsonifier::string, unbounded_message_block<interaction_data>*> buttonInteractionBuffersMap;
+		static unordered_map<jsonifier::string, collector_message_block<interaction_data, 32>*> buttonInteractionBuffersMap;
 		static discord_core_internal::trigger_event<void, interaction_data> buttonInteractionEventsMap;
 
 		/// @brief Constructor.
@@ -536,7 +536,7 @@ namespace discord_core_api {
 
 	  protected:
 		unique_ptr<interaction_data> interactionData{ makeUnique<interaction_data>() };
-		unbounded_message_block<interaction_data> buttonIncomingInteractionBuffer{};
+		collector_message_block<interaction_data, 32> buttonIncomingInteractionBuffer{};
 		jsonifier::vector<button_response_data> responseVector{};
 		create_interaction_response_data errorMessageData{};
 		jsonifier::vector<jsonifier::string> values{};
@@ -591,7 +591,7 @@ namespace discord_core_api {
 	  public:
 		friend class discord_core_client;
 
-		static unordered_map<jsonifier::string, unbounded_message_block<interaction_data>*> modalInteractionBuffersMap;
+		static unordered_map<jsonifier::string, collector_message_block<interaction_data, 32>*> modalInteractionBuffersMap;
 		static discord_core_internal::trigger_event<void, interaction_data> modalInteractionEventsMap;
 
 		/// @brief Constructor.
@@ -611,7 +611,7 @@ namespace discord_core_api {
 		~modal_collector();
 
 	  protected:
-		unbounded_message_block<interaction_data> modalIncomingInteractionBuffer{};
+		collector_message_block<interaction_data, 32> modalIncomingInteractionBuffer{};
 		create_interaction_response_data errorMessageData{};
 		uint32_t currentCollectedButtonCount{};
 		modal_response_data responseData{};
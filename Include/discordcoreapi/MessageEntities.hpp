@@ -51,14 +51,23 @@ namespace discord_core_api {
 			jsonifier::vector<value_type> objects{};///< A vector of collected objects.
 		};
 
-		static unordered_map<jsonifier::string, unbounded_message_block<value_type>*> objectsBuffersMap;
+		static unordered_map<jsonifier::string, object_collector*> objectCollectorsMap;
 
 		object_collector();
 
+		/// @brief Hands an object to the collector, if it passes the collector's filter. called from the shard that received the object.
+		/// @param object the object to be collected.
+		DCA_INLINE void deliver(const value_type& object) {
+			if (filteringFunction(object)) {
+				objectsBuffer.send(object);
+			}
+		}
+
 		/// @brief Begin waiting for objects.
 		/// @param quantityToCollect maximum quantity of objects to collect before returning the results.
 		/// @param msToCollectForNew maximum number of milliseconds to wait for objects before returning the results.
-		/// @param filteringFunctionNew a filter function to apply to new objects, where returning "True" from the function results in a object being stored.
+		/// @param filteringFunctionNew a filter function to apply to new objects, where returning "True" from the function results in a object being stored. it runs
+		/// on the shard that received each object, so it should be quick.
 		/// @return A object_collector_return_data structure.
 		co_routine<object_collector_return_data, false> collectObjects(int32_t quantityToCollect, int32_t msToCollectForNew, object_filter<value_type> filteringFunctionNew);
 
@@ -68,7 +77,7 @@ namespace discord_core_api {
 		~object_collector();
 
 	  protected:
-		unbounded_message_block<value_type> objectsBuffer{};
+		collector_message_block<value_type, 128> objectsBuffer{};
 		object_collector_return_data objectReturnData{};
 		object_filter<value_type> filteringFunction{};
 		int32_t quantityOfObjectsToCollect{};
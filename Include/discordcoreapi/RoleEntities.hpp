@@ -195,6 +195,20 @@ namespace discord_core_api {
 		/// @return a co_routine containing a role_data.
 		static role_cache_data getCachedRole(get_role_data dataPackage);
 
+		/// @brief Collects a read-only snapshot of a given role from the library's cache, without copying it.
+		/// @param dataPackage a get_role_data structure.
+		/// @return a cache_snapshot of the role, which is empty if the role is not cached.
+		static cache_snapshot<role_cache_data> getCachedRoleSnapshot(get_role_data dataPackage);
+
+		/// @brief Reads a given role in the library's cache in place, without copying it.
+		/// @tparam function_type the type of the function to invoke.
+		/// @param dataPackage a get_role_data structure.
+		/// @param function the function to invoke, which receives a const reference to the role_cache_data.
+		/// @return `true` if the role was cached and the function was invoked, `false` otherwise.
+		template<typename function_type> DCA_INLINE static bool withCachedRole(get_role_data dataPackage, function_type&& function) {
+			return cache.visit(dataPackage.roleId, std::forward<function_type>(function));
+		}
+
 		template<typename role_type> DCA_INLINE static void insertRole(role_type&& role) {
 			if (doWeCacheRolesBool) {
 				if (role.id == 0) {
@@ -213,7 +227,7 @@ namespace discord_core_api {
 
 	  protected:
 		static discord_core_internal::https_client* httpsClient;
-		static object_cache<role_cache_data> cache;
+		static entity_cache<role_cache_data> cache;
 		static bool doWeCacheRolesBool;
 	};
 	/**@}*/
@@ -33,7 +33,9 @@
 #include <discordcoreapi/Utilities/UnorderedSet.hpp>
 #include <discordcoreapi/Utilities/UnorderedMap.hpp>
 #include <discordcoreapi/Utilities/ObjectCache.hpp>
+#include <discordcoreapi/Utilities/EpochCache.hpp>
 #include <discordcoreapi/Utilities/UnboundedMessageBlock.hpp>
+#include <discordcoreapi/Utilities/BoundedMessageBlock.hpp>
 #include <discordcoreapi/Utilities/Etf.hpp>
 #include <coroutine>
 
@@ -105,6 +107,7 @@ namespace discord_core_api {
 	class guild_member_data;
 	class guild_members;
 	class channel_data;
+	class over_write_data;
 	class reactions;
 	class role_data;
 	class bot_user;
@@ -233,6 +236,22 @@ namespace discord_core_api {
 		bool cacheGuilds{ true };///< Do we cache guilds?
 		bool cacheRoles{ true };///< Do we cache roles?
 		bool cacheUsers{ true };///< Do we cache users?
+		bool snapshotReads{};///< Do we serve guild, channel and role cache reads from lock-free snapshots?
+		bool columnarGuildMembers{};///< Do we store cached guild_members in per-guild columns, rather than as individual objects?
+	};
+
+	/// @brief For selecting how the library's tcp connections hand their coalesced writes to the operating system.
+	enum class tcp_write_policy : uint8_t {
+		os_default = 0x00,///< Leave the socket's defaults, including nagle's algorithm, in place.
+		no_delay   = 0x01,///< Disable nagle's algorithm, so that each flush is sent as soon as it is written.
+		cork	   = 0x02,///< Hold back partial segments until a flush has been fully written (linux only, elsewhere behaves as no_delay).
+	};
+
+	/// @brief Connection options for the library.
+	struct connection_options {
+		milliseconds connectTimeout{ 5000 };///< How long to wait for a tcp connection to be established, before abandoning it.
+		milliseconds handshakeTimeout{ 5000 };///< How long to wait for a tls handshake to complete, before abandoning the connection.
+		tcp_write_policy writePolicy{ tcp_write_policy::os_default };///< How the tcp connections flush their pending writes.
 	};
 
 	/// @brief Configuration data for the library's main class, discord_core_client.
@@ -241,11 +260,13 @@ namespace discord_core_api {
 		jsonifier::vector<repeated_function_data> functionsToExecute{};///< Functions to execute after a timer, or on a repetition.
 		gateway_intents intents{ gateway_intents::All_Intents };///< The gateway intents to be used for this instance.
 		text_format textFormat{ text_format::etf };///< Use etf or json format for websocket transfer?
+		bool useZlibStream{};///< Use zlib-stream compression for the websocket transport?
 		jsonifier::string connectionAddress{};///< A potentially alternative connection address for the websocket.
 		sharding_options shardOptions{};///< Options for the sharding of your bot.
 		jsonifier::string botToken{};///< Your bot's token.
 		logging_options logOptions{};///< Options for the output/logging of the library.
 		cache_options cacheOptions{};///< Options for the cache of the library.
+		connection_options connectionOptions{};///< Options for the tcp connections of the library.
 		uint16_t connectionPort{};///< A potentially alternative connection port for the websocket.
 	};
 
@@ -279,6 +300,10 @@ namespace discord_core_api {
 
 		bool doWeCacheRoles() const;
 
+		bool doWeUseSnapshotReads() const;
+
+		bool doWeUseColumnarGuildMembers() const;
+
 		update_presence_data getPresenceData() const;
 
 		jsonifier::string getBotToken() const;
@@ -301,10 +326,18 @@ namespace discord_core_api {
 
 		void setConnectionPort(const uint16_t connectionPortNew);
 
+		milliseconds getConnectTimeout() const;
+
+		milliseconds getHandshakeTimeout() const;
+
+		tcp_write_policy getWritePolicy() const;
+
 		jsonifier::vector<repeated_function_data> getFunctionsToExecute() const;
 
 		text_format getTextFormat() const;
 
+		bool doWeUseZlibStream() const;
+
 		gateway_intents getGatewayIntents();
 
 	  protected:
@@ -866,6 +899,132 @@ namespace discord_core_api {
 		uint64_t value{};
 	};
 
+	/// @brief A cache of precomputed permission bitsets, kept per guild and updated incrementally from gateway events.
+	class DiscordCoreAPI_Dll permission_engine {
+	  public:
+		static constexpr uint64_t allPermissions{ (1ull << 46) - 1 };
+		static constexpr uint64_t shardCount{ 16 };
+
+		/// @brief Computes the permissions held by a guild_member within a given channel.
+		/// @param guildId the id of the guild.
+		/// @param userId the id of the guild_member.
+		/// @param channelId the id of the channel, or 0 to skip channel overwrites.
+		/// @return the final permission bitset.
+		static uint64_t computePermissions(snowflake guildId, snowflake userId, snowflake channelId);
+
+		/// @brief Computes the permissions held by a guild_member within a given guild, before channel overwrites.
+		/// @param guildId the id of the guild.
+		/// @param userId the id of the guild_member.
+		/// @return the base permission bitset.
+		static uint64_t computeBasePermissions(snowflake guildId, snowflake userId);
+
+		/// @brief Computes the base permissions for an arbitrary set of roles, using the guild's role-permission table.
+		/// @param guildId the id of the guild.
+		/// @param userId the id of the guild_member.
+		/// @param roles the roles to be evaluated.
+		/// @return the base permission bitset.
+		static uint64_t computeBasePermissions(snowflake guildId, snowflake userId, const jsonifier::vector<snowflake>& roles);
+
+		/// @brief Starts tracking a guild afresh, from the state delivered with its GUILD_CREATE, replacing any role and channel tables already held for it.
+		/// @details guild_members which were already tracked keep their roles, and have their base permissions recomputed against the new role table.
+		/// @param guildId the id of the guild.
+		/// @param ownerId the id of the guild's owner.
+		/// @param roles every role in the guild, including @everyone.
+		/// @param channels every channel in the guild.
+		static void seedGuild(snowflake guildId, snowflake ownerId, const jsonifier::vector<role_data>& roles, const jsonifier::vector<channel_data>& channels);
+
+		/// @brief Updates the owner of a tracked guild.
+		/// @param guildId the id of the guild.
+		/// @param ownerId the id of the guild's new owner.
+		static void updateGuildOwner(snowflake guildId, snowflake ownerId);
+
+		/// @brief Stops tracking a guild.
+		/// @param guildId the id of the guild.
+		static void removeGuild(snowflake guildId);
+
+		/// @brief Updates the permissions of a role in a tracked guild, refreshing every member who holds it.
+		/// @param guildId the id of the guild.
+		/// @param roleId the id of the role.
+		/// @param permissions the role's new permission bitset.
+		static void updateRole(snowflake guildId, snowflake roleId, uint64_t permissions);
+
+		/// @brief Removes a role from a tracked guild, refreshing every member who held it.
+		/// @param guildId the id of the guild.
+		/// @param roleId the id of the role.
+		static void removeRole(snowflake guildId, snowflake roleId);
+
+		/// @brief Updates the roles of a guild_member in a tracked guild.
+		/// @param guildId the id of the guild.
+		/// @param userId the id of the guild_member.
+		/// @param roles the guild_member's new roles.
+		static void updateMember(snowflake guildId, snowflake userId, const jsonifier::vector<snowflake>& roles);
+
+		/// @brief Removes a guild_member from a tracked guild.
+		/// @param guildId the id of the guild.
+		/// @param userId the id of the guild_member.
+		static void removeMember(snowflake guildId, snowflake userId);
+
+		/// @brief Updates the permission overwrites of a channel in a tracked guild.
+		/// @param channel the channel_data holding the new overwrites.
+		static void updateChannel(const channel_data& channel);
+
+		/// @brief Removes a channel from a tracked guild.
+		/// @param guildId the id of the guild.
+		/// @param channelId the id of the channel.
+		static void removeChannel(snowflake guildId, snowflake channelId);
+
+	  protected:
+		/// @brief A single permission overwrite, with its bitsets already parsed.
+		struct overwrite_entry {
+			snowflake id{};///< The id of the role or user this overwrite applies to.
+			uint64_t allow{};///< The permissions to allow.
+			uint64_t deny{};///< The permissions to deny.
+		};
+
+		/// @brief The permission overwrites of a single channel.
+		struct channel_entry {
+			jsonifier::vector<overwrite_entry> memberOverwrites{};///< The overwrites for individual guild_members.
+			jsonifier::vector<overwrite_entry> roleOverwrites{};///< The overwrites for roles.
+			uint64_t everyoneAllow{};///< The permissions allowed by the @everyone overwrite.
+			uint64_t everyoneDeny{};///< The permissions denied by the @everyone overwrite.
+		};
+
+		/// @brief A single guild_member, with its base permissions precomputed.
+		struct member_entry {
+			jsonifier::vector<snowflake> roles{};///< The roles held by the guild_member.
+			uint64_t basePermissions{};///< The guild_member's permissions before channel overwrites.
+		};
+
+		/// @brief The permission state of a single guild.
+		struct guild_entry {
+			unordered_map<snowflake, uint64_t> rolePermissions{};///< The permission bitset of each role, including @everyone.
+			unordered_map<snowflake, channel_entry> channels{};///< The overwrites of each channel.
+			unordered_map<snowflake, member_entry> members{};///< The guild_members whose permissions have been computed.
+			snowflake ownerId{};///< The id of the guild's owner.
+			snowflake id{};///< The id of the guild, which is also the id of its @everyone role.
+		};
+
+		/// @brief A single shard of the engine, holding the guilds whose ids hash into it.
+		struct alignas(64) engine_shard {
+			unordered_map<snowflake, guild_entry> guilds{};///< The permission state of each guild in this shard.
+			std::shared_mutex engineMutex{};///< Mutex for ensuring thread-safe access to this shard.
+		};
+
+		static std::array<engine_shard, shardCount> shards;
+
+		static engine_shard& getShard(snowflake guildId);
+
+		static bool tryComputePermissions(snowflake guildId, snowflake userId, snowflake channelId, uint64_t& permissionsNew);
+
+		static uint64_t computeBasePermissions(const guild_entry& guild, snowflake userId, const jsonifier::vector<snowflake>& roles);
+
+		static void refreshMembers(guild_entry& guild, snowflake roleId);
+
+		static void populate(snowflake guildId, snowflake userId, snowflake channelId);
+
+		static channel_entry collectOverwrites(snowflake guildId, const jsonifier::vector<over_write_data>& overwrites);
+	};
+
 	DiscordCoreAPI_Dll jsonifier::string constructMultiPartData(jsonifier::string_view data, const jsonifier::vector<file>& files);
 
 	DiscordCoreAPI_Dll jsonifier::string convertToLowerCase(jsonifier::string_view stringToConvert);
@@ -0,0 +1,393 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// BoundedMessageBlock.hpp - Header file for the "BoundedMessageBlock" stuff.
+/// Oct 17, 2026
+/// https://discordcoreapi.com
+/// \file BoundedMessageBlock.hpp
+#pragma once
+
+#include <discordcoreapi/Utilities/UnboundedMessageBlock.hpp>
+#include <discordcoreapi/Utilities/UniquePtr.hpp>
+
+#if defined(__linux__)
+	#include <linux/futex.h>
+	#include <sys/syscall.h>
+	#include <unistd.h>
+	#include <ctime>
+#elif defined(_WIN32)
+	#if defined(_MSC_VER)
+		#pragma comment(lib, "Synchronization.lib")
+	#endif
+	#include <synchapi.h>
+#endif
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+		/**
+		* \addtogroup discord_core_internal
+		* @{
+		*/
+
+		/// @brief Parks the calling thread until a 32-bit atomic no longer holds an expected value, it is woken, or a timeout passes.
+		/// @details may return spuriously, so callers re-check their condition. where neither futexes nor WaitOnAddress exist, this sleeps briefly instead.
+		/// @param value the atomic to wait on.
+		/// @param expected the value the atomic must still hold for the thread to park.
+		/// @param timeout how long to wait for, or a negative duration to wait indefinitely.
+		DCA_INLINE void waitOnAddress(std::atomic<uint32_t>& value, uint32_t expected, milliseconds timeout) {
+#if defined(__linux__)
+			timespec timeSpec{ static_cast<time_t>(timeout.count() / 1000), static_cast<long>((timeout.count() % 1000) * 1000000) };
+			syscall(SYS_futex, reinterpret_cast<uint32_t*>(&value), FUTEX_WAIT_PRIVATE, expected, timeout.count() < 0 ? nullptr : &timeSpec, nullptr, 0);
+#elif defined(_WIN32)
+			WaitOnAddress(&value, &expected, sizeof(expected), timeout.count() < 0 ? INFINITE : static_cast<DWORD>(timeout.count()));
+#else
+			if (value.load(std::memory_order_acquire) == expected) {
+				std::this_thread::sleep_for(timeout.count() < 0 || timeout > 1ms ? 1ms : timeout);
+			}
+#endif
+		}
+
+		/// @brief Wakes a thread parked in waitOnAddress on a given atomic.
+		/// @param value the atomic to wake a waiter on.
+		DCA_INLINE void wakeAddress([[maybe_unused]] std::atomic<uint32_t>& value) {
+#if defined(__linux__)
+			syscall(SYS_futex, reinterpret_cast<uint32_t*>(&value), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+#elif defined(_WIN32)
+			WakeByAddressSingle(&value);
+#endif
+		}
+
+		/// @brief The receiver-side parking shared by the bounded message blocks.
+		/// @details senders only make a wake syscall when the receiver has announced that it is about to park.
+		class message_block_signal {
+		  public:
+			static constexpr uint64_t spinCount{ 64 };
+
+			/// @brief Wakes the receiver, if it is parked or about to park. called by senders after publishing an object.
+			DCA_INLINE void notify() {
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				if (waiterCount.load(std::memory_order_seq_cst) > 0) {
+					signal.fetch_add(1, std::memory_order_release);
+					wakeAddress(signal);
+				}
+			}
+
+			/// @brief Retries a receive until it succeeds or a timeout passes, spinning briefly before parking between attempts.
+			/// @tparam function_type the type of the receive to retry.
+			/// @param function the receive to retry, returning `true` on success.
+			/// @param timeout how long to wait for, or a negative duration to wait indefinitely.
+			/// @return `true` if the receive succeeded, `false` if the timeout passed first.
+			template<typename function_type> DCA_INLINE bool waitFor(function_type&& function, milliseconds timeout) {
+				for (uint64_t x = 0; x < spinCount; ++x) {
+					if (function()) {
+						return true;
+					}
+				}
+				auto deadline = hrclock::now() + timeout;
+				while (!function()) {
+					auto currentSignal = signal.load(std::memory_order_acquire);
+					waiterCount.fetch_add(1, std::memory_order_seq_cst);
+					std::atomic_thread_fence(std::memory_order_seq_cst);
+					if (function()) {
+						waiterCount.fetch_sub(1, std::memory_order_release);
+						return true;
+					}
+					auto remainingTime = std::chrono::duration_cast<milliseconds>(deadline - hrclock::now());
+					if (timeout.count() >= 0 && remainingTime.count() <= 0) {
+						waiterCount.fetch_sub(1, std::memory_order_release);
+						return false;
+					}
+					waitOnAddress(signal, currentSignal, timeout.count() < 0 ? timeout : remainingTime + 1ms);
+					waiterCount.fetch_sub(1, std::memory_order_release);
+				}
+				return true;
+			}
+
+		  protected:
+			alignas(64) std::atomic<uint32_t> waiterCount{};///< The number of receivers parked, or about to park.
+			std::atomic<uint32_t> signal{};///< Bumped, and waited on, to wake parked receivers.
+		};
+
+		/**@}*/
+	}
+
+	/// @brief A lock-free, fixed-capacity message block for exactly one sending thread and one receiving thread.
+	/// @tparam value_type the type of object that will be sent over the message block.
+	/// @tparam capacity the maximum number of objects held at once, which must be a power of two.
+	template<copyable_or_movable value_type_new, uint64_t capacity> class spsc_message_block {
+	  public:
+		using value_type = value_type_new;
+
+		static_assert(capacity > 0 && (capacity & (capacity - 1)) == 0, "Sorry, but the capacity must be a power of two.");
+
+		DCA_INLINE spsc_message_block() : slots{ makeUnique<value_type[]>(capacity) } {};
+
+		DCA_INLINE spsc_message_block& operator=(const spsc_message_block&) = delete;
+		DCA_INLINE spsc_message_block(const spsc_message_block&)			= delete;
+
+		/// @brief Sends an object, if there is room for it. only call from the sending thread.
+		/// @param object the object to send.
+		/// @return `true` if the object was sent, `false` if the message block was full.
+		template<copyable_or_movable value_type_newer> DCA_INLINE bool send(value_type_newer&& object) {
+			auto currentTail = tail.load(std::memory_order_relaxed);
+			if (currentTail - cachedHead == capacity) {
+				cachedHead = head.load(std::memory_order_acquire);
+				if (currentTail - cachedHead == capacity) {
+					return false;
+				}
+			}
+			slots[currentTail & (capacity - 1)] = std::forward<value_type_newer>(object);
+			tail.store(currentTail + 1, std::memory_order_release);
+			signal.notify();
+			return true;
+		}
+
+		/// @brief Receives an object, if one is waiting. only call from the receiving thread.
+		/// @param object the object to receive into.
+		/// @return `true` if an object was received, `false` otherwise.
+		DCA_INLINE bool tryReceive(value_type& object) {
+			auto currentHead = head.load(std::memory_order_relaxed);
+			if (currentHead == cachedTail) {
+				cachedTail = tail.load(std::memory_order_acquire);
+				if (currentHead == cachedTail) {
+					return false;
+				}
+			}
+			object = std::move(slots[currentHead & (capacity - 1)]);
+			head.store(currentHead + 1, std::memory_order_release);
+			return true;
+		}
+
+		/// @brief Receives an object, parking the receiving thread until one arrives or a timeout passes.
+		/// @param object the object to receive into.
+		/// @param timeout how long to wait for, or a negative duration to wait indefinitely.
+		/// @return `true` if an object was received, `false` if the timeout passed first.
+		DCA_INLINE bool receive(value_type& object, milliseconds timeout = milliseconds{ -1 }) {
+			return signal.waitFor(
+				[&] {
+					return tryReceive(object);
+				},
+				timeout);
+		}
+
+		/// @brief Discards every waiting object. only call from the receiving thread.
+		DCA_INLINE void clearContents() {
+			value_type object{};
+			while (tryReceive(object)) {
+			}
+		}
+
+		DCA_INLINE uint64_t size() {
+			return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+		}
+
+	  protected:
+		alignas(64) std::atomic<uint64_t> head{};///< The next position to receive from, written by the receiver.
+		uint64_t cachedTail{};///< The receiver's last look at tail.
+		alignas(64) std::atomic<uint64_t> tail{};///< The next position to send to, written by the sender.
+		uint64_t cachedHead{};///< The sender's last look at head.
+		alignas(64) discord_core_internal::message_block_signal signal{};
+		unique_ptr<value_type[]> slots{};
+	};
+
+	/// @brief A lock-free, fixed-capacity message block for any number of sending threads and one receiving thread.
+	/// @details each slot carries a sequence number, which tells senders whether it is free and the receiver whether it is filled.
+	/// @tparam value_type the type of object that will be sent over the message block.
+	/// @tparam capacity the maximum number of objects held at once, which must be a power of two.
+	template<copyable_or_movable value_type_new, uint64_t capacity> class mpsc_message_block {
+	  public:
+		using value_type = value_type_new;
+
+		static_assert(capacity > 0 && (capacity & (capacity - 1)) == 0, "Sorry, but the capacity must be a power of two.");
+
+		/// @brief A slot of the message block, and the sequence number guarding it.
+		struct message_slot {
+			std::atomic<uint64_t> sequence{};
+			value_type value{};
+		};
+
+		DCA_INLINE mpsc_message_block() : slots{ makeUnique<message_slot[]>(capacity) } {
+			for (uint64_t x = 0; x < capacity; ++x) {
+				slots[x].sequence.store(x, std::memory_order_relaxed);
+			}
+		};
+
+		DCA_INLINE mpsc_message_block& operator=(const mpsc_message_block&) = delete;
+		DCA_INLINE mpsc_message_block(const mpsc_message_block&)			= delete;
+
+		/// @brief Sends an object, if there is room for it. safe to call from any number of threads.
+		/// @param object the object to send.
+		/// @return `true` if the object was sent, `false` if the message block was full.
+		template<copyable_or_movable value_type_newer> DCA_INLINE bool send(value_type_newer&& object) {
+			auto currentTail = tail.load(std::memory_order_relaxed);
+			message_slot* slot{};
+			while (true) {
+				slot			= &slots[currentTail & (capacity - 1)];
+				auto sequence	= slot->sequence.load(std::memory_order_acquire);
+				auto difference = static_cast<int64_t>(sequence - currentTail);
+				if (difference == 0) {
+					if (tail.compare_exchange_weak(currentTail, currentTail + 1, std::memory_order_relaxed)) {
+						break;
+					}
+				} else if (difference < 0) {
+					return false;
+				} else {
+					currentTail = tail.load(std::memory_order_relaxed);
+				}
+			}
+			slot->value = std::forward<value_type_newer>(object);
+			slot->sequence.store(currentTail + 1, std::memory_order_release);
+			signal.notify();
+			return true;
+		}
+
+		/// @brief Receives an object, if one is waiting. only call from the receiving thread.
+		/// @param object the object to receive into.
+		/// @return `true` if an object was received, `false` otherwise.
+		DCA_INLINE bool tryReceive(value_type& object) {
+			auto& slot = slots[head & (capacity - 1)];
+			if (slot.sequence.load(std::memory_order_acquire) != head + 1) {
+				return false;
+			}
+			object = std::move(slot.value);
+			slot.sequence.store(head + capacity, std::memory_order_release);
+			++head;
+			return true;
+		}
+
+		/// @brief Receives an object, parking the receiving thread until one arrives or a timeout passes.
+		/// @param object the object to receive into.
+		/// @param timeout how long to wait for, or a negative duration to wait indefinitely.
+		/// @return `true` if an object was received, `false` if the timeout passed first.
+		DCA_INLINE bool receive(value_type& object, milliseconds timeout = milliseconds{ -1 }) {
+			return signal.waitFor(
+				[&] {
+					return tryReceive(object);
+				},
+				timeout);
+		}
+
+		/// @brief Check whether no object is waiting, or part-way through being sent. only call from the receiving thread.
+		/// @return `true` if the message block is empty, `false` otherwise.
+		DCA_INLINE bool isEmpty() {
+			return tail.load(std::memory_order_acquire) == head;
+		}
+
+		/// @brief Discards every waiting object. only call from the receiving thread.
+		DCA_INLINE void clearContents() {
+			value_type object{};
+			while (tryReceive(object)) {
+			}
+		}
+
+	  protected:
+		alignas(64) std::atomic<uint64_t> tail{};///< The next position to claim, shared by the senders.
+		alignas(64) uint64_t head{};///< The next position to receive from, owned by the receiver.
+		alignas(64) discord_core_internal::message_block_signal signal{};
+		unique_ptr<message_slot[]> slots{};
+	};
+
+	/// @brief A message block for collectors, which never drops an object: objects go through a lock-free mpsc_message_block until it fills, and through an
+	/// unbounded_message_block from then on.
+	/// @details the switch to the unbounded block is permanent, so that each sender's objects are still received in the order they were sent.
+	/// @tparam value_type the type of object that will be sent over the message block.
+	/// @tparam capacity the number of objects held before falling back to the unbounded block, which must be a power of two.
+	template<copyable_or_movable value_type_new, uint64_t capacity> class collector_message_block {
+	  public:
+		using value_type = value_type_new;
+
+		DCA_INLINE collector_message_block() = default;
+
+		DCA_INLINE collector_message_block& operator=(const collector_message_block&) = delete;
+		DCA_INLINE collector_message_block(const collector_message_block&)			  = delete;
+
+		/// @brief Sends an object. safe to call from any number of threads.
+		/// @param object the object to send.
+		template<copyable_or_movable value_type_newer> DCA_INLINE void send(value_type_newer&& object) {
+			// a failed send leaves the object untouched, so it can still be forwarded to the unbounded block.
+			if (overflowing.load(std::memory_order_acquire) || !boundedBlock.send(std::forward<value_type_newer>(object))) {
+				overflowing.store(true, std::memory_order_release);
+				overflowBlock.send(std::forward<value_type_newer>(object));
+			}
+			signal.notify();
+		}
+
+		/// @brief Receives an object, if one is waiting. only call from the receiving thread.
+		/// @param object the object to receive into.
+		/// @return `true` if an object was received, `false` otherwise.
+		DCA_INLINE bool tryReceive(value_type& object) {
+			// the unbounded block is only read once the bounded one is empty, including of sends still in progress, which may have begun before the overflow.
+			return boundedBlock.tryReceive(object) || (overflowing.load(std::memory_order_acquire) && boundedBlock.isEmpty() && overflowBlock.tryReceive(object));
+		}
+
+		/// @brief Receives an object, parking the receiving thread until one arrives or a timeout passes.
+		/// @param object the object to receive into.
+		/// @param timeout how long to wait for, or a negative duration to wait indefinitely.
+		/// @return `true` if an object was received, `false` if the timeout passed first.
+		DCA_INLINE bool receive(value_type& object, milliseconds timeout = milliseconds{ -1 }) {
+			return signal.waitFor(
+				[&] {
+					return tryReceive(object);
+				},
+				timeout);
+		}
+
+		/// @brief Check whether the bounded block has filled, and objects are going through the unbounded block.
+		/// @return `true` if the message block has overflowed, `false` otherwise.
+		DCA_INLINE bool hasOverflowed() {
+			return overflowing.load(std::memory_order_acquire);
+		}
+
+		/// @brief Discards every waiting object. only call from the receiving thread.
+		DCA_INLINE void clearContents() {
+			boundedBlock.clearContents();
+			overflowBlock.clearContents();
+		}
+
+	  protected:
+		mpsc_message_block<value_type, capacity> boundedBlock{};
+		unbounded_message_block<value_type> overflowBlock{};
+		discord_core_internal::message_block_signal signal{};
+		std::atomic<bool> overflowing{};
+	};
+
+	template<typename value_type, uint64_t capacity> DCA_INLINE bool waitForTimeToPass(spsc_message_block<std::remove_cvref_t<value_type>, capacity>& outBuffer, value_type& argOne,
+		uint64_t timeInMsNew) {
+		return !outBuffer.receive(argOne, milliseconds{ timeInMsNew });
+	}
+
+	template<typename value_type, uint64_t capacity> DCA_INLINE bool waitForTimeToPass(mpsc_message_block<std::remove_cvref_t<value_type>, capacity>& outBuffer, value_type& argOne,
+		uint64_t timeInMsNew) {
+		return !outBuffer.receive(argOne, milliseconds{ timeInMsNew });
+	}
+
+	template<typename value_type, uint64_t capacity> DCA_INLINE bool waitForTimeToPass(collector_message_block<std::remove_cvref_t<value_type>, capacity>& outBuffer,
+		value_type& argOne, uint64_t timeInMsNew) {
+		return !outBuffer.receive(argOne, milliseconds{ timeInMsNew });
+	}
+
+}
@@ -44,106 +44,222 @@ namespace discord_core_api {
 		* @{
 		*/
 
-		/// @brief A struct representing a worker thread for coroutine-based tasks.
-		struct worker_thread {
-			DCA_INLINE worker_thread(){};
+		/// @brief A Chase-Lev work-stealing deque, which its owner pushes to and pops from at the bottom, while other threads steal from the top.
+		/// @tparam value_type the type of value stored in the deque, which must be trivially copyable.
+		template<typename value_type> class work_stealing_deque {
+		  public:
+			static_assert(std::is_trivially_copyable_v<value_type>, "Sorry, but the work_stealing_deque's value_type must be trivially copyable.");
+
+			static constexpr int64_t initialCapacity{ 64 };
+
+			/// @brief A fixed-size circular buffer, which is replaced by a larger copy when full.
+			struct ring_buffer {
+				DCA_INLINE ring_buffer(int64_t capacityNew) : slots{ makeUnique<std::atomic<value_type>[]>(static_cast<uint64_t>(capacityNew)) }, capacity{ capacityNew } {};
+
+				DCA_INLINE value_type load(int64_t index) const {
+					return slots[static_cast<uint64_t>(index & (capacity - 1))].load(std::memory_order_relaxed);
+				}
+
+				DCA_INLINE void store(int64_t index, value_type value) {
+					slots[static_cast<uint64_t>(index & (capacity - 1))].store(value, std::memory_order_relaxed);
+				}
+
+				unique_ptr<std::atomic<value_type>[]> slots{};///< The slots of the buffer.
+				const int64_t capacity{};///< The number of slots, always a power of two.
+			};
 
-			DCA_INLINE worker_thread& operator=(worker_thread&& other) noexcept {
-				areWeCurrentlyWorking.store(other.areWeCurrentlyWorking.load(std::memory_order_acquire), std::memory_order_release);
-				std::swap(thread, other.thread);
-				tasks = std::move(other.tasks);
-				return *this;
+			DCA_INLINE work_stealing_deque() {
+				rings.emplace_back(makeUnique<ring_buffer>(initialCapacity));
+				ring.store(rings.back().get(), std::memory_order_relaxed);
 			}
 
-			DCA_INLINE worker_thread(worker_thread&& other) noexcept {
-				*this = std::move(other);
+			DCA_INLINE work_stealing_deque& operator=(const work_stealing_deque&) = delete;
+			DCA_INLINE work_stealing_deque(const work_stealing_deque&)			  = delete;
+
+			/// @brief Pushes a value onto the bottom of the deque - may only be called by the owning thread.
+			/// @param value the value to push.
+			DCA_INLINE void push(value_type value) {
+				auto bottomNew	 = bottom.load(std::memory_order_relaxed);
+				auto topNew		 = top.load(std::memory_order_acquire);
+				auto currentRing = ring.load(std::memory_order_relaxed);
+				if (bottomNew - topNew > currentRing->capacity - 1) {
+					currentRing = grow(currentRing, topNew, bottomNew);
+				}
+				currentRing->store(bottomNew, value);
+				std::atomic_thread_fence(std::memory_order_release);
+				bottom.store(bottomNew + 1, std::memory_order_relaxed);
+			}
+
+			/// @brief Pops a value from the bottom of the deque - may only be called by the owning thread.
+			/// @param value the value to fill in.
+			/// @return `true` if a value was popped, `false` if the deque was empty.
+			DCA_INLINE bool pop(value_type& value) {
+				auto bottomNew	 = bottom.load(std::memory_order_relaxed) - 1;
+				auto currentRing = ring.load(std::memory_order_relaxed);
+				bottom.store(bottomNew, std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				auto topNew = top.load(std::memory_order_relaxed);
+				if (topNew > bottomNew) {
+					bottom.store(bottomNew + 1, std::memory_order_relaxed);
+					return false;
+				}
+				value = currentRing->load(bottomNew);
+				if (topNew == bottomNew) {
+					bool returnValue{ top.compare_exchange_strong(topNew, topNew + 1, std::memory_order_seq_cst, std::memory_order_relaxed) };
+					bottom.store(bottomNew + 1, std::memory_order_relaxed);
+					return returnValue;
+				}
+				return true;
 			}
 
-			DCA_INLINE ~worker_thread() = default;
+			/// @brief Steals a value from the top of the deque - may be called by any thread.
+			/// @param value the value to fill in.
+			/// @return `true` if a value was stolen, `false` if the deque was empty or another thread won the race.
+			DCA_INLINE bool steal(value_type& value) {
+				auto topNew = top.load(std::memory_order_acquire);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				auto bottomNew = bottom.load(std::memory_order_acquire);
+				if (topNew >= bottomNew) {
+					return false;
+				}
+				value = ring.load(std::memory_order_acquire)->load(topNew);
+				return top.compare_exchange_strong(topNew, topNew + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+			}
+
+			/// @brief Checks whether the deque currently appears to be empty.
+			/// @return `true` if the deque appears to be empty, `false` otherwise.
+			DCA_INLINE bool empty() const {
+				return top.load(std::memory_order_acquire) >= bottom.load(std::memory_order_acquire);
+			}
 
-			unbounded_message_block<std::coroutine_handle<>> tasks{};///< Queue of coroutine tasks.
-			std::atomic_bool areWeCurrentlyWorking{};///< Atomic flag indicating if the thread is working.
+		  protected:
+			alignas(64) std::atomic<int64_t> top{};///< The index thieves steal from.
+			alignas(64) std::atomic<int64_t> bottom{};///< The index the owner pushes to and pops from.
+			std::atomic<ring_buffer*> ring{};///< The buffer currently in use.
+			std::vector<unique_ptr<ring_buffer>> rings{};///< Every buffer ever used, kept alive as thieves may still be reading from an old one.
+
+			DCA_INLINE ring_buffer* grow(ring_buffer* currentRing, int64_t topNew, int64_t bottomNew) {
+				auto newRing = makeUnique<ring_buffer>(currentRing->capacity * 2);
+				for (int64_t x = topNew; x < bottomNew; ++x) {
+					newRing->store(x, currentRing->load(x));
+				}
+				rings.emplace_back(std::move(newRing));
+				ring.store(rings.back().get(), std::memory_order_release);
+				return rings.back().get();
+			}
+		};
+
+		/// @brief A struct representing a worker thread for coroutine-based tasks.
+		struct worker_thread {
+			DCA_INLINE worker_thread(){};
+
+			work_stealing_deque<std::coroutine_handle<>> tasks{};///< Queue of coroutine tasks, which other workers may steal from.
 			std::jthread thread{};///< Joinable thread.
 		};
 
-		/// @brief A class representing a coroutine-based thread pool.
-		class co_routine_thread_pool : protected std::unordered_map<uint64_t, unique_ptr<worker_thread>> {
+		/// @brief A class representing a work-stealing coroutine thread pool.
+		class co_routine_thread_pool {
 		  public:
-			using map_type = std::unordered_map<uint64_t, unique_ptr<worker_thread>>;
+			static constexpr uint64_t spinCount{ 64 };
 
 			/// @brief Constructor to create a coroutine thread pool. initializes the worker threads.
-			DCA_INLINE co_routine_thread_pool() : threadCount(std::thread::hardware_concurrency()) {
-				std::unique_lock lock01{ workerAccessMutex };
-				for (uint32_t x = 0; x < threadCount; ++x) {
-					uint64_t indexNew = x;
-					getMap().emplace(indexNew, makeUnique<worker_thread>());
-					std::this_thread::sleep_for(150ms);
-					getMap().at(indexNew)->thread = std::jthread{ [=, this](std::stop_token tokenNew) mutable {
-						auto indexNewer			  = indexNew;
-						threadFunction(getMap().at(indexNewer).get(), tokenNew);
+			DCA_INLINE co_routine_thread_pool() : threadCount(std::max(std::thread::hardware_concurrency(), 1u)) {
+				for (uint64_t x = 0; x < threadCount; ++x) {
+					workers.emplace_back(makeUnique<worker_thread>());
+				}
+				for (uint64_t x = 0; x < threadCount; ++x) {
+					workers[x]->thread = std::jthread{ [=, this](std::stop_token tokenNew) {
+						threadFunction(x, tokenNew);
 					} };
 				}
 			}
 
 			/// @brief Submit a coroutine task to the thread pool.
+			/// @details tasks submitted from one of the pool's own workers go onto that worker's deque, others go onto the shared injection queue.
 			/// @param coro the coroutine handle to submit.
 			DCA_INLINE void submitTask(std::coroutine_handle<> coro) {
-				uint64_t currentLowestIndex{ std::numeric_limits<uint64_t>::max() };
-				while (currentLowestIndex == std::numeric_limits<uint64_t>::max()) {
-					currentLowestIndex = areWeAllBusy();
-					std::this_thread::sleep_for(1ms);
+				if (currentPool == this) {
+					currentWorker->tasks.push(coro);
+				} else {
+					injectionQueue.send(coro);
 				}
-				std::shared_lock lock01{ workerAccessMutex };
-				if (std ::this_thread::get_id() == getMap()[currentLowestIndex]->thread.get_id()) {
-					++currentLowestIndex;
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				if (sleepingWorkerCount.load(std::memory_order_seq_cst) > 0) {
+					wakeSignal.fetch_add(1, std::memory_order_release);
+					wakeSignal.notify_one();
 				}
-				getMap()[currentLowestIndex]->tasks.send(std::move(coro));
 			}
 
 			~co_routine_thread_pool() {
 				doWeQuit.store(true, std::memory_order_release);
+				wakeSignal.fetch_add(1, std::memory_order_release);
+				wakeSignal.notify_all();
+				for (auto& value: workers) {
+					value->thread.request_stop();
+					if (value->thread.joinable()) {
+						value->thread.join();
+					}
+				}
 			}
 
 		  protected:
-			std::shared_mutex workerAccessMutex{};///< Shared mutex for worker thread access.
+			DCA_INLINE static thread_local co_routine_thread_pool* currentPool{};///< The pool owning the current thread, if any.
+			DCA_INLINE static thread_local worker_thread* currentWorker{};///< The worker running on the current thread, if any.
+			unbounded_message_block<std::coroutine_handle<>> injectionQueue{};///< Tasks submitted from outside of the pool.
+			std::vector<unique_ptr<worker_thread>> workers{};///< The pool's worker threads.
+			std::atomic<uint64_t> sleepingWorkerCount{};///< The number of workers currently parked, or about to park.
+			std::atomic<uint64_t> wakeSignal{};///< Bumped, and waited on, to wake parked workers.
 			std::atomic_bool doWeQuit{ false };///< Whether or not we're quitting.
 			const uint64_t threadCount{};///< Total thread count.
 
 			/// @brief Thread function for each worker thread.
-			/// @param thread A pointer to the current thread of execution.
+			/// @param index the index of the current worker.
 			/// @param tokenNew The stop token for the thread.
-			DCA_INLINE void threadFunction(worker_thread* thread, std::stop_token tokenNew) {
+			DCA_INLINE void threadFunction(uint64_t index, std::stop_token tokenNew) {
+				currentPool	  = this;
+				currentWorker = workers[index].get();
 				while (!doWeQuit.load(std::memory_order_acquire) && !tokenNew.stop_requested()) {
 					std::coroutine_handle<> coroHandle{};
-					if (thread->tasks.tryReceive(coroHandle)) {
-						thread->areWeCurrentlyWorking.store(true, std::memory_order_release);
+					bool foundTask{};
+					for (uint64_t x = 0; x < spinCount && !foundTask; ++x) {
+						foundTask = findTask(index, coroHandle);
+					}
+					if (!foundTask) {
+						auto currentSignal = wakeSignal.load(std::memory_order_acquire);
+						sleepingWorkerCount.fetch_add(1, std::memory_order_seq_cst);
+						std::atomic_thread_fence(std::memory_order_seq_cst);
+						foundTask = findTask(index, coroHandle);
+						if (!foundTask && !doWeQuit.load(std::memory_order_acquire)) {
+							wakeSignal.wait(currentSignal, std::memory_order_acquire);
+						}
+						sleepingWorkerCount.fetch_sub(1, std::memory_order_release);
+					}
+					if (foundTask) {
 						try {
 							coroHandle();
-							while (!coroHandle.done()) {
-								std::this_thread::sleep_for(1ms);
-							}
 						} catch (const std::runtime_error& error) {
 							message_printer::printError<print_message_type::general>(error.what());
 						}
-						thread->areWeCurrentlyWorking.store(false, std::memory_order_release);
 					}
-					std::this_thread::sleep_for(std::chrono::nanoseconds{ 100000 });
 				}
+				currentPool	  = nullptr;
+				currentWorker = nullptr;
 			}
 
-			DCA_INLINE uint64_t areWeAllBusy() {
-				for (uint64_t x = 0; x < this->size(); ++x) {
-					if (this->contains(x)) {
-						if (!this->operator[](x)->areWeCurrentlyWorking.load(std::memory_order_acquire)) {
-							return x;
-						}
+			/// @brief Looks for a task in the worker's own deque, then the injection queue, then the other workers' deques.
+			/// @param index the index of the current worker.
+			/// @param coroHandle the coroutine handle to fill in.
+			/// @return `true` if a task was found, `false` otherwise.
+			DCA_INLINE bool findTask(uint64_t index, std::coroutine_handle<>& coroHandle) {
+				if (workers[index]->tasks.pop(coroHandle) || injectionQueue.tryReceive(coroHandle)) {
+					return true;
+				}
+				for (uint64_t x = 1; x < threadCount; ++x) {
+					if (workers[(index + x) % threadCount]->tasks.steal(coroHandle)) {
+						return true;
 					}
 				}
-				return std::numeric_limits<uint64_t>::max();
-			}
-
-			DCA_INLINE map_type& getMap() {
-				return *this;
+				return false;
 			}
 		};
 
@@ -0,0 +1,708 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// EpochCache.hpp - Header file for the "epoch_cache" stuff.
+/// Oct 17, 2026
+/// https://discordcoreapi.com
+/// \file EpochCache.hpp
+#pragma once
+
+#include <discordcoreapi/Utilities/ObjectCache.hpp>
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+		/// @brief A single reader's slot within the epoch_domain.
+		struct alignas(64) epoch_record {
+			std::atomic<uint64_t> epoch{ std::numeric_limits<uint64_t>::max() };///< The epoch this reader is pinned to, or max when inactive.
+			std::atomic_bool inUse{};///< Whether or not a thread currently owns this slot.
+			epoch_record* next{};///< The next slot in the domain's list.
+			uint64_t depth{};///< The pin nesting depth of the owning thread, when owned by a thread rather than a snapshot.
+		};
+
+		/// @brief An object that has been unlinked from a cache, awaiting reclamation.
+		struct retired_object {
+			void (*deleter)(void*){};///< The function used to destroy the object.
+			uint64_t epoch{};///< The epoch at which the object was retired.
+			void* object{};///< The object awaiting reclamation.
+		};
+
+		/// @brief Epoch-based reclamation domain, shared by every epoch_cache.
+		/// @details readers pin the current epoch for the duration of a read, which costs a single store to their own slot.
+		/// writers retire unlinked objects along with the epoch at which they were unlinked, and an object is only freed
+		/// once every pinned reader has moved past that epoch.
+		class epoch_domain {
+		  public:
+			static constexpr uint64_t inactiveEpoch{ std::numeric_limits<uint64_t>::max() };
+			static constexpr uint64_t reclaimThreshold{ 64 };
+
+			/// @brief Collects the process-wide epoch_domain.
+			/// @return the epoch_domain.
+			DCA_INLINE static epoch_domain& getInstance() {
+				static epoch_domain domain{};
+				return domain;
+			}
+
+			/// @brief Pins the current epoch for the calling thread.
+			/// @details the pin lives in a thread_local slot, so it must be released on the same thread, and never held across a co_await.
+			DCA_INLINE void pin() {
+				auto& record = getRecord();
+				if (record.depth++ == 0) {
+					record.epoch.store(globalEpoch.load(std::memory_order_acquire), std::memory_order_relaxed);
+					std::atomic_thread_fence(std::memory_order_seq_cst);
+				}
+			}
+
+			/// @brief Releases the calling thread's pin.
+			DCA_INLINE void unpin() {
+				auto& record = getRecord();
+				if (--record.depth == 0) {
+					record.epoch.store(inactiveEpoch, std::memory_order_release);
+				}
+			}
+
+			/// @brief Pins the current epoch in a slot of its own, which is not tied to the calling thread.
+			/// @details the slot claimed last by the calling thread is tried first, so a thread that repeatedly pins and releases
+			/// snapshots reclaims the same slot with a single uncontended exchange, rather than walking the domain's list.
+			/// @return the slot holding the pin, to be handed back to unpinRecord from any thread.
+			DCA_INLINE epoch_record* pinRecord() {
+				thread_local epoch_record* lastRecord{};
+				epoch_record* record{};
+				bool expected{};
+				if (lastRecord && lastRecord->inUse.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+					record = lastRecord;
+				} else {
+					record	   = acquireRecord();
+					lastRecord = record;
+				}
+				record->epoch.store(globalEpoch.load(std::memory_order_acquire), std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				return record;
+			}
+
+			/// @brief Releases a pin taken by pinRecord, and returns its slot to the domain.
+			/// @param record the slot holding the pin.
+			DCA_INLINE void unpinRecord(epoch_record* record) {
+				record->epoch.store(inactiveEpoch, std::memory_order_release);
+				record->inUse.store(false, std::memory_order_release);
+			}
+
+			/// @brief Hands an unlinked object to the domain, to be deleted once no reader can still observe it.
+			/// @tparam value_type the type of the object.
+			/// @param object the object to be retired.
+			template<typename value_type> DCA_INLINE void retire(value_type* object) {
+				retire(const_cast<std::remove_const_t<value_type>*>(object), [](void* objectNew) {
+					delete static_cast<value_type*>(objectNew);
+				});
+			}
+
+			/// @brief Hands an unlinked object to the domain, to be destroyed once no reader can still observe it.
+			/// @param object the object to be retired.
+			/// @param deleter the function used to destroy the object.
+			DCA_INLINE void retire(void* object, void (*deleter)(void*)) {
+				jsonifier::vector<retired_object> readyObjects{};
+				{
+					std::unique_lock lock{ retireMutex };
+					retiredObjects.emplace_back(retired_object{ deleter, globalEpoch.fetch_add(1, std::memory_order_acq_rel), object });
+					if (retiredObjects.size() >= reclaimThreshold) {
+						collectReadyObjects(readyObjects);
+					}
+				}
+				for (auto& value: readyObjects) {
+					value.deleter(value.object);
+				}
+			}
+
+			DCA_INLINE ~epoch_domain() {
+				for (auto& value: retiredObjects) {
+					value.deleter(value.object);
+				}
+				auto record = recordHead.load(std::memory_order_acquire);
+				while (record) {
+					delete std::exchange(record, record->next);
+				}
+			}
+
+		  protected:
+			/// @brief Returns a thread's slot to the domain when the thread exits.
+			struct record_holder {
+				epoch_record* record{};
+
+				DCA_INLINE ~record_holder() {
+					if (record) {
+						record->inUse.store(false, std::memory_order_release);
+					}
+				}
+			};
+
+			alignas(64) std::atomic<uint64_t> globalEpoch{};
+			std::atomic<epoch_record*> recordHead{};
+			jsonifier::vector<retired_object> retiredObjects{};
+			std::mutex retireMutex{};
+
+			DCA_INLINE epoch_domain() = default;
+
+			DCA_INLINE epoch_record& getRecord() {
+				thread_local record_holder holder{ acquireRecord() };
+				return *holder.record;
+			}
+
+			/// @brief Claims a free slot, or links a new one into the domain.
+			DCA_INLINE epoch_record* acquireRecord() {
+				for (auto record = recordHead.load(std::memory_order_acquire); record; record = record->next) {
+					bool expected{};
+					if (record->inUse.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+						return record;
+					}
+				}
+				auto record = new epoch_record{};
+				record->inUse.store(true, std::memory_order_relaxed);
+				record->next = recordHead.load(std::memory_order_relaxed);
+				while (!recordHead.compare_exchange_weak(record->next, record, std::memory_order_release, std::memory_order_relaxed)) {
+				}
+				return record;
+			}
+
+			/// @brief Moves every retired object that no pinned reader can still observe into the output vector.
+			/// @param readyObjects the vector to collect the reclaimable objects into.
+			DCA_INLINE void collectReadyObjects(jsonifier::vector<retired_object>& readyObjects) {
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				uint64_t oldestEpoch{ inactiveEpoch };
+				for (auto record = recordHead.load(std::memory_order_acquire); record; record = record->next) {
+					oldestEpoch = std::min(oldestEpoch, record->epoch.load(std::memory_order_relaxed));
+				}
+				uint64_t currentIndex{};
+				for (auto& value: retiredObjects) {
+					if (value.epoch < oldestEpoch) {
+						readyObjects.emplace_back(value);
+					} else {
+						retiredObjects[currentIndex++] = value;
+					}
+				}
+				retiredObjects.resize(currentIndex);
+			}
+		};
+
+		/// @brief Reduces a cached object, or a key used to look one up, to the key that objects are told apart by.
+		/// @tparam value_type the type of the object or key.
+		/// @param value the object or key.
+		/// @return the key.
+		template<typename value_type> DCA_INLINE decltype(auto) getComparisonKey(const value_type& value) {
+			if constexpr (has_two_id<value_type>) {
+				return two_id_key{ value };
+			} else if constexpr (has_id<value_type>) {
+				return (value.id);
+			} else {
+				return (value);
+			}
+		}
+
+		/// @brief Checks whether a cached object is the one a key refers to, as distinct keys may share a hash.
+		/// @tparam value_type the type of the cached object.
+		/// @tparam key_type the type of the key.
+		/// @param value the cached object.
+		/// @param key the key.
+		/// @return `true` if the object's key equals the given key.
+		template<typename value_type, typename key_type> DCA_INLINE bool keysMatch(const value_type& value, const key_type& key) {
+			return getComparisonKey(value) == getComparisonKey(key);
+		}
+
+	}
+
+	/// @brief Pins the current epoch for the lifetime of the guard, keeping any object read under it alive.
+	/// @details the guard pins the calling thread's slot, so it must not be held across a co_await.
+	class epoch_guard {
+	  public:
+		DCA_INLINE epoch_guard& operator=(const epoch_guard&) = delete;
+		DCA_INLINE epoch_guard(const epoch_guard&)			  = delete;
+
+		DCA_INLINE epoch_guard() {
+			discord_core_internal::epoch_domain::getInstance().pin();
+		}
+
+		DCA_INLINE ~epoch_guard() {
+			discord_core_internal::epoch_domain::getInstance().unpin();
+		}
+	};
+
+	/// @brief A read-only view of a cached object, which stays valid for as long as the snapshot is alive.
+	/// @details a snapshot holds its own pin, so it may be moved to and released on any thread, including across a co_await.
+	/// @tparam value_type the type of the cached object.
+	template<typename value_type> class cache_snapshot {
+	  public:
+		using const_reference = const value_type&;
+		using const_pointer	  = const value_type*;
+
+		DCA_INLINE cache_snapshot& operator=(const cache_snapshot&) = delete;
+		DCA_INLINE cache_snapshot(const cache_snapshot&)			= delete;
+
+		DCA_INLINE cache_snapshot() = default;
+
+		DCA_INLINE cache_snapshot& operator=(cache_snapshot&& other) noexcept {
+			if (this != &other) {
+				release();
+				ownedValue = std::move(other.ownedValue);
+				value	   = std::exchange(other.value, nullptr);
+				record	   = std::exchange(other.record, nullptr);
+			}
+			return *this;
+		}
+
+		DCA_INLINE cache_snapshot(cache_snapshot&& other) noexcept {
+			*this = std::move(other);
+		}
+
+		/// @brief Creates a snapshot of an object that is kept alive by a pin, which the snapshot takes ownership of.
+		/// @param valueNew the object to be viewed.
+		/// @param recordNew the slot holding the pin, as returned by epoch_domain::pinRecord.
+		DCA_INLINE static cache_snapshot fromPinned(const_pointer valueNew, discord_core_internal::epoch_record* recordNew) {
+			cache_snapshot returnValue{};
+			returnValue.value  = valueNew;
+			returnValue.record = recordNew;
+			return returnValue;
+		}
+
+		/// @brief Creates a snapshot that owns its own copy of an object.
+		/// @param valueNew the object to be copied.
+		DCA_INLINE static cache_snapshot fromCopy(const_reference valueNew) {
+			cache_snapshot returnValue{};
+			returnValue.ownedValue = makeUnique<value_type>(valueNew);
+			returnValue.value	   = returnValue.ownedValue.get();
+			return returnValue;
+		}
+
+		DCA_INLINE const_pointer operator->() const {
+			return value;
+		}
+
+		DCA_INLINE const_reference operator*() const {
+			return *value;
+		}
+
+		DCA_INLINE explicit operator bool() const {
+			return value != nullptr;
+		}
+
+		DCA_INLINE ~cache_snapshot() {
+			release();
+		}
+
+	  protected:
+		unique_ptr<value_type> ownedValue{};
+		discord_core_internal::epoch_record* record{};
+		const_pointer value{};
+
+		DCA_INLINE void release() {
+			if (record) {
+				discord_core_internal::epoch_domain::getInstance().unpinRecord(std::exchange(record, nullptr));
+			}
+			ownedValue.reset();
+			value = nullptr;
+		}
+	};
+
+	/// @brief A sharded hash cache whose reads never lock, with writers publishing new versions of each object.
+	/// @details each stored object is immutable once published. writers serialize per shard, swap in a new version
+	/// and retire the old one to the epoch_domain, which frees it once no reader can still be looking at it.
+	/// @tparam value_type the type of values stored in the cache.
+	/// @tparam shard_count the number of shards to split the cache into, must be a power of two.
+	template<typename value_type, uint64_t shard_count = 16> class epoch_cache {
+	  public:
+		using mapped_type	  = value_type;
+		using const_reference = const mapped_type&;
+		using const_pointer	  = const mapped_type*;
+
+		static_assert(shard_count > 0 && (shard_count & (shard_count - 1)) == 0, "Sorry, but the shard count must be a power of two.");
+
+		/// @brief A link in one of the cache's bucket chains.
+		struct cache_node {
+			std::atomic<const_pointer> value{};///< The currently published version of the object.
+			std::atomic<cache_node*> next{};///< The next link in this bucket's chain.
+			uint64_t hash{};///< The hash of the object's key.
+		};
+
+		/// @brief The bucket array of a single shard, replaced as a whole when the shard grows.
+		struct bucket_array {
+			DCA_INLINE bucket_array(uint64_t capacityNew) : buckets{ makeUnique<std::atomic<cache_node*>[]>(capacityNew) }, capacity{ capacityNew } {};
+
+			unique_ptr<std::atomic<cache_node*>[]> buckets{};///< The heads of each bucket's chain.
+			uint64_t capacity{};///< The number of buckets, always a power of two.
+
+			DCA_INLINE ~bucket_array() {
+				for (uint64_t x = 0; x < capacity; ++x) {
+					auto node = buckets[x].load(std::memory_order_relaxed);
+					while (node) {
+						delete std::exchange(node, node->next.load(std::memory_order_relaxed));
+					}
+				}
+			}
+		};
+
+		/// @brief A single shard of the cache, with its own bucket array and writer lock.
+		struct alignas(64) cache_shard {
+			std::atomic<bucket_array*> table{};///< The currently published bucket array.
+			std::atomic<uint64_t> size{};///< The number of objects in this shard.
+			std::mutex writeMutex{};///< Mutex for serializing the writers of this shard.
+		};
+
+		static constexpr uint64_t initialCapacity{ 16 };
+
+		/// @brief Default constructor for the epoch_cache class.
+		DCA_INLINE epoch_cache() {
+			for (auto& shard: shards) {
+				shard.table.store(new bucket_array{ initialCapacity }, std::memory_order_release);
+			}
+		}
+
+		DCA_INLINE epoch_cache& operator=(const epoch_cache&) = delete;
+		DCA_INLINE epoch_cache(const epoch_cache&)			  = delete;
+
+		/// @brief Add an object to the cache, replacing any existing object with the same key.
+		/// @tparam mapped_type_new the type of the object to be added.
+		/// @param object the object to be added to the cache.
+		template<typename mapped_type_new> DCA_INLINE void emplace(mapped_type_new&& object) {
+			auto newValue = new mapped_type{ std::forward<mapped_type_new>(object) };
+			auto hash	  = key_accessor<mapped_type>::getHashKey(*newValue);
+			auto& shard	  = getShard(hash);
+			std::unique_lock lock{ shard.writeMutex };
+			if (auto node = findNode(shard.table.load(std::memory_order_relaxed), hash, *newValue); node) {
+				publishValue(*node, newValue);
+				return;
+			}
+			if ((shard.size.load(std::memory_order_relaxed) + 1) * 4 > shard.table.load(std::memory_order_relaxed)->capacity * 3) {
+				grow(shard);
+			}
+			auto table	 = shard.table.load(std::memory_order_relaxed);
+			auto& bucket = table->buckets[hash & (table->capacity - 1)];
+			auto newNode = new cache_node{};
+			newNode->value.store(newValue, std::memory_order_relaxed);
+			newNode->next.store(bucket.load(std::memory_order_relaxed), std::memory_order_relaxed);
+			newNode->hash = hash;
+			bucket.store(newNode, std::memory_order_release);
+			shard.size.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		/// @brief Publish a modified copy of an object in the cache.
+		/// @tparam mapped_type_new the type of the key used for access.
+		/// @tparam function_type the type of the function to apply.
+		/// @param key the key of the object to be modified.
+		/// @param function the function to apply to the new version of the object.
+		/// @return `true` if an object was modified, `false` if no object with that key exists.
+		template<typename mapped_type_new, typename function_type> DCA_INLINE bool modify(mapped_type_new&& key, function_type&& function) {
+			auto hash	= key_accessor<std::remove_cvref_t<mapped_type_new>>::getHashKey(key);
+			auto& shard = getShard(hash);
+			std::unique_lock lock{ shard.writeMutex };
+			if (auto node = findNode(shard.table.load(std::memory_order_relaxed), hash, key); node) {
+				auto newValue = new mapped_type{ *node->value.load(std::memory_order_relaxed) };
+				std::forward<function_type>(function)(*newValue);
+				publishValue(*node, newValue);
+				return true;
+			}
+			return false;
+		}
+
+		/// @brief Read an object in the cache in place, without taking any locks.
+		/// @tparam mapped_type_new the type of the key used for access.
+		/// @tparam function_type the type of the function to invoke.
+		/// @param key the key of the object to be read.
+		/// @param function the function to invoke, which receives a const reference to the object.
+		/// @return `true` if an object was read, `false` if no object with that key exists.
+		template<typename mapped_type_new, typename function_type> DCA_INLINE bool visit(mapped_type_new&& key, function_type&& function) {
+			auto hash = key_accessor<std::remove_cvref_t<mapped_type_new>>::getHashKey(key);
+			epoch_guard guard{};
+			if (auto node = findNode(getShard(hash).table.load(std::memory_order_acquire), hash, key); node) {
+				std::forward<function_type>(function)(*node->value.load(std::memory_order_acquire));
+				return true;
+			}
+			return false;
+		}
+
+		/// @brief Collect a snapshot of an object in the cache, without taking any locks.
+		/// @tparam mapped_type_new the type of the key used for access.
+		/// @param key the key of the object to be viewed.
+		/// @return a snapshot of the object, which is empty if no object with that key exists.
+		template<typename mapped_type_new> DCA_INLINE cache_snapshot<mapped_type> find(mapped_type_new&& key) {
+			auto hash = key_accessor<std::remove_cvref_t<mapped_type_new>>::getHashKey(key);
+			auto& domain{ discord_core_internal::epoch_domain::getInstance() };
+			auto record = domain.pinRecord();
+			if (auto node = findNode(getShard(hash).table.load(std::memory_order_acquire), hash, key); node) {
+				return cache_snapshot<mapped_type>::fromPinned(node->value.load(std::memory_order_acquire), record);
+			}
+			domain.unpinRecord(record);
+			return {};
+		}
+
+		/// @brief Check if the cache contains an object with a given key.
+		/// @tparam mapped_type_new the type of the key to be checked.
+		/// @param key the key to check for existence in the cache.
+		/// @return `true` if the cache contains the key, `false` otherwise.
+		template<typename mapped_type_new> DCA_INLINE bool contains(mapped_type_new&& key) {
+			auto hash = key_accessor<std::remove_cvref_t<mapped_type_new>>::getHashKey(key);
+			epoch_guard guard{};
+			return findNode(getShard(hash).table.load(std::memory_order_acquire), hash, key) != nullptr;
+		}
+
+		/// @brief Remove an object from the cache using a key.
+		/// @tparam mapped_type_new the type of the key used for removal.
+		/// @param key the key used to remove the object from the cache.
+		template<typename mapped_type_new> DCA_INLINE void erase(mapped_type_new&& key) {
+			auto hash	= key_accessor<std::remove_cvref_t<mapped_type_new>>::getHashKey(key);
+			auto& shard = getShard(hash);
+			std::unique_lock lock{ shard.writeMutex };
+			auto table = shard.table.load(std::memory_order_relaxed);
+			auto link  = &table->buckets[hash & (table->capacity - 1)];
+			while (auto node = link->load(std::memory_order_relaxed)) {
+				if (node->hash == hash && discord_core_internal::keysMatch(*node->value.load(std::memory_order_relaxed), key)) {
+					link->store(node->next.load(std::memory_order_relaxed), std::memory_order_release);
+					shard.size.fetch_sub(1, std::memory_order_relaxed);
+					auto& domain{ discord_core_internal::epoch_domain::getInstance() };
+					domain.retire(node->value.load(std::memory_order_relaxed));
+					domain.retire(node);
+					return;
+				}
+				link = &node->next;
+			}
+		}
+
+		/// @brief Invoke a function on every object currently in the cache, without taking any locks.
+		/// @tparam function_type the type of the function to invoke.
+		/// @param function the function to invoke, which receives a const reference to each object.
+		template<typename function_type> DCA_INLINE void forEach(function_type&& function) {
+			epoch_guard guard{};
+			for (auto& shard: shards) {
+				auto table = shard.table.load(std::memory_order_acquire);
+				for (uint64_t x = 0; x < table->capacity; ++x) {
+					for (auto node = table->buckets[x].load(std::memory_order_acquire); node; node = node->next.load(std::memory_order_acquire)) {
+						function(*node->value.load(std::memory_order_acquire));
+					}
+				}
+			}
+		}
+
+		/// @brief Get the number of objects currently in the cache.
+		/// @return the number of objects in the cache.
+		DCA_INLINE uint64_t count() {
+			uint64_t returnValue{};
+			for (auto& shard: shards) {
+				returnValue += shard.size.load(std::memory_order_relaxed);
+			}
+			return returnValue;
+		}
+
+		/// @brief Destructor for the epoch_cache class, which must not run while any reader is still active.
+		DCA_INLINE ~epoch_cache() {
+			for (auto& shard: shards) {
+				auto table = shard.table.load(std::memory_order_acquire);
+				for (uint64_t x = 0; x < table->capacity; ++x) {
+					for (auto node = table->buckets[x].load(std::memory_order_relaxed); node; node = node->next.load(std::memory_order_relaxed)) {
+						delete node->value.load(std::memory_order_relaxed);
+					}
+				}
+				delete table;
+			}
+		}
+
+	  protected:
+		std::array<cache_shard, shard_count> shards{};///< The independently written shards of the cache.
+
+		/// @brief Select the shard responsible for a hash.
+		/// @details the upper bits of the hash are used, as the lower bits index into each shard's buckets.
+		/// @param hash the hash to select the shard for.
+		/// @return the shard responsible for the hash.
+		DCA_INLINE cache_shard& getShard(uint64_t hash) {
+			static constexpr uint64_t shardBits{ static_cast<uint64_t>(std::countr_zero(shard_count)) };
+			if constexpr (shardBits == 0) {
+				return shards[0];
+			} else {
+				return shards[hash >> (64 - shardBits)];
+			}
+		}
+
+		/// @brief Walk a bucket chain for the node holding a key.
+		/// @tparam key_type the type of the key.
+		/// @param table the bucket array to search.
+		/// @param hash the hash of the key.
+		/// @param key the key, which is compared against each node whose hash matches.
+		/// @return the node, or nullptr if no object with that key exists.
+		template<typename key_type> DCA_INLINE static cache_node* findNode(bucket_array* table, uint64_t hash, const key_type& key) {
+			for (auto node = table->buckets[hash & (table->capacity - 1)].load(std::memory_order_acquire); node; node = node->next.load(std::memory_order_acquire)) {
+				if (node->hash == hash && discord_core_internal::keysMatch(*node->value.load(std::memory_order_acquire), key)) {
+					return node;
+				}
+			}
+			return nullptr;
+		}
+
+		DCA_INLINE static void publishValue(cache_node& node, const_pointer newValue) {
+			auto oldValue = node.value.exchange(newValue, std::memory_order_acq_rel);
+			discord_core_internal::epoch_domain::getInstance().retire(oldValue);
+		}
+
+		/// @brief Publishes a bucket array of twice the capacity, leaving the old one intact for any reader still walking it.
+		/// @param shard the shard to grow, whose write lock must be held.
+		DCA_INLINE static void grow(cache_shard& shard) {
+			auto oldTable = shard.table.load(std::memory_order_relaxed);
+			auto newTable = new bucket_array{ oldTable->capacity * 2 };
+			for (uint64_t x = 0; x < oldTable->capacity; ++x) {
+				for (auto node = oldTable->buckets[x].load(std::memory_order_relaxed); node; node = node->next.load(std::memory_order_relaxed)) {
+					auto& bucket = newTable->buckets[node->hash & (newTable->capacity - 1)];
+					auto newNode = new cache_node{};
+					newNode->value.store(node->value.load(std::memory_order_relaxed), std::memory_order_relaxed);
+					newNode->next.store(bucket.load(std::memory_order_relaxed), std::memory_order_relaxed);
+					newNode->hash = node->hash;
+					bucket.store(newNode, std::memory_order_relaxed);
+				}
+			}
+			shard.table.store(newTable, std::memory_order_release);
+			discord_core_internal::epoch_domain::getInstance().retire(oldTable);
+		}
+	};
+
+	/// @brief An entity cache which is backed either by a locked object_cache, or by an epoch_cache whose reads never lock.
+	/// @tparam value_type the type of values stored in the cache.
+	template<typename value_type> class entity_cache {
+	  public:
+		using mapped_type = value_type;
+
+		/// @brief Selects the backing store, which must happen before the cache is first populated.
+		/// @param snapshotReadsNew whether or not to use the epoch_cache.
+		DCA_INLINE void setSnapshotReads(bool snapshotReadsNew) {
+			snapshotReads = snapshotReadsNew;
+		}
+
+		/// @brief Add an object to the cache, replacing any existing object with the same key.
+		/// @tparam mapped_type_new the type of the object to be added.
+		/// @param object the object to be added to the cache.
+		template<typename mapped_type_new> DCA_INLINE void emplace(mapped_type_new&& object) {
+			if (snapshotReads) {
+				epochCache.emplace(std::forward<mapped_type_new>(object));
+			} else {
+				objectCache.emplace(std::forward<mapped_type_new>(object));
+			}
+		}
+
+		/// @brief Modify an object in the cache.
+		/// @tparam mapped_type_new the type of the key used for access.
+		/// @tparam function_type the type of the function to apply.
+		/// @param key the key of the object to be modified.
+		/// @param function the function to apply to the object.
+		/// @return `true` if an object was modified, `false` if no object with that key exists.
+		template<typename mapped_type_new, typename function_type> DCA_INLINE bool modify(mapped_type_new&& key, function_type&& function) {
+			if (snapshotReads) {
+				return epochCache.modify(std::forward<mapped_type_new>(key), std::forward<function_type>(function));
+			} else {
+				return objectCache.modify(std::forward<mapped_type_new>(key), std::forward<function_type>(function));
+			}
+		}
+
+		/// @brief Read an object in the cache in place, without copying it.
+		/// @details with snapshot reads enabled the read takes no locks, otherwise it holds the object's shard lock in shared mode,
+		/// so the function must not write to the same cache.
+		/// @tparam mapped_type_new the type of the key used for access.
+		/// @tparam function_type the type of the function to invoke.
+		/// @param key the key of the object to be read.
+		/// @param function the function to invoke, which receives a const reference to the object.
+		/// @return `true` if an object was read, `false` if no object with that key exists.
+		template<typename mapped_type_new, typename function_type> DCA_INLINE bool visit(mapped_type_new&& key, function_type&& function) {
+			if (snapshotReads) {
+				return epochCache.visit(std::forward<mapped_type_new>(key), std::forward<function_type>(function));
+			} else {
+				return objectCache.visit(std::forward<mapped_type_new>(key), std::forward<function_type>(function));
+			}
+		}
+
+		/// @brief Collect a snapshot of an object in the cache.
+		/// @details with snapshot reads enabled this is a pinned view of the object, otherwise it is a copy of it.
+		/// @tparam mapped_type_new the type of the key used for access.
+		/// @param key the key of the object to be viewed.
+		/// @return a snapshot of the object, which is empty if no object with that key exists.
+		template<typename mapped_type_new> DCA_INLINE cache_snapshot<mapped_type> find(mapped_type_new&& key) {
+			if (snapshotReads) {
+				return epochCache.find(std::forward<mapped_type_new>(key));
+			} else {
+				cache_snapshot<mapped_type> returnValue{};
+				objectCache.visit(std::forward<mapped_type_new>(key), [&](const mapped_type& value) {
+					returnValue = cache_snapshot<mapped_type>::fromCopy(value);
+				});
+				return returnValue;
+			}
+		}
+
+		/// @brief Check if the cache contains an object with a given key.
+		/// @tparam mapped_type_new the type of the key to be checked.
+		/// @param key the key to check for existence in the cache.
+		/// @return `true` if the cache contains the key, `false` otherwise.
+		template<typename mapped_type_new> DCA_INLINE bool contains(mapped_type_new&& key) {
+			if (snapshotReads) {
+				return epochCache.contains(std::forward<mapped_type_new>(key));
+			} else {
+				return objectCache.contains(std::forward<mapped_type_new>(key));
+			}
+		}
+
+		/// @brief Remove an object from the cache using a key.
+		/// @tparam mapped_type_new the type of the key used for removal.
+		/// @param key the key used to remove the object from the cache.
+		template<typename mapped_type_new> DCA_INLINE void erase(mapped_type_new&& key) {
+			if (snapshotReads) {
+				epochCache.erase(std::forward<mapped_type_new>(key));
+			} else {
+				objectCache.erase(std::forward<mapped_type_new>(key));
+			}
+		}
+
+		/// @brief Invoke a function on every object currently in the cache.
+		/// @tparam function_type the type of the function to invoke.
+		/// @param function the function to invoke, which receives a const reference to each object.
+		template<typename function_type> DCA_INLINE void forEach(function_type&& function) {
+			if (snapshotReads) {
+				epochCache.forEach(std::forward<function_type>(function));
+			} else {
+				for (auto& value: objectCache) {
+					function(static_cast<const mapped_type&>(*value));
+				}
+			}
+		}
+
+		/// @brief Get the number of objects currently in the cache.
+		/// @return the number of objects in the cache.
+		DCA_INLINE uint64_t count() {
+			return snapshotReads ? epochCache.count() : objectCache.count();
+		}
+
+		/// @brief Collects the locked backing store, which holds every object while snapshot reads are disabled.
+		/// @return the object_cache.
+		DCA_INLINE object_cache<mapped_type>& getObjectCache() {
+			return objectCache;
+		}
+
+	  protected:
+		object_cache<mapped_type> objectCache{};///< The locked backing store.
+		epoch_cache<mapped_type> epochCache{};///< The lock-free backing store.
+		bool snapshotReads{};///< Whether or not the epoch_cache is in use.
+	};
+
+}
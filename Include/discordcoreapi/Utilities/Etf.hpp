@@ -120,7 +120,21 @@ namespace discord_core_api {
 
 		constexpr uint8_t formatVersion{ 131 };
 
+		/// @brief The top-level fields of a gateway payload, decoded directly from etf.
+		struct etf_envelope {
+			jsonifier::string_view t{};///< The event name, as a view into the etf buffer.
+			uint64_t dataOffset{};///< The offset of the "d" term within the etf buffer.
+			uint64_t dataLength{};///< The length of the "d" term, in bytes.
+			int64_t op{ -1 };///< The payload's opcode.
+			bool haveData{};///< Whether or not a "d" term was present.
+			bool haveT{};///< Whether or not a non-null "t" term was present.
+			bool haveS{};///< Whether or not a non-null "s" term was present.
+			int64_t s{};///< The payload's sequence number.
+		};
+
 		/// @brief Class for parsing etf data into json format.
+		/// @details the gateway envelope (op, s and t) is decoded natively, and the "d" term is handed on as etf, for etf_reader to read into its
+		/// event structure directly.
 		class DiscordCoreAPI_Dll etf_parser : public jsonifier_internal::alloc_wrapper<uint8_t> {
 		  public:
 			friend class websocket_client;
@@ -142,6 +156,75 @@ namespace discord_core_api {
 				return { finalString.data(), currentSize };
 			}
 
+			/// @brief Decode the envelope of a gateway payload without transcoding it to json.
+			/// @param dataToParse the etf data to be parsed.
+			/// @return the decoded op, s and t values, along with the location of the "d" term.
+			DCA_INLINE etf_envelope parseEtfEnvelope(jsonifier::string_view_base<uint8_t> dataToParse) {
+				dataBuffer = dataToParse.data();
+				dataSize   = dataToParse.size();
+				offSet	   = 0;
+				if (readBitsFromBuffer<uint8_t>() != formatVersion) {
+					throw etf_parse_error{ "etf_parser::parseEtfEnvelope() error: incorrect format version specified." };
+				}
+				if (static_cast<etf_type>(readBitsFromBuffer<uint8_t>()) != etf_type::Map_Ext) {
+					throw etf_parse_error{ "etf_parser::parseEtfEnvelope() error: expected a map at the top level." };
+				}
+				etf_envelope returnValue{};
+				uint32_t length = readBitsFromBuffer<uint32_t>();
+				for (uint32_t x = 0; x < length; ++x) {
+					jsonifier::string_view key{ readStringFromBuffer() };
+					if (key == "d") {
+						returnValue.dataOffset = offSet;
+						returnValue.haveData   = true;
+						skipValue();
+						returnValue.dataLength = offSet - returnValue.dataOffset;
+					} else if (key == "op") {
+						readIntegerFromBuffer(returnValue.op);
+					} else if (key == "s") {
+						returnValue.haveS = readIntegerFromBuffer(returnValue.s);
+					} else if (key == "t") {
+						returnValue.t	  = readStringFromBuffer();
+						returnValue.haveT = returnValue.t.size() > 0 && returnValue.t != "nil" && returnValue.t != "null";
+					} else {
+						skipValue();
+					}
+				}
+				return returnValue;
+			}
+
+			/// @brief Transcode only the "d" term of a previously decoded envelope to json.
+			/// @param dataToParse the etf data that the envelope was decoded from.
+			/// @param envelope the envelope returned by parseEtfEnvelope().
+			/// @return the json representation of the "d" term alone.
+			DCA_INLINE jsonifier::string_view_base<uint8_t> parseEtfDataToJson(jsonifier::string_view_base<uint8_t> dataToParse, const etf_envelope& envelope) {
+				dataBuffer	= dataToParse.data();
+				dataSize	= dataToParse.size();
+				currentSize = 0;
+				offSet		= envelope.dataOffset;
+				if (envelope.haveData) {
+					singleValueETFToJson();
+				} else {
+					writeCharacters("null");
+				}
+				return { finalString.data(), currentSize };
+			}
+
+			/// @brief Collect the "d" term of a previously decoded envelope as a standalone etf term, without transcoding it.
+			/// @param dataToParse the etf data that the envelope was decoded from.
+			/// @param envelope the envelope returned by parseEtfEnvelope().
+			/// @return the "d" term, preceded by the format version, or a nil atom if there was no "d" term.
+			DCA_INLINE jsonifier::string_view_base<uint8_t> parseEtfDataTerm(jsonifier::string_view_base<uint8_t> dataToParse, const etf_envelope& envelope) {
+				static constexpr uint8_t nilTerm[]{ static_cast<uint8_t>(etf_type::Small_Atom_Ext), 3, 'n', 'i', 'l' };
+				const uint8_t* term{ envelope.haveData ? dataToParse.data() + envelope.dataOffset : nilTerm };
+				uint64_t termLength{ envelope.haveData ? envelope.dataLength : std::size(nilTerm) };
+				if (finalString.size() < termLength + 1) {
+					finalString.resize(termLength + 1);
+				}
+				finalString[0] = formatVersion;
+				std::memcpy(finalString.data() + 1, term, termLength);
+				return { finalString.data(), termLength + 1 };
+			}
+
 		  protected:
 			jsonifier::string_base<uint8_t> finalString{};///< The final json string.
 			const uint8_t* dataBuffer{};///< Pointer to etf data buffer.
@@ -281,6 +364,134 @@ namespace discord_core_api {
 				allocator::construct(&finalString[currentSize++], static_cast<uint8_t>(charToWrite));
 			}
 
+			/// @brief Advance past a number of bytes in the data buffer.
+			/// @param length the number of bytes to skip.
+			DCA_INLINE void skipBytes(uint64_t length) {
+				if (offSet + length > dataSize) {
+					throw etf_parse_error{ "etf_parser::skipBytes() error: read past end of buffer." };
+				}
+				offSet += length;
+			}
+
+			/// @brief Read an atom, string or binary term as a view into the data buffer.
+			/// @return the contents of the term.
+			DCA_INLINE jsonifier::string_view readStringFromBuffer() {
+				uint64_t length{};
+				switch (static_cast<etf_type>(readBitsFromBuffer<uint8_t>())) {
+					case etf_type::Small_Atom_Ext: {
+						length = readBitsFromBuffer<uint8_t>();
+						break;
+					}
+					case etf_type::Atom_Ext:
+						[[fallthrough]];
+					case etf_type::String_Ext: {
+						length = readBitsFromBuffer<uint16_t>();
+						break;
+					}
+					case etf_type::Binary_Ext: {
+						length = readBitsFromBuffer<uint32_t>();
+						break;
+					}
+					default: {
+						throw etf_parse_error{ "etf_parser::readStringFromBuffer() error: expected a string-like term." };
+					}
+				}
+				const char* stringNew = reinterpret_cast<const char*>(dataBuffer + offSet);
+				skipBytes(length);
+				return { stringNew, length };
+			}
+
+			/// @brief Read an integer term, treating a nil atom as an absent value.
+			/// @param value the value to store the integer in.
+			/// @return whether or not an integer was read.
+			DCA_INLINE bool readIntegerFromBuffer(int64_t& value) {
+				switch (static_cast<etf_type>(readBitsFromBuffer<uint8_t>())) {
+					case etf_type::Small_Integer_Ext: {
+						value = readBitsFromBuffer<uint8_t>();
+						return true;
+					}
+					case etf_type::Integer_Ext: {
+						value = static_cast<int32_t>(readBitsFromBuffer<uint32_t>());
+						return true;
+					}
+					case etf_type::Small_Big_Ext: {
+						auto digits	 = readBitsFromBuffer<uint8_t>();
+						uint8_t sign = readBitsFromBuffer<uint8_t>();
+						if (digits > 8) {
+							throw etf_parse_error{ "etf_parser::readIntegerFromBuffer() error: big integers larger than 8 bytes not supported." };
+						}
+						uint64_t valueNew{};
+						for (uint8_t x = 0; x < digits; ++x) {
+							valueNew |= static_cast<uint64_t>(readBitsFromBuffer<uint8_t>()) << (x * 8);
+						}
+						value = sign == 0 ? static_cast<int64_t>(valueNew) : -static_cast<int64_t>(valueNew);
+						return true;
+					}
+					case etf_type::Small_Atom_Ext: {
+						skipBytes(readBitsFromBuffer<uint8_t>());
+						return false;
+					}
+					case etf_type::Atom_Ext: {
+						skipBytes(readBitsFromBuffer<uint16_t>());
+						return false;
+					}
+					default: {
+						throw etf_parse_error{ "etf_parser::readIntegerFromBuffer() error: expected an integer term." };
+					}
+				}
+			}
+
+			/// @brief Skip over a single etf value without converting it.
+			DCA_INLINE void skipValue() {
+				switch (static_cast<etf_type>(readBitsFromBuffer<uint8_t>())) {
+					case etf_type::New_Float_Ext: {
+						return skipBytes(8);
+					}
+					case etf_type::Small_Integer_Ext: {
+						return skipBytes(1);
+					}
+					case etf_type::Integer_Ext: {
+						return skipBytes(4);
+					}
+					case etf_type::Atom_Ext:
+						[[fallthrough]];
+					case etf_type::String_Ext: {
+						return skipBytes(readBitsFromBuffer<uint16_t>());
+					}
+					case etf_type::Nil_Ext: {
+						return;
+					}
+					case etf_type::List_Ext: {
+						uint32_t length = readBitsFromBuffer<uint32_t>();
+						for (uint32_t x = 0; x < length; ++x) {
+							skipValue();
+						}
+						return skipValue();
+					}
+					case etf_type::Binary_Ext: {
+						return skipBytes(readBitsFromBuffer<uint32_t>());
+					}
+					case etf_type::Small_Big_Ext: {
+						auto digits = readBitsFromBuffer<uint8_t>();
+						return skipBytes(1ull + digits);
+					}
+					case etf_type::Small_Atom_Ext: {
+						return skipBytes(readBitsFromBuffer<uint8_t>());
+					}
+					case etf_type::Map_Ext: {
+						uint32_t length = readBitsFromBuffer<uint32_t>();
+						for (uint32_t x = 0; x < length; ++x) {
+							skipValue();
+							skipValue();
+						}
+						return;
+					}
+					default: {
+						throw etf_parse_error{ "etf_parser::skipValue() error: unknown data type in etf." };
+					}
+				}
+			}
+
 			/// @brief Parse a single etf value and convert to json.
 			DCA_INLINE void singleValueETFToJson() {
 				if (offSet > dataSize) {
@@ -1000,9 +1211,407 @@ namespace discord_core_api {
 			}
 		};
 
+		/// @brief Concept for std::optional members.
+		template<typename value_type>
+		concept etf_optional_t = requires(std::remove_cvref_t<value_type> value) {
+			typename std::remove_cvref_t<value_type>::value_type;
+			value.has_value();
+			value.emplace();
+			value.reset();
+		};
+
+		/// @brief Concept for the tuple of member entries that jsonifier::createValue builds for a type.
+		template<typename value_type>
+		concept etf_tuple_like = requires { std::tuple_size<std::remove_cvref_t<value_type>>::value; };
+
+		/// @brief Collects the member tuple out of a type's jsonifier::core metadata, whether or not createValue wrapped it.
+		/// @tparam value_type the type whose metadata is collected.
+		/// @return a reference to the member tuple.
+		template<typename value_type> DCA_INLINE constexpr const auto& getEtfCoreTuple() {
+			if constexpr (requires { jsonifier::core<value_type>::parseValue.parseValue; }) {
+				return jsonifier::core<value_type>::parseValue.parseValue;
+			} else {
+				return jsonifier::core<value_type>::parseValue;
+			}
+		}
+
+		/// @brief Concept for the keys stored in a member entry, which can be viewed as a string.
+		template<typename value_type>
+		concept etf_key_like = std::is_convertible_v<const std::remove_cvref_t<value_type>&, jsonifier::string_view> ||
+			requires(const std::remove_cvref_t<value_type>& value) { value.view().data(); } || requires(const std::remove_cvref_t<value_type>& value) {
+				value.data();
+				value.size();
+			};
+
+		/// @brief Reduces a key, as stored in a member entry, to a string_view.
+		template<etf_key_like value_type> DCA_INLINE constexpr jsonifier::string_view getEtfKey(const value_type& value) {
+			if constexpr (std::is_convertible_v<const value_type&, jsonifier::string_view>) {
+				return value;
+			} else if constexpr (requires { value.view(); }) {
+				return jsonifier::string_view{ value.view().data(), value.view().size() };
+			} else {
+				return jsonifier::string_view{ value.data(), value.size() };
+			}
+		}
+
+		/// @brief The member layout of a type's jsonifier::core metadata, as read by etf_reader.
+		/// @details createValue("key", &value_type::member, ...) has stored its pairs as entities with a name and memberPtr, as key/member pairs, and
+		/// as a flat alternating tuple, across jsonifier releases. each layout is recognised here, and nowhere else, so that etf_reader stays
+		/// independent of it. a type whose layout is not recognised is transcoded to json and handed to jsonifier instead.
+		template<typename value_type> struct etf_core_members {
+			static constexpr bool present{ false };
+		};
+
+		template<typename value_type>
+			requires requires { jsonifier::core<value_type>::parseValue; } && etf_tuple_like<decltype(getEtfCoreTuple<value_type>())>
+		struct etf_core_members<value_type> {
+			using tuple_type = std::remove_cvref_t<decltype(getEtfCoreTuple<value_type>())>;
+			static constexpr uint64_t tupleSize{ std::tuple_size<tuple_type>::value };
+
+			template<uint64_t index> DCA_INLINE static constexpr decltype(auto) getElement() {
+				using std::get;
+				return get<index>(getEtfCoreTuple<value_type>());
+			}
+
+			template<uint64_t index> static constexpr bool isEntity() {
+				return requires {
+					getElement<index>().name;
+					getElement<index>().memberPtr;
+				};
+			}
+
+			template<uint64_t index> static constexpr bool isPair() {
+				using element_type = std::remove_cvref_t<decltype(getElement<index>())>;
+				if constexpr (etf_tuple_like<element_type> && !isEntity<index>()) {
+					if constexpr (std::tuple_size<element_type>::value == 2) {
+						using std::get;
+						using key_type	  = decltype(get<0>(getElement<index>()));
+						using member_type = std::remove_cvref_t<decltype(get<1>(getElement<index>()))>;
+						return etf_key_like<key_type> && std::is_member_object_pointer_v<member_type>;
+					}
+				}
+				return false;
+			}
+
+			template<uint64_t index> static constexpr bool isFlatPair() {
+				using member_type = std::remove_cvref_t<decltype(getElement<index + 1>())>;
+				return etf_key_like<decltype(getElement<index>())> && std::is_member_object_pointer_v<member_type>;
+			}
+
+			template<uint64_t... indices> static constexpr bool allEntities(std::index_sequence<indices...>) {
+				return (isEntity<indices>() && ...);
+			}
+
+			template<uint64_t... indices> static constexpr bool allPairs(std::index_sequence<indices...>) {
+				return (isPair<indices>() && ...);
+			}
+
+			template<uint64_t... indices> static constexpr bool allFlatPairs(std::index_sequence<indices...>) {
+				return (isFlatPair<indices * 2>() && ...);
+			}
+
+			static constexpr bool entities{ tupleSize > 0 && allEntities(std::make_index_sequence<tupleSize>{}) };
+			static constexpr bool pairs{ tupleSize > 0 && !entities && allPairs(std::make_index_sequence<tupleSize>{}) };
+			static constexpr bool flat{ tupleSize > 0 && tupleSize % 2 == 0 && !entities && !pairs && allFlatPairs(std::make_index_sequence<tupleSize / 2>{}) };
+			static constexpr bool present{ entities || pairs || flat };
+			static constexpr uint64_t memberCount{ flat ? tupleSize / 2 : tupleSize };
+
+			/// @brief Collects the key of one of the type's members.
+			template<uint64_t index> DCA_INLINE static constexpr jsonifier::string_view getKey() {
+				if constexpr (entities) {
+					return getEtfKey(getElement<index>().name);
+				} else if constexpr (pairs) {
+					using std::get;
+					return getEtfKey(get<0>(getElement<index>()));
+				} else {
+					return getEtfKey(getElement<index * 2>());
+				}
+			}
+
+			/// @brief Collects the member pointer of one of the type's members.
+			template<uint64_t index> DCA_INLINE static constexpr auto getMemberPtr() {
+				if constexpr (entities) {
+					return getElement<index>().memberPtr;
+				} else if constexpr (pairs) {
+					using std::get;
+					return get<1>(getElement<index>());
+				} else {
+					return getElement<index * 2 + 1>();
+				}
+			}
+		};
+
+		/// @brief Concept for types whose jsonifier::core metadata etf_reader can walk member by member.
+		template<typename value_type>
+		concept etf_object_t = etf_core_members<std::remove_cvref_t<value_type>>::present;
+
+		/// @brief Reads etf terms straight into the structures described by their jsonifier::core metadata, without transcoding them to json.
+		/// @details map keys are matched against the keys given to createValue, and each member is read according to its type. a term that the
+		/// reader has no native path for, such as a type with no recognised metadata, is transcoded to json on its own and parsed by jsonifier.
+		class etf_reader : public etf_parser {
+		  public:
+			/// @brief Parse an etf term, which begins with the format version, into a value.
+			/// @tparam value_type the type of the value.
+			/// @param parserNew the jsonifier_core to parse any terms without a native path with.
+			/// @param value the value to be filled.
+			/// @param dataToParse the etf data to be parsed.
+			template<typename value_type> DCA_INLINE void parseEtf(jsonifier::jsonifier_core<false>& parserNew, value_type& value, jsonifier::string_view_base<uint8_t> dataToParse) {
+				dataBuffer = dataToParse.data();
+				dataSize   = dataToParse.size();
+				offSet	   = 0;
+				jsonParser = &parserNew;
+				if (readBitsFromBuffer<uint8_t>() != formatVersion) {
+					throw etf_parse_error{ "etf_reader::parseEtf() error: incorrect format version specified." };
+				}
+				readValue(value);
+			}
+
+		  protected:
+			jsonifier::jsonifier_core<false>* jsonParser{};
+
+			/// @brief Peek at the type of the next term.
+			DCA_INLINE etf_type peekType() {
+				if (offSet >= dataSize) {
+					throw etf_parse_error{ "etf_reader::peekType() error: read past end of buffer." };
+				}
+				return static_cast<etf_type>(dataBuffer[offSet]);
+			}
+
+			/// @brief Check whether the next term is an atom, without consuming it.
+			DCA_INLINE bool isAtom() {
+				auto type = peekType();
+				return type == etf_type::Small_Atom_Ext || type == etf_type::Atom_Ext;
+			}
+
+			/// @brief Consume the next term if it is a nil or null atom.
+			/// @return whether or not a nil or null atom was consumed.
+			DCA_INLINE bool readNil() {
+				if (!isAtom()) {
+					return false;
+				}
+				auto offSetOld = offSet;
+				auto atom	   = readStringFromBuffer();
+				if (atom == "nil" || atom == "null") {
+					return true;
+				}
+				offSet = offSetOld;
+				return false;
+			}
+
+			/// @brief Read an unsigned decimal number out of a string term.
+			DCA_INLINE static uint64_t parseDigits(jsonifier::string_view digits) {
+				uint64_t returnValue{};
+				for (auto value: digits) {
+					if (value < '0' || value > '9') {
+						break;
+					}
+					returnValue = returnValue * 10 + static_cast<uint64_t>(value - '0');
+				}
+				return returnValue;
+			}
+
+			/// @brief Read a numeric term, of any of the integer or float encodings.
+			/// @param value the value to store the number in.
+			/// @return whether or not a number was read.
+			template<typename value_type> DCA_INLINE bool readNumber(value_type& value) {
+				if (peekType() == etf_type::New_Float_Ext) {
+					skipBytes(1);
+					uint64_t bits = readBitsFromBuffer<uint64_t>();
+					double newDouble{};
+					std::memcpy(&newDouble, &bits, sizeof(double));
+					value = static_cast<value_type>(newDouble);
+					return true;
+				}
+				int64_t valueNew{};
+				if (readIntegerFromBuffer(valueNew)) {
+					value = static_cast<value_type>(valueNew);
+					return true;
+				}
+				return false;
+			}
+
+			/// @brief Read a single term into a value, according to the value's type.
+			/// @tparam value_type the type of the value.
+			/// @param value the value to be filled.
+			template<typename value_type> DCA_INLINE void readValue(value_type& value) {
+				using type = std::remove_cvref_t<value_type>;
+				if constexpr (std::same_as<type, snowflake>) {
+					if (readNil()) {
+						return;
+					} else if (isAtom() || peekType() == etf_type::Binary_Ext || peekType() == etf_type::String_Ext) {
+						value = parseDigits(readStringFromBuffer());
+					} else {
+						uint64_t valueNew{};
+						if (readNumber(valueNew)) {
+							value = valueNew;
+						}
+					}
+				} else if constexpr (std::same_as<type, time_stamp>) {
+					if (readNil()) {
+						return;
+					} else if (peekType() == etf_type::Binary_Ext || peekType() == etf_type::String_Ext) {
+						value = readStringFromBuffer();
+					} else {
+						uint64_t valueNew{};
+						if (readNumber(valueNew)) {
+							value = valueNew;
+						}
+					}
+				} else if constexpr (jsonifier::concepts::bool_t<type>) {
+					if (readNil()) {
+						return;
+					} else if (isAtom()) {
+						value = readStringFromBuffer() == "true";
+					} else {
+						skipValue();
+					}
+				} else if constexpr (jsonifier::concepts::enum_t<type>) {
+					int64_t valueNew{};
+					if (readNumber(valueNew)) {
+						value = static_cast<type>(valueNew);
+					}
+				} else if constexpr (jsonifier::concepts::integer_t<type> || jsonifier::concepts::float_t<type>) {
+					if (peekType() == etf_type::Binary_Ext) {
+						skipValue();
+					} else {
+						readNumber(value);
+					}
+				} else if constexpr (jsonifier::concepts::string_t<type>) {
+					if (readNil()) {
+						return;
+					}
+					value = type{ readStringFromBuffer() };
+				} else if constexpr (etf_optional_t<type>) {
+					if (readNil()) {
+						value.reset();
+					} else {
+						readValue(value.emplace());
+					}
+				} else if constexpr (jsonifier::concepts::unique_ptr_t<type>) {
+					if (readNil()) {
+						return;
+					}
+					if (!value) {
+						value.reset(new typename type::element_type{});
+					}
+					readValue(*value);
+				} else if constexpr (etf_object_t<type>) {
+					readObject(value);
+				} else if constexpr (array_t<type>) {
+					readArray(value);
+				} else {
+					readAsJson(value);
+				}
+			}
+
+			/// @brief Read a map term into a type with jsonifier::core metadata.
+			template<typename value_type> DCA_INLINE void readObject(value_type& value) {
+				if (peekType() != etf_type::Map_Ext) {
+					return skipValue();
+				}
+				skipBytes(1);
+				uint32_t length = readBitsFromBuffer<uint32_t>();
+				for (uint32_t x = 0; x < length; ++x) {
+					auto key = readStringFromBuffer();
+					if (!readMember(value, key, std::make_index_sequence<etf_core_members<value_type>::memberCount>{})) {
+						skipValue();
+					}
+				}
+			}
+
+			/// @brief Read the current term into whichever member a key refers to.
+			/// @return whether or not any member had the key.
+			template<typename value_type, uint64_t... indices>
+			DCA_INLINE bool readMember(value_type& value, jsonifier::string_view key, std::index_sequence<indices...>) {
+				return (readMemberIf<value_type, indices>(value, key) || ...);
+			}
+
+			template<typename value_type, uint64_t index> DCA_INLINE bool readMemberIf(value_type& value, jsonifier::string_view key) {
+				static constexpr jsonifier::string_view memberKey{ etf_core_members<value_type>::template getKey<index>() };
+				if (key.size() == memberKey.size() && key == memberKey) {
+					readValue(value.*(etf_core_members<value_type>::template getMemberPtr<index>()));
+					return true;
+				}
+				return false;
+			}
+
+			/// @brief Read a list term into a resizable array.
+			template<typename value_type> DCA_INLINE void readArray(value_type& value) {
+				switch (peekType()) {
+					case etf_type::Nil_Ext: {
+						skipBytes(1);
+						value.clear();
+						return;
+					}
+					case etf_type::List_Ext: {
+						skipBytes(1);
+						uint32_t length = readBitsFromBuffer<uint32_t>();
+						value.resize(length);
+						for (uint32_t x = 0; x < length; ++x) {
+							readValue(value[x]);
+						}
+						return skipValue();
+					}
+					case etf_type::String_Ext: {
+						if constexpr (jsonifier::concepts::integer_t<typename std::remove_cvref_t<value_type>::value_type>) {
+							skipBytes(1);
+							uint16_t length = readBitsFromBuffer<uint16_t>();
+							value.resize(length);
+							for (uint16_t x = 0; x < length; ++x) {
+								value[x] = static_cast<typename std::remove_cvref_t<value_type>::value_type>(readBitsFromBuffer<uint8_t>());
+							}
+							return;
+						}
+						[[fallthrough]];
+					}
+					default: {
+						return skipValue();
+					}
+				}
+			}
+
+			/// @brief Transcode the current term alone to json, and hand it to jsonifier.
+			template<typename value_type> DCA_INLINE void readAsJson(value_type& value) {
+				currentSize = 0;
+				singleValueETFToJson();
+				jsonParser->parseJson<jsonifier::parse_options{ .partialRead = true }>(value, jsonifier::string_view_base<uint8_t>{ finalString.data(), currentSize });
+				if (auto result = jsonParser->getErrors(); result.size() > 0) {
+					for (auto& valueNew: result) {
+						message_printer::printError<print_message_type::general>(valueNew.reportError());
+					}
+				}
+			}
+		};
+
 		/**@}*/
 
 	};
 
 	DCA_INLINE thread_local discord_core_internal::etf_parser etfParser{};
+	DCA_INLINE thread_local discord_core_internal::etf_reader etfReader{};
+
+	namespace discord_core_internal {
+
+		/// @brief Parse a gateway payload into a value, reading etf directly when the payload starts with the etf format version.
+		/// @tparam value_type the type of the value.
+		/// @param parserNew the jsonifier_core to parse json payloads with.
+		/// @param value the value to be filled.
+		/// @param dataToParse the payload, either json or an etf term as returned by etf_parser::parseEtfDataTerm().
+		template<typename value_type> DCA_INLINE void parseGatewayData(jsonifier::jsonifier_core<false>& parserNew, value_type& value, jsonifier::string_view_base<uint8_t> dataToParse) {
+			if (dataToParse.size() > 0 && dataToParse[0] == formatVersion) {
+				try {
+					etfReader.parseEtf(parserNew, value, dataToParse);
+				} catch (const etf_parse_error& error) {
+					message_printer::printError<print_message_type::general>(error.what());
+				}
+				return;
+			}
+			parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(value, dataToParse);
+			if (auto result = parserNew.getErrors(); result.size() > 0) {
+				for (auto& valueNew: result) {
+					message_printer::printError<print_message_type::general>(valueNew.reportError());
+				}
+			}
+		}
+	}
 }// namespace discord_core_internal
\ No newline at end of file
@@ -88,6 +88,10 @@ namespace discord_core_api {
 
 		snowflake idOne{};
 		snowflake idTwo{};
+
+		DCA_INLINE bool operator==(const two_id_key& other) const {
+			return idOne == other.idOne && idTwo == other.idTwo;
+		}
 	};
 
 	template<typename value_type> struct key_hasher;
@@ -30,6 +30,11 @@
 #pragma once
 
 #include <discordcoreapi/Utilities/RateLimitQueue.hpp>
+#include <charconv>
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <tuple>
 
 namespace discord_core_api {
 
@@ -92,29 +97,83 @@ namespace discord_core_api {
 		};
 
 		class https_connection_manager;
+		class https_io_reactor;
+		class https_client;
 		struct rate_limit_data;
 
 		enum class https_state { Collecting_Headers = 0, Collecting_Contents = 1, Collecting_Chunked_Contents = 2, complete = 3 };
 
+		enum class https_chunk_state { Size_Line = 0, Data = 1, Data_Terminator = 2, Trailers = 3 };
+
 		class https_error : public dca_exception {
 		  public:
 			https_response_code errorCode{};
 			DCA_INLINE https_error(const jsonifier::string_view& message, std::source_location location = std::source_location::current()) : dca_exception{ message, location } {};
 		};
 
+		/// @brief The headers of an https response, held as offsets into the received header block rather than as copied strings.
+		class https_response_headers {
+		  public:
+			friend class https_rnr_builder;
+			friend class https_connection;
+
+			/// @brief The position of a single header within the header block.
+			struct header_offsets {
+				uint32_t valueOffset{};
+				uint32_t valueLength{};
+				uint32_t keyOffset{};
+				uint32_t keyLength{};
+			};
+
+			/// @brief Checks for a header.
+			/// @param key the lower-case name of the header.
+			/// @return `true` if the response carried the header, `false` otherwise.
+			DCA_INLINE bool contains(jsonifier::string_view key) const {
+				return findHeader(key) != nullptr;
+			}
+
+			/// @brief Collects the value of a header.
+			/// @param key the lower-case name of the header.
+			/// @return a view of the header's value, which remains valid for as long as this object does.
+			/// @throws dca_exception if the response did not carry the header.
+			DCA_INLINE jsonifier::string_view at(jsonifier::string_view key) const {
+				if (auto header = findHeader(key)) {
+					return jsonifier::string_view{ headerBlock.data() + header->valueOffset, header->valueLength };
+				}
+				throw dca_exception{ "Sorry, but that header was not found in the response." };
+			}
+
+		  protected:
+			jsonifier::vector<header_offsets> headers{};
+			jsonifier::string headerBlock{};///< The raw status line and headers, with each header name lower-cased in place.
+
+			DCA_INLINE const header_offsets* findHeader(jsonifier::string_view key) const {
+				for (auto& value: headers) {
+					if (jsonifier::string_view{ headerBlock.data() + value.keyOffset, value.keyLength } == key) {
+						return &value;
+					}
+				}
+				return nullptr;
+			}
+		};
+
 		struct DiscordCoreAPI_Dll https_response_data {
 			friend class https_rnr_builder;
 			friend class https_connection;
 			friend class https_client;
 
 			https_response_code responseCode{ std::numeric_limits<uint32_t>::max() };
-			unordered_map<jsonifier::string, jsonifier::string> responseHeaders{};
 			https_state currentState{ https_state::Collecting_Headers };
+			https_response_headers responseHeaders{};
 			jsonifier::string responseData{};
 			uint64_t contentLength{};
 
 		  protected:
-			bool isItChunked{};
+			https_chunk_state chunkState{ https_chunk_state::Size_Line };
+			uint64_t chunkWriteOffset{};///< The end of the de-chunked body, at the front of responseData.
+			uint64_t chunkReadOffset{};///< The position in responseData of the next raw byte to be de-chunked.
+			uint64_t headerScanOffset{};///< The position in the header block to resume searching for its end from.
+			uint64_t chunkRemaining{};///< The bytes of the current chunk which are yet to be de-chunked.
 		};
 
 		class DiscordCoreAPI_Dll https_rnr_builder {
@@ -125,7 +184,11 @@ namespace discord_core_api {
 
 			https_response_data finalizeReturnValues(rate_limit_data& rateLimitData);
 
-			jsonifier::string buildRequest(const https_workload_data& workload);
+			/// @brief Serializes a request into this connection's request buffer.
+			/// @param workload the workload to be serialized.
+			/// @param precomputedHeaders header lines, each terminated by "\r\n", to be written ahead of the workload's own.
+			/// @return a view of the serialized request, which remains valid until the next call.
+			jsonifier::string_view buildRequest(const https_workload_data& workload, jsonifier::string_view precomputedHeaders = {});
 
 			void updateRateLimitData(rate_limit_data& rateLimitData);
 
@@ -134,6 +197,8 @@ namespace discord_core_api {
 			virtual ~https_rnr_builder() = default;
 
 		  protected:
+			jsonifier::string requestBuffer{};///< Reused by every request made on this connection, so that its capacity carries over.
+
 			bool parseContents();
 
 			bool parseChunk();
@@ -145,7 +210,6 @@ namespace discord_core_api {
 
 			rate_limit_data* currentRateLimitData{};
 			const int32_t maxReconnectTries{ 3 };
-			jsonifier::string inputBufferReal{};
 			jsonifier::string currentBaseUrl{};
 			int32_t currentReconnectTries{};
 			https_workload_data workload{};
@@ -166,37 +230,275 @@ namespace discord_core_api {
 			virtual ~https_connection() = default;
 		};
 
+		/// @brief A lock-free histogram of request latencies, bucketed by powers of two of microseconds.
+		class latency_histogram {
+		  public:
+			static constexpr uint64_t bucketCount{ 32 };
+
+			/// @brief A copy of the histogram's counters at one point in time.
+			struct snapshot {
+				std::array<uint64_t, bucketCount> counts{};///< The number of latencies in [2^n, 2^(n+1)) microseconds, for each bucket n.
+				nanoseconds totalLatency{};
+				uint64_t count{};
+
+				/// @brief Estimates a latency percentile, as the upper bound of the bucket it falls in.
+				/// @param percentile the percentile to estimate, between 0 and 100.
+				/// @return the estimated latency.
+				DCA_INLINE microseconds getPercentile(double percentile) const {
+					auto targetCount = static_cast<uint64_t>(std::ceil(static_cast<double>(count) * percentile / 100.0));
+					uint64_t currentCount{};
+					for (uint64_t x = 0; x < bucketCount; ++x) {
+						currentCount += counts[x];
+						if (currentCount >= targetCount && currentCount > 0) {
+							return microseconds{ 2ll << x };
+						}
+					}
+					return microseconds{};
+				}
+			};
+
+			DCA_INLINE void record(nanoseconds latency) {
+				auto latencyInUs = static_cast<uint64_t>(std::max<int64_t>(std::chrono::duration_cast<microseconds>(latency).count(), 1));
+				buckets[std::min<uint64_t>(static_cast<uint64_t>(std::bit_width(latencyInUs)) - 1, bucketCount - 1)].fetch_add(1, std::memory_order_relaxed);
+				totalLatency.fetch_add(latency.count(), std::memory_order_relaxed);
+				count.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			DCA_INLINE snapshot getSnapshot() const {
+				snapshot returnValue{};
+				for (uint64_t x = 0; x < bucketCount; ++x) {
+					returnValue.counts[x] = buckets[x].load(std::memory_order_relaxed);
+				}
+				returnValue.totalLatency = nanoseconds{ totalLatency.load(std::memory_order_relaxed) };
+				returnValue.count		 = count.load(std::memory_order_relaxed);
+				return returnValue;
+			}
+
+		  protected:
+			std::array<std::atomic_uint64_t, bucketCount> buckets{};
+			std::atomic_int64_t totalLatency{};
+			std::atomic_uint64_t count{};
+		};
+
+		static constexpr uint64_t httpsLaneCount{ 3 };
+
 		/// @class https_connection_manager.
-		/// @brief For managing the collection of Https connections.
+		/// @brief For managing the pool of keep-alive Https connections, which are leased out one per request, serving the higher priority lanes first.
 		class DiscordCoreAPI_Dll https_connection_manager {
 		  public:
+			friend class https_io_reactor;
 			friend class https_client;
 
+			static constexpr uint64_t maxConnectionCount{ 16 };
+			static constexpr uint64_t maxBackgroundConnectionCount{ 12 };///< Leaves some connections free for the higher lanes, however much background work is queued.
+
 			https_connection_manager() = default;
 
 			https_connection_manager(rate_limit_queue*);
 
-			https_connection& getConnection(https_workload_type workloadType);
+			/// @brief Leases a connection from the pool, preferring an idle one which was last used for the same base url.
+			/// @details waits while any higher lane has requests queued, so that queued background work is overtaken by anything more urgent.
+			/// @param baseUrl the base url of the upcoming request.
+			/// @param priority the priority lane of the upcoming request.
+			/// @return the leased connection, which must be handed back through releaseConnection().
+			unique_ptr<https_connection> leaseConnection(jsonifier::string_view baseUrl, https_workload_priority priority);
+
+			/// @brief Leases a connection from the pool without waiting, for requests driven by the io reactor.
+			/// @details a request which cannot be served yet stays counted as waiting in its lane, so that the lower lanes still yield to it, and is
+			/// retried by the reactor once a connection is handed back.
+			/// @param baseUrl the base url of the upcoming request.
+			/// @param priority the priority lane of the upcoming request.
+			/// @param isWaiting whether the request is already counted as waiting, which is updated to match the result.
+			/// @return the leased connection, or an empty pointer if there is none to spare yet.
+			unique_ptr<https_connection> tryLeaseConnection(jsonifier::string_view baseUrl, https_workload_priority priority, bool& isWaiting);
+
+			/// @brief Withdraws a request which was left waiting by tryLeaseConnection(), once it is abandoned.
+			/// @param priority the priority lane of the request.
+			void cancelLease(https_workload_priority priority);
+
+			/// @brief Hands a leased connection back to the pool, keeping it for reuse if it is still connected.
+			/// @param connection the connection to hand back.
+			/// @param priority the priority lane the connection was leased for.
+			void releaseConnection(unique_ptr<https_connection>&& connection, https_workload_priority priority);
+
+			/// @brief Records the latency of a request, from its submission to its response.
+			/// @param priority the priority lane of the request.
+			/// @param latency the latency of the request.
+			void recordLatency(https_workload_priority priority, nanoseconds latency);
 
 			rate_limit_queue& getRateLimitQueue();
 
 		  protected:
-			unordered_map<https_workload_type, unique_ptr<https_connection>> httpsConnections{};///< Collection of Https connections.
+			std::array<latency_histogram, httpsLaneCount> laneLatencies{};///< The request latencies of each priority lane.
+			std::vector<unique_ptr<https_connection>> idleConnections{};///< Connections which are not currently leased out.
+			std::array<uint64_t, httpsLaneCount> waitingRequestCounts{};///< The number of requests queued for a connection, in each lane.
+			std::array<uint64_t, httpsLaneCount> leasedConnectionCounts{};///< The number of connections currently leased out, to each lane.
+			std::condition_variable connectionReleased{};///< Signalled whenever a connection is handed back.
+			https_io_reactor* ioReactor{};///< Woken whenever a connection is handed back, so that its waiting requests retry their leases.
 			rate_limit_queue* rateLimitQueue{};
+			uint64_t leasedConnectionCount{};///< The number of connections currently leased out.
 			std::mutex accessMutex{};
+
+			bool canLease(uint64_t lane, https_workload_priority priority) const;
+
+			/// @brief Wakes the requests waiting for a connection, both blocked threads and those parked on the io reactor.
+			void notifyWaiters();
+
+			unique_ptr<https_connection> takeConnection(jsonifier::string_view baseUrl, uint64_t lane);
 		};
 
 		class DiscordCoreAPI_Dll https_connection_stack_holder {
 		  public:
-			https_connection_stack_holder(https_connection_manager& connectionManager, https_workload_data&& workload);
+			https_connection_stack_holder(https_connection_manager& connectionManagerNew, https_workload_data&& workload);
 
 			https_connection& getConnection();
 
 			~https_connection_stack_holder();
 
 		  protected:
-			rate_limit_queue* rateLimitQueue{};
-			https_connection* connection{};
+			https_connection_manager* connectionManager{};
+			unique_ptr<https_connection> connection{};
+			hrclock::time_point submissionTime{};
+			jsonifier::string majorParameter{};
+			https_workload_priority priority{};
+			https_workload_type workloadType{};
+			rate_limit_data* rateLimitData{};
+		};
+
+		/// @brief The stages a request made through https_client::submitWorkloadAsync() passes through on the io reactor.
+		enum class https_request_stage : uint8_t {
+			Acquiring_Endpoint		= 0,///< Waiting for its bucket to have quota, and an in-flight slot, to spare.
+			Leasing_Connection		= 1,///< Waiting for a pooled connection.
+			Waiting_On_Bucket		= 2,///< Waiting out its bucket's reset, once its connection is leased.
+			Waiting_On_Global_Limit = 3,///< Waiting for its token from the global rate limiter.
+			Connecting				= 4,///< Waiting on its connection's connect and handshake, or on the backoff before reconnecting.
+			In_Flight				= 5,///< Waiting on its request to be written and its response read.
+			Complete				= 6,///< Finished, whether or not it succeeded.
+		};
+
+		/// @class https_async_request.
+		/// @brief The state of a request made through https_client::submitWorkloadAsync(), which lives in the awaiting co_routine's frame while the io
+		/// reactor drives it.
+		class DiscordCoreAPI_Dll https_async_request {
+		  public:
+			template<typename... args> friend class https_workload_awaitable;
+			friend class https_io_reactor;
+			friend class https_client;
+
+			https_async_request(https_connection_manager& connectionManagerNew, https_workload_data&& workloadNew);
+
+			/// @brief Hands back whatever connection and bucket access the request still holds, and records its latency.
+			~https_async_request();
+
+		  protected:
+			std::chrono::steady_clock::time_point endpointDeadline{};///< When waiting on the bucket is abandoned.
+			https_connection_manager* connectionManager{};
+			unique_ptr<https_connection> connection{};
+			std::coroutine_handle<> waiter{};
+			hrclock::time_point submissionTime{};
+			jsonifier::string majorParameter{};
+			https_workload_priority priority{};
+			https_workload_type workloadType{};
+			https_request_stage stage{};
+			https_workload_data workload{};
+			rate_limit_data* rateLimitData{};
+			std::exception_ptr error{};///< Set if the request failed before it could be sent, to be rethrown from await_resume().
+			uint64_t timerGeneration{};///< Matches the request's one pending timer, so that timers it has since moved past are skipped.
+			SOCKET watchedSocket{ INVALID_SOCKET };///< The socket registered with the io thread's epoll instance, if any.
+			bool isWaitingForConnection{};
+			bool haveWeGainedAccess{};
+			bool hasGlobalToken{};
+			bool isConnecting{};
+			bool isSubmitted{};
+			bool isParked{};
+			uint32_t events{};///< The readiness events currently registered for the connection.
+		};
+
+		/// @class https_io_reactor.
+		/// @brief Drives the requests of the async Https path on a small set of I/O threads, so that hundreds of requests can be waiting on buckets,
+		/// connections or responses without holding a thread each. each awaiting co_routine is resumed on the thread pool once its request is
+		/// complete, or has failed.
+		class DiscordCoreAPI_Dll https_io_reactor {
+		  public:
+			static constexpr uint64_t ioThreadCount{ 2 };
+
+			https_io_reactor(https_client* clientNew);
+
+			/// @brief Hands a request to one of the I/O threads, which takes it from gaining its bucket through to its response.
+			/// @param request the request to drive.
+			/// @return `true` if the request was handed over, `false` if the reactor is unavailable and the caller must make the request itself.
+			bool submit(https_async_request& request);
+
+			/// @brief Wakes every I/O thread, so that the requests waiting on a connection or an in-flight slot retry straight away.
+			void wakeAll();
+
+			~https_io_reactor();
+
+		  protected:
+			struct request_timer {
+				std::chrono::steady_clock::time_point time{};
+				uint64_t generation{};
+				uint64_t key{};
+
+				DCA_INLINE bool operator>(const request_timer& other) const {
+					return time > other.time;
+				}
+			};
+
+			struct io_thread {
+				std::priority_queue<request_timer, std::vector<request_timer>, std::greater<request_timer>> timers{};///< Each request's pending timer, soonest first.
+				unordered_map<uint64_t, https_async_request*> liveRequests{};///< Every request being driven, keyed by its address.
+				std::vector<https_async_request*> pendingRequests{};///< Requests submitted since the I/O thread last picked them up.
+				std::vector<uint64_t> parkedRequests{};///< Requests waiting on a connection or an in-flight slot, retried whenever the thread is woken.
+				uint64_t currentGeneration{};
+#if defined(__linux__)
+				int32_t epollFd{ -1 };
+				int32_t wakeFd{ -1 };///< An eventfd, registered under key 0, which is signalled whenever a request is submitted or a connection is released.
+#else
+				std::condition_variable requestSubmitted{};
+				bool wasWoken{};
+#endif
+				std::mutex accessMutex{};
+				std::jthread thread{};
+			};
+
+			std::vector<unique_ptr<io_thread>> ioThreads{};
+			std::atomic_uint64_t nextThreadIndex{};
+			std::atomic_bool doWeQuit{};
+			https_client* client{};
+
+			void run(io_thread& ioThread);
+
+			void registerPendingRequests(io_thread& ioThread);
+
+			void retryParkedRequests(io_thread& ioThread);
+
+			/// @brief Fires the timers which are due.
+			/// @return the time until the next timer is due, or -1 if there is none.
+			int32_t fireTimers(io_thread& ioThread);
+
+			/// @brief Advances a request through as many stages as it can pass without waiting.
+			void advanceRequest(io_thread& ioThread, https_async_request& request);
+
+			/// @brief Services a request's connection for the readiness events it was polled with, then advances it.
+			void serviceRequest(io_thread& ioThread, https_async_request& request, uint32_t events);
+
+			void scheduleTimer(io_thread& ioThread, https_async_request& request, std::chrono::steady_clock::time_point time);
+
+			void parkRequest(io_thread& ioThread, https_async_request& request);
+
+			/// @brief Registers the request's connection for the readiness events of its current stage.
+			/// @return `false` if the connection could not be registered.
+			bool watchConnection(io_thread& ioThread, https_async_request& request);
+
+			void unwatchConnection(io_thread& ioThread, https_async_request& request);
+
+			/// @brief Reconnects after a lost connection, backing off first, or completes the request once its reconnect tries are spent.
+			void retryRequest(io_thread& ioThread, https_async_request& request);
+
+			void failRequest(io_thread& ioThread, https_async_request& request, jsonifier::string_view message);
+
+			void completeRequest(io_thread& ioThread, https_async_request& request);
 		};
 
 		class DiscordCoreAPI_Dll https_client_core {
@@ -230,15 +532,24 @@ namespace discord_core_api {
 			}
 
 		  protected:
-			jsonifier::string botToken{};
+			jsonifier::string jsonRequestHeaders{};///< The authorization, user-agent and content-type lines of every json request to discord.
+			jsonifier::string multipartRequestHeaders{};///< The authorization, user-agent and content-type lines of every multipart request to discord.
+			jsonifier::string discordRequestHeaders{};///< The authorization and user-agent lines of every other request to discord.
 
 			https_response_data httpsRequestInternal(https_connection& connection);
 
+			/// @brief Collects the header lines which every request of the workload's kind carries.
+			jsonifier::string_view getRequestHeaders(const https_workload_data& workload);
+
+			bool sendRequest(https_connection& connection);
+
 			https_response_data recoverFromError(https_connection& connection);
 
 			https_response_data getResponse(https_connection& connection);
 		};
 
+		template<typename... args> class https_workload_awaitable;
+
 		/**
 		 * \addtogroup discord_core_internal
 		 * @{
@@ -251,7 +562,7 @@ namespace discord_core_api {
 			https_client(jsonifier::string_view botTokenNew);
 
 			template<typename value_type, typename string_type> void getParseErrors(jsonifier::jsonifier_core<false>& parser, value_type& value, string_type& stringNew) {
-				parser.parseJson(value, parser.minifyJson(parser.prettifyJson(stringNew)));
+				parser.parseJson(value, stringNew);
 				if (auto result = parser.getErrors(); result.size() > 0) {
 					for (auto& valueNew: result) {
 						message_printer::printError<print_message_type::websocket>(valueNew.reportError());
@@ -259,22 +570,47 @@ namespace discord_core_api {
 				}
 			}
 
+			/// @brief Collects a snapshot of the global rate-limit and invalid-request counters.
+			/// @return rate_limit_metrics the current counters.
+			rate_limit_metrics getRateLimitMetrics() const;
+
+			/// @brief Collects a snapshot of the request latencies of each priority lane.
+			/// @return the latency histograms, indexed by https_workload_priority.
+			std::array<latency_histogram::snapshot, httpsLaneCount> getLaneLatencies() const;
+
 			template<typename workload_type, typename... args> void submitWorkloadAndGetResult(workload_type&& workload, args&... argsNew) {
 				https_connection_stack_holder stackHolder{ connectionManager, std::move(workload) };
 				https_response_data returnData = httpsRequest(stackHolder.getConnection());
+				handleResult(stackHolder.getConnection(), returnData, argsNew...);
+			}
+
+			/// @brief Submits a workload without blocking the calling thread for its round trip - co_await the result from within a co_routine.
+			/// @param workload the workload to submit.
+			/// @param argsNew the values to parse the response into.
+			/// @return an awaitable, which suspends the co_routine until the response has arrived.
+			template<typename... args> https_workload_awaitable<args...> submitWorkloadAsync(https_workload_data&& workload, args&... argsNew);
+
+		  protected:
+			template<typename... args> friend class https_workload_awaitable;
+			friend class https_io_reactor;
+
+			https_connection_manager connectionManager{};
+			rate_limit_queue rateLimitQueue{};
+			https_io_reactor ioReactor{ this };
+
+			template<typename... args> void handleResult(https_connection& connection, https_response_data& returnData, args&... argsNew) {
 				if (static_cast<uint32_t>(returnData.responseCode) != 200 && static_cast<uint32_t>(returnData.responseCode) != 204 &&
 					static_cast<uint32_t>(returnData.responseCode) != 201) {
 					jsonifier::string errorMessage{};
-					if (stackHolder.getConnection().workload.callStack != "") {
-						errorMessage += stackHolder.getConnection().workload.callStack + " ";
+					if (connection.workload.callStack != "") {
+						errorMessage += connection.workload.callStack + " ";
 					}
-					errorMessage +=
-						"Https error: " + returnData.responseCode.operator jsonifier::string() + "\nThe request: base url: " + stackHolder.getConnection().workload.baseUrl + "\n";
-					if (!stackHolder.getConnection().workload.relativePath.empty()) {
-						errorMessage += "Relative Url: " + stackHolder.getConnection().workload.relativePath + "\n";
+					errorMessage += "Https error: " + returnData.responseCode.operator jsonifier::string() + "\nThe request: base url: " + connection.workload.baseUrl + "\n";
+					if (!connection.workload.relativePath.empty()) {
+						errorMessage += "Relative Url: " + connection.workload.relativePath + "\n";
 					}
-					if (!stackHolder.getConnection().workload.content.empty()) {
-						errorMessage += "Content: " + stackHolder.getConnection().workload.content + "\n";
+					if (!connection.workload.content.empty()) {
+						errorMessage += "Content: " + connection.workload.content + "\n";
 					}
 					if (!returnData.responseData.empty()) {
 						errorMessage += "The Response: " + static_cast<jsonifier::string>(returnData.responseData);
@@ -290,15 +626,76 @@ namespace discord_core_api {
 				}
 			}
 
-		  protected:
-			https_connection_manager connectionManager{};
-			rate_limit_queue rateLimitQueue{};
+			/// @brief Hands a request to the reactor, which waits out its bucket, connection and rate limits, then sends it and collects its response.
+			/// @return `true` if the co_routine was suspended, `false` if it should resume straight away - having failed, or to make the request itself.
+			bool beginAsyncRequest(https_async_request& request, std::coroutine_handle<> waiter);
+
+			https_response_data completeAsyncRequest(https_async_request& request);
+
+			/// @brief Collects how long a request must wait on its bucket before it is sent, updating the bucket's wait flags as it goes.
+			/// @return the time to wait, which is not positive if the request may be sent straight away.
+			milliseconds getRateLimitDelay(https_connection& connection);
+
+			void waitOnRateLimits(https_connection& connection);
+
+			/// @brief Accounts for a response against the invalid-request budget and its bucket.
+			/// @return `true` if the response was a 429, and the request is to be sent again once its bucket allows.
+			bool recordResponse(https_connection& connection, https_response_data& returnData);
+
+			https_response_data processResponse(https_connection& connection, https_response_data&& returnData);
 
 			https_response_data executeByRateLimitData(https_connection& connection);
 
 			https_response_data httpsRequest(https_connection& connection);
 		};
 
+		/// @brief The awaitable returned by https_client::submitWorkloadAsync().
+		/// @tparam args the types of the values to parse the response into.
+		template<typename... args> class https_workload_awaitable {
+		  public:
+			DCA_INLINE https_workload_awaitable(https_client& clientNew, https_workload_data&& workloadNew, args&... argsNew)
+				: request{ clientNew.connectionManager, std::move(workloadNew) }, argValues{ argsNew... }, client{ &clientNew } {};
+
+			DCA_INLINE bool await_ready() const {
+				return false;
+			}
+
+			DCA_INLINE bool await_suspend(std::coroutine_handle<> waiter) {
+				return client->beginAsyncRequest(request, waiter);
+			}
+
+			DCA_INLINE void await_resume() {
+				if (request.error) {
+					std::rethrow_exception(request.error);
+				}
+				if (!request.isSubmitted) {
+					https_connection_stack_holder stackHolder{ client->connectionManager, std::move(request.workload) };
+					https_response_data returnData = client->httpsRequest(stackHolder.getConnection());
+					std::apply(
+						[&](auto&... argsNew) {
+							client->handleResult(stackHolder.getConnection(), returnData, argsNew...);
+						},
+						argValues);
+					return;
+				}
+				https_response_data returnData = client->completeAsyncRequest(request);
+				std::apply(
+					[&](auto&... argsNew) {
+						client->handleResult(*request.connection, returnData, argsNew...);
+					},
+					argValues);
+			}
+
+		  protected:
+			https_async_request request;
+			std::tuple<args&...> argValues;
+			https_client* client{};
+		};
+
+		template<typename... args> DCA_INLINE https_workload_awaitable<args...> https_client::submitWorkloadAsync(https_workload_data&& workload, args&... argsNew) {
+			return https_workload_awaitable<args...>{ *this, std::move(workload), argsNew... };
+		}
+
 		/**@}*/
 
 	}// namespace discord_core_internal
@@ -35,26 +35,87 @@
 
 namespace discord_core_api {
 
-	/// @brief A template class representing an object cache.
+	/// @brief A template class representing an object cache, split into independently locked shards.
 	/// @tparam value_type the type of values stored in the cache.
-	template<typename value_type> class object_cache {
+	/// @tparam shard_count the number of shards to split the cache into, must be a power of two.
+	template<typename value_type, uint64_t shard_count = 16> class object_cache {
 	  public:
 		using mapped_type	  = value_type;
 		using reference		  = mapped_type&;
 		using const_reference = const mapped_type&;
 		using pointer		  = mapped_type*;
+		using map_type		  = unordered_set<unique_ptr<mapped_type>>;
+
+		static_assert(shard_count > 0 && (shard_count & (shard_count - 1)) == 0, "Sorry, but the shard count must be a power of two.");
+
+		/// @brief A single shard of the cache, with its own table and lock.
+		struct alignas(64) cache_shard {
+			map_type cacheMap{};///< The underlying container for storing this shard's objects.
+			std::shared_mutex cacheMutex{};///< Mutex for ensuring thread-safe access to this shard.
+		};
+
+		/// @brief An iterator over every shard of the cache.
+		class iterator {
+		  public:
+			using iterator_category = std::forward_iterator_tag;
+			using reference			= typename map_type::reference;
+			using pointer			= typename map_type::pointer;
+
+			DCA_INLINE iterator() = default;
+
+			DCA_INLINE iterator(object_cache* cacheNew, uint64_t shardIndexNew) : cache{ cacheNew }, shardIndex{ shardIndexNew } {
+				if (shardIndex < shard_count) {
+					current = cache->shards[shardIndex].cacheMap.begin();
+					skipEmptyShards();
+				}
+			}
+
+			DCA_INLINE iterator& operator++() {
+				++current;
+				skipEmptyShards();
+				return *this;
+			}
+
+			DCA_INLINE bool operator==(const iterator& other) const {
+				return shardIndex == other.shardIndex && (shardIndex >= shard_count || current == other.current);
+			}
+
+			DCA_INLINE pointer operator->() {
+				return current.operator->();
+			}
+
+			DCA_INLINE reference operator*() {
+				return *current;
+			}
+
+		  protected:
+			typename map_type::iterator current{};
+			object_cache* cache{};
+			uint64_t shardIndex{ shard_count };
+
+			DCA_INLINE void skipEmptyShards() {
+				while (current == cache->shards[shardIndex].cacheMap.end()) {
+					if (++shardIndex >= shard_count) {
+						return;
+					}
+					current = cache->shards[shardIndex].cacheMap.begin();
+				}
+			}
+		};
 
 		/// @brief Default constructor for the object_cache class.
-		DCA_INLINE object_cache() : cacheMap{} {};
+		DCA_INLINE object_cache() : shards{} {};
 
 		/// @brief Move assignment operator for the object_cache class.
 		/// @param other another object_cache instance to be moved.
 		/// @return reference to the current object_cache instance.
 		DCA_INLINE object_cache& operator=(object_cache&& other) noexcept {
 			if (this != &other) {
-				std::unique_lock lock01{ other.cacheMutex };
-				std::unique_lock lock02{ cacheMutex };
-				std::swap(cacheMap, other.cacheMap);
+				for (uint64_t x = 0; x < shard_count; ++x) {
+					std::unique_lock lock01{ other.shards[x].cacheMutex };
+					std::unique_lock lock02{ shards[x].cacheMutex };
+					std::swap(shards[x].cacheMap, other.shards[x].cacheMap);
+				}
 			}
 			return *this;
 		}
@@ -68,22 +129,84 @@ namespace discord_core_api {
 		/// @brief Add an object to the cache.
 		/// @tparam mapped_type_new the type of the object to be added.
 		/// @param object the object to be added to the cache.
-		/// @return an iterator pointing to the newly added object in the cache.
+		/// @return an iterator pointing to the newly added object in its shard.
 		template<typename mapped_type_new> DCA_INLINE auto emplace(mapped_type_new&& object) {
-			std::unique_lock lock(cacheMutex);
-			return cacheMap.emplace(makeUnique<std::remove_cvref_t<mapped_type_new>>(std::forward<mapped_type_new>(object)));
+			auto newValue = makeUnique<std::remove_cvref_t<mapped_type_new>>(std::forward<mapped_type_new>(object));
+			auto& shard	  = getShard(newValue);
+			std::unique_lock lock(shard.cacheMutex);
+			return shard.cacheMap.emplace(std::move(newValue));
 		}
 
-		/// @brief Access an object in the cache using a key.
+		/// @brief Access an object in the cache using a key, inserting a default object if none exists.
+		/// @details the inserted object carries the key when it is an id or a guild/user id pair, so that later lookups by the same key find it.
+		/// for any other key, a default object is inserted under its own key, as it always has been.
 		/// @tparam mapped_type_new the type of the key used for access.
 		/// @param key the key used for accessing the object in the cache.
 		/// @return reference to the object associated with the provided key.
 		template<typename mapped_type_new> DCA_INLINE reference operator[](mapped_type_new&& key) {
-			std::shared_lock lock(cacheMutex);
-			if (!cacheMap.contains(key)) {
-				cacheMap.emplace(makeUnique<mapped_type>());
+			auto& shard = getShard(key);
+			{
+				std::shared_lock lock(shard.cacheMutex);
+				if (auto iter = shard.cacheMap.find(key); iter != shard.cacheMap.end()) {
+					return **iter;
+				}
+			}
+			std::unique_lock lock(shard.cacheMutex);
+			if (auto iter = shard.cacheMap.find(key); iter != shard.cacheMap.end()) {
+				return **iter;
+			}
+			static constexpr bool isTwoIdKey{ std::same_as<std::remove_cvref_t<mapped_type_new>, two_id_key> };
+			if constexpr (has_id<mapped_type> && std::is_convertible_v<std::remove_cvref_t<mapped_type_new>, snowflake>) {
+				auto newValue = makeUnique<mapped_type>();
+				newValue->id  = key;
+				return **shard.cacheMap.emplace(std::move(newValue));
+			} else if constexpr (guild_member_t<mapped_type> && isTwoIdKey) {
+				auto newValue	  = makeUnique<mapped_type>();
+				newValue->guildId = key.idOne;
+				newValue->user.id = key.idTwo;
+				return **shard.cacheMap.emplace(std::move(newValue));
+			} else if constexpr (voice_state_t<mapped_type> && isTwoIdKey) {
+				auto newValue	  = makeUnique<mapped_type>();
+				newValue->guildId = key.idOne;
+				newValue->userId  = key.idTwo;
+				return **shard.cacheMap.emplace(std::move(newValue));
+			} else {
+				// the default object may belong to another shard, so it is inserted through emplace, under that shard's lock.
+				lock.unlock();
+				return **emplace(mapped_type{});
+			}
+		}
+
+		/// @brief Read an object in the cache in place, under its shard's shared lock.
+		/// @tparam mapped_type_new the type of the key used for access.
+		/// @tparam function_type the type of the function to invoke.
+		/// @param key the key of the object to be read.
+		/// @param function the function to invoke, which receives a const reference to the object.
+		/// @return `true` if an object was read, `false` if no object with that key exists.
+		template<typename mapped_type_new, typename function_type> DCA_INLINE bool visit(mapped_type_new&& key, function_type&& function) {
+			auto& shard = getShard(key);
+			std::shared_lock lock(shard.cacheMutex);
+			if (auto iter = shard.cacheMap.find(key); iter != shard.cacheMap.end()) {
+				std::forward<function_type>(function)(static_cast<const_reference>(**iter));
+				return true;
+			}
+			return false;
+		}
+
+		/// @brief Modify an object in the cache in place, under its shard's exclusive lock.
+		/// @tparam mapped_type_new the type of the key used for access.
+		/// @tparam function_type the type of the function to apply.
+		/// @param key the key of the object to be modified.
+		/// @param function the function to apply to the object.
+		/// @return `true` if an object was modified, `false` if no object with that key exists.
+		template<typename mapped_type_new, typename function_type> DCA_INLINE bool modify(mapped_type_new&& key, function_type&& function) {
+			auto& shard = getShard(key);
+			std::unique_lock lock(shard.cacheMutex);
+			if (auto iter = shard.cacheMap.find(key); iter != shard.cacheMap.end()) {
+				std::forward<function_type>(function)(**iter);
+				return true;
 			}
-			return *cacheMap.operator[](key);
+			return false;
 		}
 
 		/// @brief Check if the cache contains an object with a given key.
@@ -91,44 +214,62 @@ namespace discord_core_api {
 		/// @param key the key to check for existence in the cache.
 		/// @return `true` if the cache contains the key, `false` otherwise.
 		template<typename mapped_type_new> DCA_INLINE bool contains(mapped_type_new&& key) {
-			std::shared_lock lock(cacheMutex);
-			return cacheMap.contains(std::forward<mapped_type_new>(key));
+			auto& shard = getShard(key);
+			std::shared_lock lock(shard.cacheMutex);
+			return shard.cacheMap.contains(std::forward<mapped_type_new>(key));
 		}
 
 		/// @brief Remove an object from the cache using a key.
 		/// @tparam mapped_type_new the type of the key used for removal.
 		/// @param key the key used to remove the object from the cache.
 		template<typename mapped_type_new> DCA_INLINE void erase(mapped_type_new&& key) {
-			std::unique_lock lock(cacheMutex);
-			cacheMap.erase(std::forward<mapped_type_new>(key));
+			auto& shard = getShard(key);
+			std::unique_lock lock(shard.cacheMutex);
+			shard.cacheMap.erase(std::forward<mapped_type_new>(key));
 		}
 
 		/// @brief Get the number of objects currently in the cache.
 		/// @return the number of objects in the cache.
 		DCA_INLINE uint64_t count() {
-			std::shared_lock lock(cacheMutex);
-			return cacheMap.size();
+			uint64_t returnValue{};
+			for (auto& shard: shards) {
+				std::shared_lock lock(shard.cacheMutex);
+				returnValue += shard.cacheMap.size();
+			}
+			return returnValue;
 		}
 
 		/// @brief Get an iterator to the beginning of the cache.
 		/// @return an iterator to the beginning of the cache.
-		DCA_INLINE auto begin() {
-			return cacheMap.begin();
+		DCA_INLINE iterator begin() {
+			return { this, 0 };
 		}
 
 		/// @brief Get an iterator to the end of the cache.
 		/// @return an iterator to the end of the cache.
-		DCA_INLINE auto end() {
-			return cacheMap.end();
+		DCA_INLINE iterator end() {
+			return { this, shard_count };
 		}
 
 		/// @brief Destructor for the object_cache class.
 		DCA_INLINE ~object_cache(){};
 
 	  protected:
-		unordered_set<unique_ptr<mapped_type>> cacheMap{};///< The underlying container for storing objects.
-		std::shared_mutex cacheMutex{};///< Mutex for ensuring thread-safe access to the cache.
-	};
+		std::array<cache_shard, shard_count> shards{};///< The independently locked shards of the cache.
 
+		/// @brief Select the shard responsible for a key.
+		/// @details the upper bits of the hash are used, as the lower bits index into each shard's table.
+		/// @tparam key_type the type of the key.
+		/// @param key the key to select the shard for.
+		/// @return the shard responsible for the key.
+		template<typename key_type> DCA_INLINE cache_shard& getShard(const key_type& key) {
+			static constexpr uint64_t shardBits{ static_cast<uint64_t>(std::countr_zero(shard_count)) };
+			if constexpr (shardBits == 0) {
+				return shards[0];
+			} else {
+				return shards[key_accessor<std::remove_cvref_t<key_type>>::getHashKey(key) >> (64 - shardBits)];
+			}
+		}
+	};
 
 }
@@ -32,6 +32,7 @@
 #include <discordcoreapi/Utilities/TCPConnection.hpp>
 #include <discordcoreapi/Utilities/UniquePtr.hpp>
 #include <discordcoreapi/JsonSpecializations.hpp>
+#include <condition_variable>
 #include <mutex>
 
 namespace discord_core_api {
@@ -42,6 +43,7 @@ namespace discord_core_api {
 			friend class https_connection_stack_holder;
 			friend class https_connection_manager;
 			friend class rate_limit_stack_holder;
+			friend class https_async_request;
 			friend class https_rnr_builder;
 			friend class rate_limit_queue;
 			friend class https_client;
@@ -55,24 +57,235 @@ namespace discord_core_api {
 			std::atomic_bool didWeHitRateLimit{};
 			std::atomic_bool doWeWait{};
 			jsonifier::string bucket{};
+			std::atomic_int64_t referenceCount{};
+			std::condition_variable releasedCondition{};///< Signalled whenever a request in flight is released, for the threads parked in acquire().
 			std::mutex accessMutex{};
+			int64_t inFlightCount{};
+
+			/// @brief Whether the requests already in flight leave some of the bucket's remaining quota unclaimed. called with accessMutex held.
+			DCA_INLINE bool hasRoom() const {
+				return inFlightCount < std::max<int64_t>(getsRemaining.load(std::memory_order_acquire), 1);
+			}
+
+			/// @brief Admits another request to this bucket, as long as the requests already in flight leave some of its remaining quota unclaimed.
+			/// @return `true` if the request was admitted, `false` otherwise.
+			DCA_INLINE bool tryAcquire() {
+				std::unique_lock lock{ accessMutex };
+				if (!hasRoom()) {
+					return false;
+				}
+				++inFlightCount;
+				return true;
+			}
+
+			/// @brief Admits another request to this bucket, parking the calling thread until a request in flight is released if the bucket is full.
+			/// @param timeout how long to wait for.
+			/// @return `true` if the request was admitted, `false` if the timeout passed first.
+			DCA_INLINE bool acquire(milliseconds timeout) {
+				std::unique_lock lock{ accessMutex };
+				if (!releasedCondition.wait_for(lock, timeout, [&] {
+						return hasRoom();
+					})) {
+					return false;
+				}
+				++inFlightCount;
+				// a response can raise the remaining quota by more than one, so pass the wakeup on while there is room left.
+				if (hasRoom()) {
+					releasedCondition.notify_one();
+				}
+				return true;
+			}
+
+			DCA_INLINE void release() {
+				{
+					std::unique_lock lock{ accessMutex };
+					--inFlightCount;
+				}
+				releasedCondition.notify_one();
+			}
+		};
+
+		/// @brief A snapshot of the global rate-limit and invalid-request counters.
+		struct rate_limit_metrics {
+			nanoseconds globalWaitTime{};///< The total time spent waiting on the global rate limit.
+			uint64_t invalidRequestCount{};///< The number of 401, 403 and 429 responses within the current ten minute window.
+			uint64_t globalThrottleCount{};///< The number of requests which had to wait on the global rate limit.
+			uint64_t globalRateLimitHits{};///< The number of 429 responses which were scoped to the global rate limit.
+			int64_t availableGlobalTokens{};///< The number of requests that could currently be sent without waiting on the global rate limit.
+			uint64_t shedRequestCount{};///< The number of requests which were shed to protect the invalid-request budget.
+		};
+
+		/// @brief A lock-free token bucket for discord's global rate limit, implemented as a generic cell rate algorithm over a single atomic timestamp.
+		class global_rate_limiter {
+		  public:
+			static constexpr int64_t requestsPerSecond{ 50 };
+			static constexpr nanoseconds emissionInterval{ 1000000000 / requestsPerSecond };
+			static constexpr nanoseconds burstTolerance{ emissionInterval * (requestsPerSecond - 1) };
+
+			DCA_INLINE global_rate_limiter() = default;
+
+			/// @brief Reserves a token from the bucket, without waiting for it to become spendable.
+			/// @return the time from which the reserved token may be spent, which has already passed unless the bucket was empty - the caller is to hold its request back until then.
+			DCA_INLINE std::chrono::steady_clock::time_point acquire() {
+				auto currentTime		   = getCurrentTime();
+				auto theoreticalArrivalNew = theoreticalArrivalTime.load(std::memory_order_acquire);
+				int64_t theoreticalArrivalNewer{};
+				do {
+					theoreticalArrivalNewer = std::max(theoreticalArrivalNew, currentTime) + emissionInterval.count();
+				} while (!theoreticalArrivalTime.compare_exchange_weak(theoreticalArrivalNew, theoreticalArrivalNewer, std::memory_order_acq_rel, std::memory_order_acquire));
+				nanoseconds waitTime{ theoreticalArrivalNewer - emissionInterval.count() - burstTolerance.count() - currentTime };
+				if (waitTime.count() > 0) {
+					throttleCount.fetch_add(1, std::memory_order_relaxed);
+					totalWaitTime.fetch_add(waitTime.count(), std::memory_order_relaxed);
+				} else {
+					waitTime = nanoseconds{};
+				}
+				return std::chrono::steady_clock::time_point{ std::chrono::duration_cast<std::chrono::steady_clock::duration>(nanoseconds{ currentTime } + waitTime) };
+			}
+
+			/// @brief Holds every further request back until a global 429's retry-after period has elapsed.
+			/// @param retryAfter the retry-after period of the 429.
+			DCA_INLINE void penalize(milliseconds retryAfter) {
+				rateLimitHits.fetch_add(1, std::memory_order_relaxed);
+				auto theoreticalArrivalNewer = getCurrentTime() + std::chrono::duration_cast<nanoseconds>(retryAfter).count() + burstTolerance.count();
+				auto theoreticalArrivalNew	 = theoreticalArrivalTime.load(std::memory_order_acquire);
+				while (theoreticalArrivalNew < theoreticalArrivalNewer &&
+					!theoreticalArrivalTime.compare_exchange_weak(theoreticalArrivalNew, theoreticalArrivalNewer, std::memory_order_acq_rel, std::memory_order_acquire)) {
+				}
+			}
+
+			DCA_INLINE void collectMetrics(rate_limit_metrics& metrics) const {
+				auto availableTime			  = getCurrentTime() + burstTolerance.count() + emissionInterval.count() - theoreticalArrivalTime.load(std::memory_order_acquire);
+				metrics.availableGlobalTokens = std::clamp<int64_t>(availableTime / emissionInterval.count(), 0, requestsPerSecond);
+				metrics.globalWaitTime		  = nanoseconds{ totalWaitTime.load(std::memory_order_relaxed) };
+				metrics.globalThrottleCount	  = throttleCount.load(std::memory_order_relaxed);
+				metrics.globalRateLimitHits	  = rateLimitHits.load(std::memory_order_relaxed);
+			}
+
+		  protected:
+			std::atomic_int64_t theoreticalArrivalTime{};///< The time, in nanoseconds, at which the bucket would be full again.
+			std::atomic_uint64_t rateLimitHits{};
+			std::atomic_uint64_t throttleCount{};
+			std::atomic_int64_t totalWaitTime{};
+
+			DCA_INLINE static int64_t getCurrentTime() {
+				return std::chrono::duration_cast<nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+			}
+		};
+
+		/// @brief A lock-free rolling count of the invalid (401, 403 and 429) responses, measured against cloudflare's ban threshold of 10,000 per ten minutes.
+		class invalid_request_tracker {
+		  public:
+			static constexpr uint64_t invalidRequestLimit{ 10000 };
+			static constexpr uint64_t backgroundPriorityThreshold{ invalidRequestLimit * 8 / 10 };
+			static constexpr uint64_t normalPriorityThreshold{ invalidRequestLimit * 95 / 100 };
+			static constexpr seconds slotLength{ 10 };
+			static constexpr uint64_t slotCount{ 60 };
+
+			DCA_INLINE invalid_request_tracker() = default;
+
+			/// @brief Records an invalid response in the current slot of the window.
+			DCA_INLINE void record() {
+				auto currentEpoch = getCurrentEpoch();
+				auto& slot		  = slots[currentEpoch % slotCount];
+				auto slotValue	  = slot.load(std::memory_order_acquire);
+				uint64_t slotValueNew{};
+				do {
+					slotValueNew = (slotValue >> 32) == currentEpoch ? slotValue + 1 : (currentEpoch << 32) | 1;
+				} while (!slot.compare_exchange_weak(slotValue, slotValueNew, std::memory_order_acq_rel, std::memory_order_acquire));
+			}
+
+			/// @brief Counts the invalid responses within the current ten minute window.
+			/// @return the number of invalid responses.
+			DCA_INLINE uint64_t getCount() const {
+				auto currentEpoch = getCurrentEpoch();
+				uint64_t returnValue{};
+				for (auto& value: slots) {
+					auto slotValue = value.load(std::memory_order_acquire);
+					if (currentEpoch - (slotValue >> 32) < slotCount) {
+						returnValue += slotValue & 0xFFFFFFFFull;
+					}
+				}
+				return returnValue;
+			}
+
+			/// @brief Checks whether a request of the given priority should be shed, to keep clear of the ban threshold.
+			/// @param priority the priority of the request.
+			/// @return `true` if the request should be shed, `false` otherwise.
+			DCA_INLINE bool shouldShed(https_workload_priority priority) {
+				if (priority == https_workload_priority::Critical) {
+					return false;
+				}
+				auto count = getCount();
+				if (count >= normalPriorityThreshold || (priority == https_workload_priority::Background && count >= backgroundPriorityThreshold)) {
+					shedCount.fetch_add(1, std::memory_order_relaxed);
+					return true;
+				}
+				return false;
+			}
+
+			DCA_INLINE void collectMetrics(rate_limit_metrics& metrics) const {
+				metrics.invalidRequestCount = getCount();
+				metrics.shedRequestCount	= shedCount.load(std::memory_order_relaxed);
+			}
+
+		  protected:
+			std::array<std::atomic_uint64_t, slotCount> slots{};///< Each slot packs the epoch it was last written in above its count.
+			std::atomic_uint64_t shedCount{};
+
+			DCA_INLINE static uint64_t getCurrentEpoch() {
+				return static_cast<uint64_t>(std::chrono::duration_cast<seconds>(sys_clock::now().time_since_epoch()) / slotLength);
+			}
 		};
 
+		/// @brief Tracks the rate-limit buckets, keyed by the discord bucket (or a placeholder until one is learned) and the request's major parameter.
 		class rate_limit_queue {
 		  public:
+			friend class https_async_request;
+			friend class https_io_reactor;
 			friend class https_client;
 
+			static constexpr milliseconds bucketIdleTimeout{ 300000 };
+			static constexpr milliseconds evictionInterval{ 60000 };
+
 			DCA_INLINE rate_limit_queue() = default;
 
 			DCA_INLINE void initialize();
 
-			DCA_INLINE rate_limit_data* getEndpointAccess(https_workload_type workloadType);
+			/// @brief Extracts the major parameter (channel, guild or webhook id) from a relative path.
+			/// @param relativePath the relative path of the request.
+			/// @return the major parameter, or an empty string_view if the route has none.
+			DCA_INLINE static jsonifier::string_view getMajorParameter(jsonifier::string_view relativePath);
+
+			DCA_INLINE rate_limit_data* getEndpointAccess(https_workload_type workloadType, jsonifier::string_view majorParameter);
+
+			/// @brief Tries to gain access to a bucket without waiting, for requests which wait on it from the io reactor instead.
+			/// @param rateLimitData the bucket, as referenced by acquireRateLimitData().
+			/// @return zero if access was gained, the time until the bucket's quota resets if it is spent, or a negative time if the bucket is only short
+			/// of in-flight slots, one of which frees up whenever another of its requests finishes.
+			DCA_INLINE static milliseconds tryGetEndpointAccess(rate_limit_data* rateLimitData);
 
-			DCA_INLINE void releaseEndPointAccess(https_workload_type type);
+			DCA_INLINE void releaseEndPointAccess(https_workload_type workloadType, jsonifier::string_view majorParameter, rate_limit_data* rateLimitData);
+
+			DCA_INLINE rate_limit_metrics getMetrics() const {
+				rate_limit_metrics returnValue{};
+				globalRateLimiter.collectMetrics(returnValue);
+				invalidRequests.collectMetrics(returnValue);
+				return returnValue;
+			}
+
+			invalid_request_tracker invalidRequests{};
+			global_rate_limiter globalRateLimiter{};
 
 		  protected:
 			unordered_map<jsonifier::string, unique_ptr<rate_limit_data>> rateLimits{};
 			unordered_map<https_workload_type, jsonifier::string> buckets{};
+			milliseconds lastEvictionTime{};
+			std::shared_mutex accessMutex{};
+
+			DCA_INLINE rate_limit_data* acquireRateLimitData(https_workload_type workloadType, jsonifier::string_view majorParameter);
+
+			DCA_INLINE void evictIdleBuckets(milliseconds currentTime);
 		};
 
 	}// namespace discord_core_internal
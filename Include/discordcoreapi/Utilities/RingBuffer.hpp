@@ -37,6 +37,11 @@
 #include <vector>
 #include <array>
 
+#if defined(__linux__)
+	#include <sys/mman.h>
+	#include <unistd.h>
+#endif
+
 namespace discord_core_api {
 
 	namespace discord_core_internal {
@@ -178,6 +183,238 @@ namespace discord_core_api {
 			}
 		};
 
+		/// @brief A growable ring buffer whose unread values can always be viewed contiguously, including across its wrap point.
+		/// @details on linux its storage is a memfd mapped twice, back to back, so that reading past the end of the storage reads its start. elsewhere, or if
+		/// the mappings can't be made, the unread values are instead moved to the front of the storage whenever a write would otherwise wrap. writes which don't
+		/// fit grow the storage rather than overwriting unread values, and once a grown buffer has stayed drained for a while it shrinks back to its initial
+		/// capacity.
+		/// @tparam value_type the type of data stored in the buffer.
+		template<typename value_type_new> class contiguous_ring_buffer {
+		  public:
+			using value_type	= std::remove_cvref_t<value_type_new>;
+			using const_pointer = const value_type*;
+			using pointer		= value_type*;
+			using size_type		= uint64_t;
+
+			static_assert(std::is_trivially_copyable_v<value_type> && (sizeof(value_type) & (sizeof(value_type) - 1)) == 0,
+				"Sorry, but the contiguous_ring_buffer can only store trivially copyable values whose size is a power of two.");
+
+			static constexpr size_type initialCapacity{ (1024 * 64) / sizeof(value_type) };
+			static constexpr size_type shrinkThreshold{ initialCapacity / 2 };///< The most values a grown buffer may hold, after a write, to count as drained.
+			static constexpr size_type shrinkDelay{ 64 };///< The number of writes in a row which must find a grown buffer drained before it shrinks.
+
+			DCA_INLINE contiguous_ring_buffer() noexcept = default;
+
+			DCA_INLINE contiguous_ring_buffer& operator=(contiguous_ring_buffer&& other) noexcept {
+				if (this != &other) {
+					std::swap(values, other.values);
+					std::swap(capacity, other.capacity);
+					std::swap(isMirrored, other.isMirrored);
+					std::swap(drainedWriteCount, other.drainedWriteCount);
+					std::swap(tail, other.tail);
+					std::swap(head, other.head);
+				}
+				return *this;
+			}
+
+			DCA_INLINE contiguous_ring_buffer(contiguous_ring_buffer&& other) noexcept {
+				*this = std::move(other);
+			}
+
+			DCA_INLINE contiguous_ring_buffer& operator=(const contiguous_ring_buffer&) = delete;
+			DCA_INLINE contiguous_ring_buffer(const contiguous_ring_buffer&)			= delete;
+
+			/// @brief Write data into the buffer, growing it if the data doesn't fit.
+			/// @tparam value_type_newer the type of data to be written.
+			/// @param data pointer to the data.
+			/// @param sizeNew size of the data.
+			template<typename value_type_newer> DCA_INLINE void writeData(value_type_newer* data, size_type sizeNew) {
+				std::memcpy(getCurrentHead(sizeNew), data, sizeNew * sizeof(value_type));
+				modifyReadOrWritePosition(ring_buffer_access_type::write, sizeNew);
+			}
+
+			/// @brief Get a pointer to the current head position, making room for at least a given number of values behind it.
+			/// @param sizeNew the number of values which must fit contiguously behind the head.
+			/// @return a pointer to the current head position.
+			DCA_INLINE pointer getCurrentHead(size_type sizeNew) {
+				if (capacity > initialCapacity) {
+					if (getUsedSpace() + sizeNew > shrinkThreshold) {
+						drainedWriteCount = 0;
+					} else if (++drainedWriteCount >= shrinkDelay) {
+						reallocate(initialCapacity);
+					}
+				}
+				if (getFreeSpace() < sizeNew) {
+					grow(getUsedSpace() + sizeNew);
+				} else if (!isMirrored && capacity - head < sizeNew) {
+					compact();
+				}
+				return values + (isMirrored ? head & (capacity - 1) : head);
+			}
+
+			/// @brief Get the number of values which can be written contiguously at the head, without growing the buffer.
+			/// @return the number of contiguously writable values.
+			DCA_INLINE size_type getWritableSpace() {
+				return isMirrored ? getFreeSpace() : capacity - head;
+			}
+
+			/// @brief Modify the read or write position of the buffer.
+			/// @param type the access type (read or write).
+			/// @param sizeNew the size by which to modify the position, which is clamped to the used space when reading.
+			DCA_INLINE void modifyReadOrWritePosition(ring_buffer_access_type type, size_type sizeNew) {
+				if (type == ring_buffer_access_type::read) {
+					tail += sizeNew < getUsedSpace() ? sizeNew : getUsedSpace();
+					if (tail == head) {
+						clear();
+					}
+				} else {
+					head += sizeNew;
+				}
+			}
+
+			/// @brief View every unread value, without consuming them.
+			/// @return a contiguous view of the unread values.
+			DCA_INLINE jsonifier::string_view_base<value_type> getReadView() {
+				return { values + (isMirrored ? tail & (capacity - 1) : tail), getUsedSpace() };
+			}
+
+			/// @brief Read every unread value out of the buffer.
+			/// @return a contiguous view of the values read, valid until the next write.
+			DCA_INLINE jsonifier::string_view_base<value_type> readData() {
+				auto returnData = getReadView();
+				clear();
+				return returnData;
+			}
+
+			/// @brief Get the used space in the buffer.
+			/// @return the used space in the buffer.
+			DCA_INLINE size_type getUsedSpace() {
+				return head - tail;
+			}
+
+			/// @brief Get the free space in the buffer.
+			/// @return the free space in the buffer.
+			DCA_INLINE size_type getFreeSpace() {
+				return capacity - getUsedSpace();
+			}
+
+			/// @brief Check if the buffer is empty.
+			/// @return true if the buffer is empty, otherwise false.
+			DCA_INLINE bool isItEmpty() {
+				return tail == head;
+			}
+
+			/// @brief Clear the buffer by resetting positions.
+			DCA_INLINE void clear() {
+				tail = 0;
+				head = 0;
+			}
+
+			DCA_INLINE ~contiguous_ring_buffer() {
+				release(values, capacity, isMirrored);
+			}
+
+		  protected:
+			size_type drainedWriteCount{};///< The number of writes in a row which have found the grown buffer drained.
+			size_type capacity{};///< The number of values the storage holds, always a power of two.
+			pointer values{};///< The storage, or the first of its two mappings.
+			bool isMirrored{};///< Whether the storage is mapped twice, back to back.
+			size_type tail{};///< The tail position in the buffer.
+			size_type head{};///< The head position in the buffer.
+
+			/// @brief Move the unread values to the front of the storage.
+			DCA_INLINE void compact() {
+				auto usedSpace = getUsedSpace();
+				std::memmove(values, values + tail, usedSpace * sizeof(value_type));
+				tail = 0;
+				head = usedSpace;
+			}
+
+			/// @brief Replace the storage with a larger one, carrying the unread values over to its front.
+			/// @param sizeNew the number of values the new storage must be able to hold.
+			DCA_INLINE void grow(size_type sizeNew) {
+				size_type capacityNew{ capacity > 0 ? capacity * 2 : initialCapacity };
+				while (capacityNew < sizeNew) {
+					capacityNew *= 2;
+				}
+				reallocate(capacityNew);
+			}
+
+			/// @brief Replace the storage with one of a given capacity, carrying the unread values over to its front.
+			/// @param capacityNew the number of values the new storage holds, which must be a power of two no smaller than the used space.
+			DCA_INLINE void reallocate(size_type capacityNew) {
+				bool isMirroredNew{ true };
+				pointer valuesNew{ mapMirrored(capacityNew) };
+				if (!valuesNew) {
+					isMirroredNew = false;
+					valuesNew	  = new value_type[capacityNew];
+				}
+				auto usedSpace = getUsedSpace();
+				if (usedSpace > 0) {
+					std::memcpy(valuesNew, getReadView().data(), usedSpace * sizeof(value_type));
+				}
+				release(values, capacity, isMirrored);
+				values			  = valuesNew;
+				capacity		  = capacityNew;
+				isMirrored		  = isMirroredNew;
+				drainedWriteCount = 0;
+				tail			  = 0;
+				head			  = usedSpace;
+			}
+
+			/// @brief Map a memfd twice, back to back, so that the second mapping mirrors the first.
+			/// @param capacityNew the number of values to map.
+			/// @return a pointer to the first mapping, or nullptr if the mappings couldn't be made.
+			DCA_INLINE static pointer mapMirrored([[maybe_unused]] size_type capacityNew) {
+#if defined(__linux__) && defined(MFD_CLOEXEC)
+				auto byteCount = capacityNew * sizeof(value_type);
+				if (byteCount % static_cast<size_type>(sysconf(_SC_PAGESIZE)) != 0) {
+					return nullptr;
+				}
+				auto fileDescriptor = memfd_create("discordcoreapi_ring_buffer", MFD_CLOEXEC);
+				if (fileDescriptor == -1) {
+					return nullptr;
+				}
+				if (ftruncate(fileDescriptor, static_cast<off_t>(byteCount)) == -1) {
+					close(fileDescriptor);
+					return nullptr;
+				}
+				auto* base = static_cast<uint8_t*>(mmap(nullptr, byteCount * 2, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+				if (base == MAP_FAILED) {
+					close(fileDescriptor);
+					return nullptr;
+				}
+				if (mmap(base, byteCount, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fileDescriptor, 0) == MAP_FAILED ||
+					mmap(base + byteCount, byteCount, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fileDescriptor, 0) == MAP_FAILED) {
+					munmap(base, byteCount * 2);
+					close(fileDescriptor);
+					return nullptr;
+				}
+				close(fileDescriptor);
+				return reinterpret_cast<pointer>(base);
+#else
+				return nullptr;
+#endif
+			}
+
+			/// @brief Release a storage, however it was allocated.
+			/// @param valuesOld the storage to release.
+			/// @param capacityOld the number of values it holds.
+			/// @param isMirroredOld whether it is mapped twice.
+			DCA_INLINE static void release(pointer valuesOld, [[maybe_unused]] size_type capacityOld, bool isMirroredOld) {
+				if (!valuesOld) {
+					return;
+				}
+				if (isMirroredOld) {
+#if defined(__linux__) && defined(MFD_CLOEXEC)
+					munmap(valuesOld, capacityOld * sizeof(value_type) * 2);
+#endif
+				} else {
+					delete[] valuesOld;
+				}
+			}
+		};
+
 		/**@}*/
 	}
 }
@@ -90,6 +90,9 @@ DCA_INLINE bool isValidSocket(SOCKET s) {
 	#include <netdb.h>
 	#include <fcntl.h>
 	#include <poll.h>
+	#if defined(__linux__)
+		#include <sys/epoll.h>
+	#endif
 #endif
 
 #if !defined(SOCKET_ERROR)
@@ -241,9 +244,8 @@ namespace discord_core_api {
 						shutdown(*ptrNew, SHUT_RDWR);
 						close(*ptrNew);
 						*ptrNew = INVALID_SOCKET;
-						delete ptrNew;
-						ptrNew = nullptr;
 					};
+					delete ptrNew;
 				}
 			};
 
@@ -301,10 +303,90 @@ namespace discord_core_api {
 			addrinfo* ptr{ &value };
 		};
 
+		/// @brief A snapshot of the resolver cache and tls session resumption counters.
+		struct connection_metrics {
+			uint64_t dnsCacheHits{};///< The number of connections which were made to a cached address.
+			uint64_t dnsCacheMisses{};///< The number of connections which had to call getaddrinfo.
+			uint64_t resumedSessions{};///< The number of tls handshakes which resumed a previous session.
+			uint64_t fullHandshakes{};///< The number of tls handshakes which negotiated a new session.
+		};
+
+		/// @brief Caches resolved addresses for a fixed time-to-live, so that reconnecting to a host does not block on getaddrinfo again.
+		class dns_cache {
+		  public:
+			static constexpr seconds timeToLive{ 300 };
+
+			struct resolved_address {
+				sys_clock::time_point expiryTime{};
+				sockaddr_storage address{};
+				socklen_t addressLength{};
+				int32_t socketType{};
+				int32_t protocol{};
+				int32_t family{};
+			};
+
+			DCA_INLINE static std::atomic_uint64_t hitCount{};
+			DCA_INLINE static std::atomic_uint64_t missCount{};
+
+			/// @brief Resolves a host, from the cache if it holds an unexpired entry for it.
+			/// @param host the host to be resolved.
+			/// @param port the port to be connected to.
+			/// @param returnValue the resolved address.
+			/// @return `true` if the host was resolved, `false` otherwise.
+			DCA_INLINE static bool resolve(const jsonifier::string& host, uint16_t port, resolved_address& returnValue) {
+				auto key = host + ":" + jsonifier::toString(port);
+				{
+					std::unique_lock lock{ accessMutex };
+					if (auto iter = addresses.find(key); iter != addresses.end() && sys_clock::now() < iter->second.expiryTime) {
+						returnValue = iter->second;
+						hitCount.fetch_add(1, std::memory_order_relaxed);
+						return true;
+					}
+				}
+				missCount.fetch_add(1, std::memory_order_relaxed);
+				addrinfo_wrapper hints{};
+				addrinfo* address{};
+				hints->ai_family   = AF_INET;
+				hints->ai_socktype = SOCK_STREAM;
+				hints->ai_protocol = IPPROTO_TCP;
+				if (getaddrinfo(host.data(), jsonifier::toString(port).data(), hints, &address) || !address) {
+					return false;
+				}
+				std::memcpy(&returnValue.address, address->ai_addr, address->ai_addrlen);
+				returnValue.addressLength = static_cast<socklen_t>(address->ai_addrlen);
+				returnValue.socketType	  = address->ai_socktype;
+				returnValue.protocol	  = address->ai_protocol;
+				returnValue.family		  = address->ai_family;
+				returnValue.expiryTime	  = sys_clock::now() + timeToLive;
+				freeaddrinfo(address);
+				std::unique_lock lock{ accessMutex };
+				if (auto iter = addresses.find(key); iter != addresses.end()) {
+					iter->second = returnValue;
+				} else {
+					addresses.emplace(key, returnValue);
+				}
+				return true;
+			}
+
+			/// @brief Drops a host's cached address, so that the next connection to it resolves it afresh.
+			/// @param host the host to be dropped.
+			/// @param port the port it was resolved for.
+			DCA_INLINE static void invalidate(const jsonifier::string& host, uint16_t port) {
+				std::unique_lock lock{ accessMutex };
+				addresses.erase(host + ":" + jsonifier::toString(port));
+			}
+
+		  protected:
+			DCA_INLINE static unordered_map<jsonifier::string, resolved_address> addresses{};
+			DCA_INLINE static std::mutex accessMutex{};
+		};
+
 		class ssl_context_holder {
 		  public:
 			DCA_INLINE static ssl_ctx_wrapper context{};
 			DCA_INLINE static std::mutex accessMutex{};
+			DCA_INLINE static std::atomic_uint64_t resumedSessionCount{};
+			DCA_INLINE static std::atomic_uint64_t fullHandshakeCount{};
 
 			DCA_INLINE static bool initialize() {
 				if (ssl_context_holder::context = SSL_CTX_new(TLS_client_method()); !ssl_context_holder::context) {
@@ -321,19 +403,94 @@ namespace discord_core_api {
 					return false;
 				}
 #endif
+				SSL_CTX_set_mode(ssl_context_holder::context, SSL_MODE_ACCEPT_MOVING_WRITE_BUFFER);
+				SSL_CTX_set_session_cache_mode(ssl_context_holder::context, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+				SSL_CTX_sess_set_new_cb(ssl_context_holder::context, &ssl_context_holder::storeSession);
 				return true;
 			}
+
+			/// @brief Offers the most recent session negotiated with a host for resumption, if there is one.
+			/// @param ssl the connection which is about to handshake with the host.
+			/// @param host the host, as it was passed for sni.
+			DCA_INLINE static void resumeSession(SSL* ssl, const jsonifier::string& host) {
+				std::unique_lock lock{ sessionMutex };
+				if (auto iter = sessions.find(host); iter != sessions.end()) {
+					SSL_set_session(ssl, iter->second);
+				}
+			}
+
+			/// @brief Counts a completed handshake as either resumed or full.
+			/// @param ssl the connection which completed its handshake.
+			DCA_INLINE static void recordHandshake(SSL* ssl) {
+				if (SSL_session_reused(ssl)) {
+					resumedSessionCount.fetch_add(1, std::memory_order_relaxed);
+				} else {
+					fullHandshakeCount.fetch_add(1, std::memory_order_relaxed);
+				}
+			}
+
+		  protected:
+			DCA_INLINE static unordered_map<jsonifier::string, SSL_SESSION*> sessions{};
+			DCA_INLINE static std::mutex sessionMutex{};
+
+			/// @brief Keeps each new session, or session ticket, which a server hands out, keyed on its host.
+			DCA_INLINE static int32_t storeSession(SSL* ssl, SSL_SESSION* session) {
+				auto hostName = SSL_get_servername(ssl, TLSEXT_NAMETYPE_host_name);
+				if (!hostName) {
+					return 0;
+				}
+				std::unique_lock lock{ sessionMutex };
+				if (auto iter = sessions.find(jsonifier::string{ hostName }); iter != sessions.end()) {
+					SSL_SESSION_free(iter->second);
+					iter->second = session;
+				} else {
+					sessions.emplace(jsonifier::string{ hostName }, session);
+				}
+				return 1;
+			}
+		};
+
+		/// @brief The stages a tcp_connection passes through before it can carry data.
+		enum class connect_state { Connecting = 0, Handshaking = 1, Connected = 2 };
+
+		/// @brief How long a tcp_connection may spend on each stage of connecting before it is abandoned, and how it flushes its writes.
+		struct connection_settings {
+			DCA_INLINE static tcp_write_policy writePolicy{ tcp_write_policy::os_default };///< How coalesced writes are handed to the socket.
+			DCA_INLINE static milliseconds connectTimeout{ 5000 };///< The time allowed for the tcp connection to be established.
+			DCA_INLINE static milliseconds handshakeTimeout{ 5000 };///< The time allowed for the tls handshake to complete.
+			DCA_INLINE static bool pollOnHealthCheck{};///< Whether areWeStillConnected() polls the socket on every call, as it did before health was tracked from io results.
+		};
+
+		DCA_INLINE bool isConnectInProgress() {
+#if defined(_WIN32)
+			return WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+			return errno == EINPROGRESS;
+#endif
+		}
+
+		/// @brief Data queued by writeData, which the io thread has yet to move into a connection's output buffers.
+		struct queued_write {
+			jsonifier::string_base<uint8_t> data{};///< The bytes to be written.
+			bool priority{};///< Whether they are to be flushed ahead of everything else that is queued.
 		};
 
 		template<typename value_type> class ssl_data_interface {
 		  public:
 			template<typename value_type2> friend class tcp_connection;
+			friend class https_io_reactor;
+			friend class base_socket_agent;
 			friend class https_client;
 
 			ssl_data_interface& operator=(ssl_data_interface<value_type>&& other) noexcept {
-				outputBuffer = std::move(other.outputBuffer);
-				inputBuffer	 = std::move(other.inputBuffer);
-				bytesRead	 = other.bytesRead;
+				priorityBuffer = std::move(other.priorityBuffer);
+				queuedWrites   = std::move(other.queuedWrites);
+				outputBuffer   = std::move(other.outputBuffer);
+				inputBuffer	   = std::move(other.inputBuffer);
+				writeBuffer	   = std::move(other.writeBuffer);
+				isWriteStaged  = other.isWriteStaged;
+				writeSize	   = other.writeSize;
+				bytesRead	   = other.bytesRead;
 				return *this;
 			}
 
@@ -341,22 +498,18 @@ namespace discord_core_api {
 				*this = std::move(other);
 			}
 
+			/// @brief Queues data to be written by the connection's next flush. safe to call from any thread, as only the thread that drives the connection's io
+			/// ever touches its buffers.
+			/// @param dataToWrite the data to be written.
+			/// @param priority whether the data should be flushed ahead of everything else that is queued.
 			template<typename value_type_new> DCA_INLINE void writeData(jsonifier::string_view_base<value_type_new> dataToWrite, bool priority) {
 				if (static_cast<value_type*>(this)->areWeStillConnected()) {
 					if (dataToWrite.size() > 0 && static_cast<value_type*>(this)->ssl) {
-						if (priority && dataToWrite.size() < maxBufferSize) {
-							outputBuffer.clear();
-							outputBuffer.writeData(dataToWrite.data(), dataToWrite.size());
-							static_cast<value_type*>(this)->processWriteData();
-						} else {
-							uint64_t remainingBytes{ dataToWrite.size() };
-							while (remainingBytes > 0) {
-								uint64_t amountToCollect{ dataToWrite.size() >= maxBufferSize ? maxBufferSize : dataToWrite.size() };
-								outputBuffer.writeData(dataToWrite.data(), amountToCollect);
-								dataToWrite	   = jsonifier::string_view_base{ dataToWrite.data() + amountToCollect, dataToWrite.size() - amountToCollect };
-								remainingBytes = dataToWrite.size();
-							}
-						}
+						queued_write writeNew{};
+						writeNew.data.resize(dataToWrite.size());
+						std::memcpy(writeNew.data.data(), dataToWrite.data(), dataToWrite.size());
+						writeNew.priority = priority;
+						queuedWrites.send(std::move(writeNew));
 					}
 					return;
 				} else {
@@ -368,22 +521,94 @@ namespace discord_core_api {
 				return inputBuffer.readData();
 			}
 
+			/// @brief Views everything read so far, without consuming it, so that it can be parsed in place.
+			/// @return a contiguous view of the unconsumed input.
+			DCA_INLINE jsonifier::string_view_base<uint8_t> peekInputBuffer() {
+				return inputBuffer.getReadView();
+			}
+
+			/// @brief Consumes input which has been parsed in place.
+			/// @param sizeNew the number of bytes to consume.
+			DCA_INLINE void consumeInputBuffer(uint64_t sizeNew) {
+				inputBuffer.modifyReadOrWritePosition(ring_buffer_access_type::read, sizeNew);
+			}
+
 			DCA_INLINE int64_t getBytesRead() {
 				return bytesRead;
 			}
 
+			/// @brief Checks whether anything is queued, or staged, to be written.
+			/// @return `true` if there are bytes waiting to be written, `false` otherwise.
+			DCA_INLINE bool hasPendingWrites() {
+				return writeSize > 0 || priorityBuffer.getUsedSpace() > 0 || outputBuffer.getUsedSpace() > 0 || queuedWrites.size() > 0;
+			}
+
 			DCA_INLINE void reset() {
+				queuedWrites.clearContents();
+				priorityBuffer.clear();
 				outputBuffer.clear();
 				inputBuffer.clear();
+				writeSize = 0;
 				bytesRead = 0;
 			}
 
 		  protected:
 			const uint64_t maxBufferSize{ (1024 * 16) };
-			ring_buffer<uint8_t, 16> outputBuffer{};
-			ring_buffer<uint8_t, 64> inputBuffer{};
+			unbounded_message_block<queued_write> queuedWrites{};///< Data handed to writeData, from any thread, which has yet to reach the buffers below.
+			jsonifier::string_base<uint8_t> writeBuffer{};///< Both queues, coalesced, for flushes which have priority bytes to put first.
+			contiguous_ring_buffer<uint8_t> priorityBuffer{};///< Bytes which are flushed ahead of the rest of the queue.
+			contiguous_ring_buffer<uint8_t> outputBuffer{};
+			contiguous_ring_buffer<uint8_t> inputBuffer{};
+			uint64_t writeSize{};///< The number of bytes handed to SSL_write_ex which it has yet to accept.
+			bool isWriteStaged{};///< Whether those bytes are in writeBuffer, rather than at the front of outputBuffer.
 			int64_t bytesRead{};
 
+			/// @brief Moves the data queued by writeData into the output buffers, in the order it was queued. only called from the io thread.
+			DCA_INLINE void drainQueuedWrites() {
+				queued_write writeNew{};
+				while (queuedWrites.tryReceive(writeNew)) {
+					if (writeNew.priority) {
+						priorityBuffer.writeData(writeNew.data.data(), writeNew.data.size());
+					} else {
+						outputBuffer.writeData(writeNew.data.data(), writeNew.data.size());
+					}
+				}
+			}
+
+			/// @brief Selects the bytes for the next flush: the output queue in place or, when priority bytes are waiting, both queues coalesced into the write buffer, priority bytes first.
+			/// @return the number of bytes selected.
+			DCA_INLINE uint64_t prepareWrite() {
+				if (priorityBuffer.isItEmpty()) {
+					isWriteStaged = false;
+					writeSize	  = outputBuffer.getUsedSpace();
+					return writeSize;
+				}
+				auto priorityData = priorityBuffer.readData();
+				auto outputData	  = outputBuffer.readData();
+				writeSize		  = priorityData.size() + outputData.size();
+				if (writeBuffer.size() < writeSize) {
+					writeBuffer.resize(writeSize);
+				}
+				std::memcpy(writeBuffer.data(), priorityData.data(), priorityData.size());
+				std::memcpy(writeBuffer.data() + priorityData.size(), outputData.data(), outputData.size());
+				isWriteStaged = true;
+				return writeSize;
+			}
+
+			/// @brief Get the bytes selected for the current flush.
+			/// @return a pointer to the bytes selected.
+			DCA_INLINE const uint8_t* getWriteData() {
+				return isWriteStaged ? writeBuffer.data() : outputBuffer.getReadView().data();
+			}
+
+			/// @brief Releases the bytes of a flush which SSL_write_ex has accepted.
+			DCA_INLINE void finishWrite() {
+				if (!isWriteStaged) {
+					outputBuffer.modifyReadOrWritePosition(ring_buffer_access_type::read, writeSize);
+				}
+				writeSize = 0;
+			}
+
 			DCA_INLINE ssl_data_interface() = default;
 
 			virtual ~ssl_data_interface() = default;
@@ -392,12 +617,17 @@ namespace discord_core_api {
 		template<typename value_type> class tcp_connection : public ssl_data_interface<tcp_connection<value_type>> {
 		  public:
 			connection_status currentStatus{ connection_status::NO_Error };
+			connect_state connectState{ connect_state::Connecting };
+			hrclock::time_point connectDeadline{};
+			jsonifier::string hostName{};
 			socket_wrapper socket{};
+			uint16_t port{};
 			bool writeWantWrite{};
 			bool writeWantRead{};
 			bool readWantWrite{};
 			bool readWantRead{};
 			ssl_wrapper ssl{};
+			bool corked{};
 
 			tcp_connection& operator=(tcp_connection&& other)	   = default;
 			tcp_connection(tcp_connection&& other)				   = default;
@@ -418,31 +648,61 @@ namespace discord_core_api {
 				} else {
 					addressString = baseUrlNew;
 				}
-				addrinfo_wrapper hints{}, address{};
-				hints->ai_family   = AF_INET;
-				hints->ai_socktype = SOCK_STREAM;
-				hints->ai_protocol = IPPROTO_TCP;
-
-				if (getaddrinfo(addressString.data(), jsonifier::toString(portNew).data(), hints, address)) {
+				hostName = addressString;
+				port	 = portNew;
+				dns_cache::resolved_address address{};
+				if (!dns_cache::resolve(addressString, portNew, address)) {
 					message_printer::printError<print_message_type::general>(reportError("Tcp_connection::getaddrinfo(), to: " + baseUrlNew));
 					currentStatus = connection_status::CONNECTION_Error;
 					socket		  = INVALID_SOCKET;
 					return;
 				}
 
-				if (socket = ::socket(address->ai_family, address->ai_socktype, address->ai_protocol); !isValidSocket(socket.operator SOCKET())) {
+				if (socket = ::socket(address.family, address.socketType, address.protocol); !isValidSocket(socket.operator SOCKET())) {
 					message_printer::printError<print_message_type::general>(reportError("Tcp_connection::SOCKET(), to: " + baseUrlNew));
 					currentStatus = connection_status::CONNECTION_Error;
 					socket		  = INVALID_SOCKET;
 					return;
 				}
 
-				if (::connect(socket, address->ai_addr, static_cast<int32_t>(address->ai_addrlen)) == SOCKET_ERROR) {
-					message_printer::printError<print_message_type::general>(reportError("Tcp_connection::connect(), to: " + baseUrlNew));
+#if defined(_WIN32)
+				u_long value02{ 1 };
+				if (auto returnData{ ioctlsocket(socket, FIONBIO, &value02) }; returnData == SOCKET_ERROR) {
+					message_printer::printError<print_message_type::general>(reportError("Tcp_connection::connect::ioctlsocket(), to: " + baseUrlNew));
+					currentStatus = connection_status::CONNECTION_Error;
+					socket		  = INVALID_SOCKET;
+					return;
+				}
+#else
+				if (auto returnData{ fcntl(socket, F_SETFL, fcntl(socket, F_GETFL, 0) | O_NONBLOCK) }; returnData == SOCKET_ERROR) {
+					message_printer::printError<print_message_type::general>(reportError("Tcp_connection::connect::fcntl(), to: " + baseUrlNew));
 					currentStatus = connection_status::CONNECTION_Error;
 					socket		  = INVALID_SOCKET;
 					return;
 				}
+#endif
+
+				if (connection_settings::writePolicy != tcp_write_policy::os_default) {
+					int32_t value01{ 1 };
+					if (auto returnData{ setsockopt(socket, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<char*>(&value01), sizeof(value01)) }; returnData == SOCKET_ERROR) {
+						message_printer::printError<print_message_type::general>(reportError("Tcp_connection::connect::setsockopt(), to: " + baseUrlNew));
+					}
+				}
+
+				if (::connect(socket, reinterpret_cast<sockaddr*>(&address.address), static_cast<int32_t>(address.addressLength)) == SOCKET_ERROR) {
+					if (!isConnectInProgress()) {
+						message_printer::printError<print_message_type::general>(reportError("Tcp_connection::connect(), to: " + baseUrlNew));
+						dns_cache::invalidate(addressString, portNew);
+						currentStatus = connection_status::CONNECTION_Error;
+						socket		  = INVALID_SOCKET;
+						return;
+					}
+					connectState	= connect_state::Connecting;
+					connectDeadline = hrclock::now() + connection_settings::connectTimeout;
+				} else {
+					connectState	= connect_state::Handshaking;
+					connectDeadline = hrclock::now() + connection_settings::handshakeTimeout;
+				}
 
 				std::unique_lock lock{ ssl_context_holder::accessMutex };
 				if (ssl = SSL_new(ssl_context_holder::context); !ssl) {
@@ -474,34 +734,84 @@ namespace discord_core_api {
 					return;
 				}
 
-				if (auto result{ SSL_connect(ssl) }; result != 1) {
-					message_printer::printError<print_message_type::general>(reportSSLError("Tcp_connection::connect::SSL_connect(), to: " + baseUrlNew) + "\n" +
-						reportError("Tcp_connection::connect::SSL_connect(), to: " + baseUrlNew));
-					currentStatus = connection_status::CONNECTION_Error;
-					socket		  = INVALID_SOCKET;
-					ssl			  = nullptr;
-					return;
+				ssl_context_holder::resumeSession(ssl, addressString);
+				currentStatus = connection_status::NO_Error;
+				// a connect which completed straight away, as it can over loopback, still has to send its ClientHello before anything polls as ready.
+				if (connectState == connect_state::Handshaking) {
+					processConnect(true);
 				}
+			}
 
-#if defined(_WIN32)
-				u_long value02{ 1 };
-				if (auto returnData{ ioctlsocket(socket, FIONBIO, &value02) }; returnData == SOCKET_ERROR) {
-					message_printer::printError<print_message_type::general>(reportError("Tcp_connection::connect::ioctlsocket(), to: " + baseUrlNew));
-					currentStatus = connection_status::CONNECTION_Error;
-					socket		  = INVALID_SOCKET;
-					ssl			  = nullptr;
-					return;
+			/// @brief Advances the connect and handshake by one step, abandoning them if the current stage's deadline has passed.
+			/// @param isReady whether the socket polled as ready for the current stage.
+			/// @return `false` if the connection failed or timed out, `true` otherwise.
+			DCA_INLINE bool processConnect(bool isReady) {
+				if (connectState == connect_state::Connecting && isReady) {
+					int32_t socketError{};
+					socklen_t socketErrorLength{ sizeof(socketError) };
+					if (getsockopt(socket, SOL_SOCKET, SO_ERROR, reinterpret_cast<char*>(&socketError), &socketErrorLength) == SOCKET_ERROR || socketError != 0) {
+						message_printer::printError<print_message_type::general>(
+							"Tcp_connection::processConnect()::connect(), to: " + hostName + " error: " + jsonifier::toString(socketError));
+						dns_cache::invalidate(hostName, port);
+						currentStatus = connection_status::CONNECTION_Error;
+						socket		  = INVALID_SOCKET;
+						ssl			  = nullptr;
+						return false;
+					}
+					connectState	= connect_state::Handshaking;
+					connectDeadline = hrclock::now() + connection_settings::handshakeTimeout;
 				}
-#else
-				if (auto returnData{ fcntl(socket, F_SETFL, fcntl(socket, F_GETFL, 0) | O_NONBLOCK) }; returnData == SOCKET_ERROR) {
-					message_printer::printError<print_message_type::general>(reportError("Tcp_connection::connect::fcntl(), to: " + baseUrlNew));
+				if (connectState == connect_state::Handshaking && isReady) {
+					readWantRead   = false;
+					writeWantWrite = false;
+					auto result{ SSL_connect(ssl) };
+					switch (SSL_get_error(ssl, result)) {
+						case SSL_ERROR_NONE: {
+							ssl_context_holder::recordHandshake(ssl);
+							connectState = connect_state::Connected;
+							return true;
+						}
+						case SSL_ERROR_WANT_READ: {
+							readWantRead = true;
+							break;
+						}
+						case SSL_ERROR_WANT_WRITE: {
+							writeWantWrite = true;
+							break;
+						}
+						default: {
+							message_printer::printError<print_message_type::general>(reportSSLError("Tcp_connection::processConnect()::SSL_connect(), to: " + hostName) + "\n" +
+								reportError("Tcp_connection::processConnect()::SSL_connect(), to: " + hostName));
+							currentStatus = connection_status::CONNECTION_Error;
+							socket		  = INVALID_SOCKET;
+							ssl			  = nullptr;
+							return false;
+						}
+					}
+				}
+				if (connectState != connect_state::Connected && hrclock::now() >= connectDeadline) {
+					message_printer::printError<print_message_type::general>(
+						"Tcp_connection::processConnect(), to: " + hostName + (connectState == connect_state::Connecting ? ", timed out connecting." : ", timed out handshaking."));
 					currentStatus = connection_status::CONNECTION_Error;
 					socket		  = INVALID_SOCKET;
 					ssl			  = nullptr;
-					return;
+					return false;
 				}
-#endif
-				currentStatus = connection_status::NO_Error;
+				return true;
+			}
+
+			/// @brief Drives the connect and handshake to completion for the blocking https path, sleeping in poll until the socket is ready or the
+			/// current stage's deadline passes - the reactors instead advance processConnect() from their own readiness events.
+			/// @return `true` if the connection is ready to carry data, `false` otherwise.
+			DCA_INLINE bool finishConnecting() {
+				while (connectState != connect_state::Connected && currentStatus == connection_status::NO_Error) {
+					processIO(static_cast<int32_t>(std::max<int64_t>(std::chrono::ceil<milliseconds>(connectDeadline - hrclock::now()).count(), 0)));
+				}
+				return connectState == connect_state::Connected && areWeStillConnected();
+			}
+
+			DCA_INLINE short getConnectEvents() {
+				return connectState == connect_state::Connecting || writeWantWrite ? POLLOUT : POLLIN;
 			}
 
 			DCA_INLINE connection_status processIO(int32_t waitTimeInMs) {
@@ -510,11 +820,13 @@ namespace discord_core_api {
 				};
 				pollfd readWriteSet{};
 				readWriteSet.fd = static_cast<SOCKET>(socket);
-				if (writeWantRead || readWantRead) {
+				if (connectState != connect_state::Connected) {
+					readWriteSet.events = getConnectEvents();
+				} else if (writeWantRead || readWantRead) {
 					readWriteSet.events = POLLIN;
 				} else if (writeWantWrite || readWantWrite) {
 					readWriteSet.events = POLLOUT;
-				} else if (static_cast<value_type*>(this)->outputBuffer.getUsedSpace() > 0) {
+				} else if (static_cast<value_type*>(this)->hasPendingWrites()) {
 					readWriteSet.events = POLLIN | POLLOUT;
 				} else {
 					readWriteSet.events = POLLIN;
@@ -527,6 +839,12 @@ namespace discord_core_api {
 					currentStatus = connection_status::SOCKET_Error;
 					return currentStatus;
 				} else if (returnValue == 0) {
+					if (connectState != connect_state::Connected) {
+						processConnect(false);
+					}
+					return currentStatus;
+				} else if (connectState != connect_state::Connected) {
+					processConnect(true);
 					return currentStatus;
 				} else {
 					if (readWriteSet.revents & POLLOUT || (POLLIN && writeWantRead)) {
@@ -572,15 +890,28 @@ namespace discord_core_api {
 				return currentStatus;
 			}
 
+			/// @brief Checks the connection's state, as last updated by its reads, writes and polls, without touching the socket.
+			/// @return `true` if the connection is still usable, `false` otherwise.
 			DCA_INLINE bool areWeStillConnected() {
+				if (connection_settings::pollOnHealthCheck) {
+					return pollForHealth();
+				}
+				return currentStatus == connection_status::NO_Error && socket.operator SOCKET() != INVALID_SOCKET && ssl.operator bool();
+			}
+
+			/// @brief Checks the connection's state with a poll of the socket, as every call to areWeStillConnected() once did. only used when
+			/// connection_settings::pollOnHealthCheck is set, as a baseline to measure the tracked state against.
+			/// @return `true` if the connection is still usable, `false` otherwise.
+			DCA_INLINE bool pollForHealth() {
 				if (socket.operator bool() && socket.operator SOCKET() != INVALID_SOCKET && currentStatus == connection_status::NO_Error && ssl.operator bool()) {
 					pollfd fdEvent = {};
 					fdEvent.fd	   = socket;
 					fdEvent.events = POLLOUT;
 					int32_t result = poll(&fdEvent, 1, 1);
 					if (result == SOCKET_ERROR || fdEvent.revents & POLLHUP || fdEvent.revents & POLLNVAL || fdEvent.revents & POLLERR) {
-						socket = INVALID_SOCKET;
-						ssl	   = nullptr;
+						currentStatus = connection_status::CONNECTION_Error;
+						socket		  = INVALID_SOCKET;
+						ssl			  = nullptr;
 						return false;
 					}
 					return true;
@@ -589,14 +920,31 @@ namespace discord_core_api {
 				}
 			}
 
+			/// @brief Corks the socket for the length of a flush, when the cork write policy is in use, so that the flush's tls records leave in full segments.
+			/// @param corkedNew whether the socket should be corked.
+			DCA_INLINE void setCorked([[maybe_unused]] bool corkedNew) {
+#if defined(__linux__)
+				if (connection_settings::writePolicy == tcp_write_policy::cork && corked != corkedNew) {
+					int32_t value{ corkedNew };
+					if (setsockopt(socket, IPPROTO_TCP, TCP_CORK, &value, sizeof(value)) == 0) {
+						corked = corkedNew;
+					}
+				}
+#endif
+			}
+
 			DCA_INLINE bool processWriteData() {
+				if (connectState != connect_state::Connected) {
+					return true;
+				}
 				writeWantRead  = false;
 				writeWantWrite = false;
-				if (static_cast<value_type*>(this)->outputBuffer.getUsedSpace() > 0 && areWeStillConnected()) {
-					uint64_t bytesToWrite{ static_cast<value_type*>(this)->outputBuffer.getCurrentTail()->getUsedSpace() };
-
+				static_cast<value_type*>(this)->drainQueuedWrites();
+				// a write which previously wanted to be retried must be retried with the same bytes, so nothing new is staged until it completes.
+				if (areWeStillConnected() && (static_cast<value_type*>(this)->writeSize > 0 || static_cast<value_type*>(this)->prepareWrite() > 0)) {
+					setCorked(true);
 					size_t writtenBytes{};
-					auto returnData{ SSL_write_ex(ssl, static_cast<value_type*>(this)->outputBuffer.readData().data(), bytesToWrite, &writtenBytes) };
+					auto returnData{ SSL_write_ex(ssl, static_cast<value_type*>(this)->getWriteData(), static_cast<value_type*>(this)->writeSize, &writtenBytes) };
 					auto errorValue{ SSL_get_error(ssl, returnData) };
 					switch (errorValue) {
 						case SSL_ERROR_WANT_READ: {
@@ -608,11 +956,14 @@ namespace discord_core_api {
 							return true;
 						}
 						case SSL_ERROR_NONE: {
+							static_cast<value_type*>(this)->finishWrite();
+							setCorked(false);
 							return true;
 						}
 						case SSL_ERROR_ZERO_RETURN: {
-							socket = INVALID_SOCKET;
-							ssl	   = nullptr;
+							currentStatus = connection_status::CONNECTION_Error;
+							socket		  = INVALID_SOCKET;
+							ssl			  = nullptr;
 							return false;
 						}
 						default: {
@@ -624,17 +975,20 @@ namespace discord_core_api {
 			}
 
 			DCA_INLINE bool processReadData() {
+				if (connectState != connect_state::Connected) {
+					return true;
+				}
 				readWantRead  = false;
 				readWantWrite = false;
-				if (!static_cast<value_type*>(this)->inputBuffer.isItFull() && areWeStillConnected()) {
+				if (areWeStillConnected()) {
 					do {
 						size_t readBytes{};
-						uint64_t bytesToRead{ static_cast<value_type*>(this)->maxBufferSize };
-						auto returnData{ SSL_read_ex(ssl, static_cast<value_type*>(this)->inputBuffer.getCurrentHead()->getCurrentHead(), bytesToRead, &readBytes) };
+						auto* readHead{ static_cast<value_type*>(this)->inputBuffer.getCurrentHead(static_cast<value_type*>(this)->maxBufferSize) };
+						uint64_t bytesToRead{ static_cast<value_type*>(this)->inputBuffer.getWritableSpace() };
+						auto returnData{ SSL_read_ex(ssl, readHead, bytesToRead, &readBytes) };
 						auto errorValue{ SSL_get_error(ssl, returnData) };
 						if (static_cast<int64_t>(readBytes) > 0) {
-							static_cast<value_type*>(this)->inputBuffer.getCurrentHead()->modifyReadOrWritePosition(ring_buffer_access_type::write, readBytes);
-							static_cast<value_type*>(this)->inputBuffer.modifyReadOrWritePosition(ring_buffer_access_type::write, 1);
+							static_cast<value_type*>(this)->inputBuffer.modifyReadOrWritePosition(ring_buffer_access_type::write, readBytes);
 							static_cast<value_type*>(this)->bytesRead += readBytes;
 							static_cast<value_type*>(this)->handleBuffer();
 						}
@@ -651,19 +1005,74 @@ namespace discord_core_api {
 								break;
 							}
 							case SSL_ERROR_ZERO_RETURN: {
-								socket = INVALID_SOCKET;
-								ssl	   = nullptr;
+								currentStatus = connection_status::CONNECTION_Error;
+								socket		  = INVALID_SOCKET;
+								ssl			  = nullptr;
 								return true;
 							}
 							default: {
 								return false;
 							}
 						}
-					} while (areWeStillConnected() && SSL_pending(ssl) && !static_cast<value_type*>(this)->inputBuffer.isItFull() && !readWantRead);
+					} while (areWeStillConnected() && SSL_pending(ssl) && !readWantRead);
 				}
 				return true;
 			}
 
+#if defined(__linux__)
+			/// @brief Services the connection for the events an edge-triggered epoll instance reported for its socket.
+			/// @param events the epoll events which were reported.
+			/// @return the events to service the connection for again without waiting, as their edges won't be reported twice, or 0 if it was drained.
+			DCA_INLINE uint32_t processEvents(uint32_t events) {
+				if (!areWeStillConnected()) {
+					return 0;
+				}
+				if (connectState != connect_state::Connected) {
+					if (!processConnect(events != 0) || connectState != connect_state::Connected) {
+						return 0;
+					}
+					events = EPOLLIN | EPOLLOUT;
+				}
+				if (events & EPOLLOUT || (events & EPOLLIN && writeWantRead)) {
+					if (!processWriteData()) {
+						message_printer::printError<print_message_type::general>(
+							reportSSLError("tcp_connection::processEvents() 00") + "\n" + reportError("tcp_connection::processEvents() 00"));
+						currentStatus = connection_status::WRITE_Error;
+						socket		  = INVALID_SOCKET;
+						ssl			  = nullptr;
+						return 0;
+					}
+				}
+				if (events & (EPOLLIN | EPOLLRDHUP) || (events & EPOLLOUT && readWantWrite)) {
+					if (!processReadData()) {
+						message_printer::printError<print_message_type::general>(
+							reportSSLError("tcp_connection::processEvents() 01") + "\n" + reportError("tcp_connection::processEvents() 01"));
+						currentStatus = connection_status::READ_Error;
+						socket		  = INVALID_SOCKET;
+						ssl			  = nullptr;
+						return 0;
+					}
+				}
+				if (events & (EPOLLERR | EPOLLHUP)) {
+					currentStatus = events & EPOLLERR ? connection_status::POLLERR_Error : connection_status::POLLHUP_Error;
+					socket		  = INVALID_SOCKET;
+					ssl			  = nullptr;
+					return 0;
+				}
+				if (!areWeStillConnected()) {
+					return 0;
+				}
+				uint32_t eventsNew{};
+				if (events & (EPOLLIN | EPOLLRDHUP) && !readWantRead && !readWantWrite) {
+					eventsNew |= EPOLLIN;
+				}
+				if (static_cast<value_type*>(this)->hasPendingWrites() && !writeWantWrite && !writeWantRead) {
+					eventsNew |= EPOLLOUT;
+				}
+				return eventsNew;
+			}
+#endif
+
 			template<typename value_type2> DCA_INLINE static unordered_map<uint64_t, value_type2*> processIO(unordered_map<uint64_t, value_type2*>& shardMap) {
 				unordered_map<uint64_t, value_type2*> returnData{};
 				poll_fd_wrapper readWriteSet{};
@@ -671,11 +1080,13 @@ namespace discord_core_api {
 					if (value->areWeStillConnected()) {
 						pollfd fdSet{};
 						fdSet.fd = static_cast<SOCKET>(value->socket);
-						if (value->writeWantRead || value->readWantRead) {
+						if (value->connectState != connect_state::Connected) {
+							fdSet.events = value->getConnectEvents();
+						} else if (value->writeWantRead || value->readWantRead) {
 							fdSet.events = POLLIN;
 						} else if (value->writeWantWrite || value->readWantWrite) {
 							fdSet.events = POLLOUT;
-						} else if (value->outputBuffer.getUsedSpace() > 0) {
+						} else if (value->hasPendingWrites()) {
 							fdSet.events = POLLIN | POLLOUT;
 						} else {
 							fdSet.events = POLLIN;
@@ -710,9 +1121,21 @@ namespace discord_core_api {
 					}
 
 				} else if (returnDataNew == 0) {
+					for (uint64_t x = 0; x < readWriteSet.polls.size(); ++x) {
+						if (shardMap.at(readWriteSet.indices.at(x))->connectState != connect_state::Connected &&
+							!shardMap.at(readWriteSet.indices.at(x))->processConnect(false)) {
+							returnData.emplace(readWriteSet.indices.at(x), shardMap.at(readWriteSet.indices.at(x)));
+						}
+					}
 					return returnData;
 				}
 				for (uint64_t x = 0; x < readWriteSet.polls.size(); ++x) {
+					if (shardMap.at(readWriteSet.indices.at(x))->connectState != connect_state::Connected) {
+						if (!shardMap.at(readWriteSet.indices.at(x))->processConnect(readWriteSet.polls.at(x).revents != 0)) {
+							returnData.emplace(readWriteSet.indices.at(x), shardMap.at(readWriteSet.indices.at(x)));
+						}
+						continue;
+					}
 					if (readWriteSet.polls.at(x).revents & POLLOUT || (POLLIN && shardMap.at(readWriteSet.indices.at(x))->writeWantRead)) {
 						if (!shardMap.at(readWriteSet.indices.at(x))->processWriteData()) {
 							shardMap.at(readWriteSet.indices.at(x))->currentStatus = connection_status::WRITE_Error;
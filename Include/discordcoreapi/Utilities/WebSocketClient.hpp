@@ -33,6 +33,7 @@
 #include <discordcoreapi/FoundationEntities.hpp>
 #include <discordcoreapi/Utilities/EventEntities.hpp>
 #include <discordcoreapi/Utilities/TCPConnection.hpp>
+#include <discordcoreapi/Utilities/ZlibDecompressor.hpp>
 #include <discordcoreapi/Utilities/Etf.hpp>
 #include <thread>
 
@@ -108,11 +109,154 @@ namespace discord_core_api {
 			}
 		};
 
+		/// @brief The dispatch events that could be sent by discord's websockets, from which gateway_event_type, gatewayEventNames and the dispatch switch in
+		/// websocket_client::onMessageReceived are all generated.
+		/// @details each entry is X(enumerator, event name, event data type, event_manager member, dispatch policy), where the dispatch policy is one of:
+		/// session, for events which websocket_client handles itself; listened, for events which are only parsed if something listens for them; always, for
+		/// events which are always parsed, since parsing them updates the caches; and always_with_shard, for always-parsed events which also need the shard.
+#define DCA_GATEWAY_EVENTS(X) \
+	X(Ready, "READY", void, void, session) \
+	X(Resumed, "RESUMED", void, void, session) \
+	X(Application_Command_Permissions_Update, "APPLICATION_COMMAND_PERMISSIONS_UPDATE", on_application_command_permissions_update_data, onApplicationCommandPermissionsUpdateEvent, listened) \
+	X(Auto_Moderation_Rule_Create, "AUTO_MODERATION_RULE_CREATE", on_auto_moderation_rule_creation_data, onAutoModerationRuleCreationEvent, listened) \
+	X(Auto_Moderation_Rule_Update, "AUTO_MODERATION_RULE_UPDATE", on_auto_moderation_rule_update_data, onAutoModerationRuleUpdateEvent, listened) \
+	X(Auto_Moderation_Rule_Delete, "AUTO_MODERATION_RULE_DELETE", on_auto_moderation_rule_deletion_data, onAutoModerationRuleDeletionEvent, listened) \
+	X(Auto_Moderation_Action_Execution, "AUTO_MODERATION_ACTION_EXECUTION", on_auto_moderation_action_execution_data, onAutoModerationActionExecutionEvent, listened) \
+	X(Channel_Create, "CHANNEL_CREATE", on_channel_creation_data, onChannelCreationEvent, always) \
+	X(Channel_Update, "CHANNEL_UPDATE", on_channel_update_data, onChannelUpdateEvent, always) \
+	X(Channel_Delete, "CHANNEL_DELETE", on_channel_deletion_data, onChannelDeletionEvent, always) \
+	X(Channel_Pins_Update, "CHANNEL_PINS_UPDATE", on_channel_pins_update_data, onChannelPinsUpdateEvent, listened) \
+	X(Thread_Create, "THREAD_CREATE", on_thread_creation_data, onThreadCreationEvent, listened) \
+	X(Thread_Update, "THREAD_UPDATE", on_thread_update_data, onThreadUpdateEvent, listened) \
+	X(Thread_Delete, "THREAD_DELETE", on_thread_deletion_data, onThreadDeletionEvent, listened) \
+	X(Thread_List_Sync, "THREAD_LIST_SYNC", on_thread_list_sync_data, onThreadListSyncEvent, listened) \
+	X(Thread_Member_Update, "THREAD_MEMBER_UPDATE", on_thread_member_update_data, onThreadMemberUpdateEvent, listened) \
+	X(Thread_Members_Update, "THREAD_MEMBERS_UPDATE", on_thread_members_update_data, onThreadMembersUpdateEvent, listened) \
+	X(Guild_Create, "GUILD_CREATE", on_guild_creation_data, onGuildCreationEvent, always) \
+	X(Guild_Update, "GUILD_UPDATE", on_guild_update_data, onGuildUpdateEvent, always) \
+	X(Guild_Delete, "GUILD_DELETE", on_guild_deletion_data, onGuildDeletionEvent, always) \
+	X(Guild_Ban_Add, "GUILD_BAN_ADD", on_guild_ban_add_data, onGuildBanAddEvent, listened) \
+	X(Guild_Ban_Remove, "GUILD_BAN_REMOVE", on_guild_ban_remove_data, onGuildBanRemoveEvent, listened) \
+	X(Guild_Emojis_Update, "GUILD_EMOJIS_UPDATE", on_guild_emojis_update_data, onGuildEmojisUpdateEvent, listened) \
+	X(Guild_Stickers_Update, "GUILD_STICKERS_UPDATE", on_guild_stickers_update_data, onGuildStickersUpdateEvent, listened) \
+	X(Guild_Integrations_Update, "GUILD_INTEGRATIONS_UPDATE", on_guild_integrations_update_data, onGuildIntegrationsUpdateEvent, listened) \
+	X(Guild_Member_Add, "GUILD_MEMBER_ADD", on_guild_member_add_data, onGuildMemberAddEvent, always) \
+	X(Guild_Member_Remove, "GUILD_MEMBER_REMOVE", on_guild_member_remove_data, onGuildMemberRemoveEvent, always) \
+	X(Guild_Member_Update, "GUILD_MEMBER_UPDATE", on_guild_member_update_data, onGuildMemberUpdateEvent, always) \
+	X(Guild_Members_Chunk, "GUILD_MEMBERS_CHUNK", on_guild_members_chunk_data, onGuildMembersChunkEvent, listened) \
+	X(Guild_Role_Create, "GUILD_ROLE_CREATE", on_role_creation_data, onRoleCreationEvent, always) \
+	X(Guild_Role_Update, "GUILD_ROLE_UPDATE", on_role_update_data, onRoleUpdateEvent, always) \
+	X(Guild_Role_Delete, "GUILD_ROLE_DELETE", on_role_deletion_data, onRoleDeletionEvent, always) \
+	X(Guild_Scheduled_Event_Create, "GUILD_SCHEDULED_EVENT_CREATE", on_guild_scheduled_event_creation_data, onGuildScheduledEventCreationEvent, listened) \
+	X(Guild_Scheduled_Event_Update, "GUILD_SCHEDULED_EVENT_UPDATE", on_guild_scheduled_event_update_data, onGuildScheduledEventUpdateEvent, listened) \
+	X(Guild_Scheduled_Event_Delete, "GUILD_SCHEDULED_EVENT_DELETE", on_guild_scheduled_event_deletion_data, onGuildScheduledEventDeletionEvent, listened) \
+	X(Guild_Scheduled_Event_User_Add, "GUILD_SCHEDULED_EVENT_USER_ADD", on_guild_scheduled_event_user_add_data, onGuildScheduledEventUserAddEvent, listened) \
+	X(Guild_Scheduled_Event_User_Remove, "GUILD_SCHEDULED_EVENT_USER_REMOVE", on_guild_scheduled_event_user_remove_data, onGuildScheduledEventUserRemoveEvent, listened) \
+	X(Integration_Create, "INTEGRATION_CREATE", on_integration_creation_data, onIntegrationCreationEvent, listened) \
+	X(Integration_Update, "INTEGRATION_UPDATE", on_integration_update_data, onIntegrationUpdateEvent, listened) \
+	X(Integration_Delete, "INTEGRATION_DELETE", on_integration_deletion_data, onIntegrationDeletionEvent, listened) \
+	X(Interaction_Create, "INTERACTION_CREATE", on_interaction_creation_data, onInteractionCreationEvent, always) \
+	X(Invite_Create, "INVITE_CREATE", on_invite_creation_data, onInviteCreationEvent, listened) \
+	X(Invite_Delete, "INVITE_DELETE", on_invite_deletion_data, onInviteDeletionEvent, listened) \
+	X(Message_Create, "MESSAGE_CREATE", on_message_creation_data, onMessageCreationEvent, always) \
+	X(Message_Update, "MESSAGE_UPDATE", on_message_update_data, onMessageUpdateEvent, always) \
+	X(Message_Delete, "MESSAGE_DELETE", on_message_deletion_data, onMessageDeletionEvent, listened) \
+	X(Message_Delete_Bulk, "MESSAGE_DELETE_BULK", on_message_delete_bulk_data, onMessageDeleteBulkEvent, listened) \
+	X(Message_Reaction_Add, "MESSAGE_REACTION_ADD", on_reaction_add_data, onReactionAddEvent, listened) \
+	X(Message_Reaction_Remove, "MESSAGE_REACTION_REMOVE", on_reaction_remove_data, onReactionRemoveEvent, listened) \
+	X(Message_Reaction_Remove_All, "MESSAGE_REACTION_REMOVE_ALL", on_reaction_remove_all_data, onReactionRemoveAllEvent, listened) \
+	X(Message_Reaction_Remove_Emoji, "MESSAGE_REACTION_REMOVE_EMOJI", on_reaction_remove_emoji_data, onReactionRemoveEmojiEvent, listened) \
+	X(Presence_Update, "PRESENCE_UPDATE", on_presence_update_data, onPresenceUpdateEvent, always) \
+	X(Stage_Instance_Create, "STAGE_INSTANCE_CREATE", on_stage_instance_creation_data, onStageInstanceCreationEvent, listened) \
+	X(Stage_Instance_Update, "STAGE_INSTANCE_UPDATE", on_stage_instance_update_data, onStageInstanceUpdateEvent, listened) \
+	X(Stage_Instance_Delete, "STAGE_INSTANCE_DELETE", on_stage_instance_deletion_data, onStageInstanceDeletionEvent, listened) \
+	X(Typing_Start, "TYPING_START", on_typing_start_data, onTypingStartEvent, listened) \
+	X(User_Update, "USER_UPDATE", on_user_update_data, onUserUpdateEvent, listened) \
+	X(Voice_State_Update, "VOICE_STATE_UPDATE", on_voice_state_update_data, onVoiceStateUpdateEvent, always_with_shard) \
+	X(Voice_Server_Update, "VOICE_SERVER_UPDATE", on_voice_server_update_data, onVoiceServerUpdateEvent, always_with_shard) \
+	X(Webhooks_Update, "WEBHOOKS_UPDATE", on_webhook_update_data, onWebhookUpdateEvent, listened)
+
+#define DCA_GATEWAY_EVENT_ENUMERATOR(enumerator, name, data_type, event, policy) enumerator,
+#define DCA_GATEWAY_EVENT_NAME(enumerator, name, data_type, event, policy) name,
+#define DCA_GATEWAY_EVENT_COUNT(enumerator, name, data_type, event, policy) +1
+
+		/// @brief The types of dispatch events that could be sent by discord's websockets.
+		enum class gateway_event_type : uint8_t {
+			Unknown = 0,///< Unrecognized event.
+			DCA_GATEWAY_EVENTS(DCA_GATEWAY_EVENT_ENUMERATOR)
+		};
+
+		/// @brief The number of gateway_event_types, including Unknown.
+		constexpr uint64_t gatewayEventCount{ 1 DCA_GATEWAY_EVENTS(DCA_GATEWAY_EVENT_COUNT) };
+
+		/// @brief The name of each dispatch event, indexed by its gateway_event_type.
+		constexpr std::array<jsonifier::string_view, gatewayEventCount> gatewayEventNames{ { "", DCA_GATEWAY_EVENTS(DCA_GATEWAY_EVENT_NAME) } };
+
+#undef DCA_GATEWAY_EVENT_ENUMERATOR
+#undef DCA_GATEWAY_EVENT_NAME
+#undef DCA_GATEWAY_EVENT_COUNT
+
+		/// @brief The number of slots in the dispatch event lookup table.
+		constexpr uint64_t gatewayEventTableSize{ 512 };
+
+		/// @brief Hashes a dispatch event's name into the lookup table, using a seeded fnv-1a hash.
+		/// @param data the event's name.
+		/// @param length the length of the event's name.
+		/// @param seed the seed to hash with.
+		/// @return the slot in the lookup table.
+		DCA_INLINE constexpr uint64_t hashGatewayEventName(const char* data, uint64_t length, uint64_t seed) {
+			uint64_t hash{ 0xcbf29ce484222325 ^ seed };
+			for (uint64_t x = 0; x < length; ++x) {
+				hash ^= static_cast<uint8_t>(data[x]);
+				hash *= 0x00000100000001B3;
+			}
+			return (hash ^ (hash >> 32)) & (gatewayEventTableSize - 1);
+		}
+
+		/// @brief Searches for a seed under which every dispatch event's name hashes into its own slot.
+		/// @return the first such seed.
+		DCA_INLINE constexpr uint64_t findGatewayEventSeed() {
+			for (uint64_t seed = 0;; ++seed) {
+				std::array<bool, gatewayEventTableSize> usedSlots{};
+				bool areWeCollisionFree{ true };
+				for (uint64_t x = 1; x < gatewayEventNames.size() && areWeCollisionFree; ++x) {
+					uint64_t slot	   = hashGatewayEventName(gatewayEventNames[x].data(), gatewayEventNames[x].size(), seed);
+					areWeCollisionFree = !usedSlots[slot];
+					usedSlots[slot]	   = true;
+				}
+				if (areWeCollisionFree) {
+					return seed;
+				}
+			}
+		}
+
+		/// @brief The seed of the dispatch event perfect hash, found at compile time.
+		constexpr uint64_t gatewayEventSeed{ findGatewayEventSeed() };
+
+		/// @brief Builds the dispatch event lookup table from gatewayEventNames.
+		/// @return the lookup table, with each event stored in the slot that its name hashes to.
+		DCA_INLINE constexpr std::array<gateway_event_type, gatewayEventTableSize> generateGatewayEventTable() {
+			std::array<gateway_event_type, gatewayEventTableSize> returnValue{};
+			for (uint64_t x = 1; x < gatewayEventNames.size(); ++x) {
+				returnValue[hashGatewayEventName(gatewayEventNames[x].data(), gatewayEventNames[x].size(), gatewayEventSeed)] = static_cast<gateway_event_type>(x);
+			}
+			return returnValue;
+		}
+
+		/// @brief The dispatch event lookup table.
+		constexpr std::array<gateway_event_type, gatewayEventTableSize> gatewayEventTable{ generateGatewayEventTable() };
+
+		/// @brief For converting the names of dispatch events into gateway_event_types.
 		class DiscordCoreAPI_Dll event_converter {
 		  public:
-			event_converter(const jsonifier::string& eventNew);
+			DCA_INLINE event_converter(jsonifier::string_view eventNew) : eventValue{ eventNew } {};
 
-			operator uint64_t();
+			/// @brief Looks up the event's type with a single hash and a single string comparison.
+			/// @return the event's type, or gateway_event_type::Unknown.
+			DCA_INLINE operator gateway_event_type() const {
+				gateway_event_type returnValue{ gatewayEventTable[hashGatewayEventName(eventValue.data(), eventValue.size(), gatewayEventSeed)] };
+				return gatewayEventNames[static_cast<uint64_t>(returnValue)] == eventValue ? returnValue : gateway_event_type::Unknown;
+			}
 
 		  protected:
 			jsonifier::string_view eventValue{};
@@ -133,6 +277,171 @@ namespace discord_core_api {
 			Heartbeat_ACK		  = 11,///<sent in response to receiving a heartbeat to acknowledge that it has been received.
 		};
 
+		/// @brief Exception class for json envelope parsing errors.
+		struct json_envelope_error : public dca_exception {
+			/// @brief Constructs a json_envelope_error instance with a message and source location.
+			/// @param message the error message.
+			/// @param location the source location where the error occurred.
+			DCA_INLINE explicit json_envelope_error(const jsonifier::string_view& message, std::source_location location = std::source_location::current())
+				: dca_exception{ message, location } {};
+		};
+
+		/// @brief Class for reading the envelope of a json gateway payload, without tokenizing its "d" value.
+		class json_envelope_parser {
+		  public:
+			/// @brief Reads the op, s and t values of a payload, and locates its "d" value.
+			/// @param dataToParse the json payload to be parsed.
+			/// @param message the message to store the envelope's values in.
+			/// @return a view of the payload's "d" value, or "null" if it was absent.
+			DCA_INLINE static jsonifier::string_view_base<uint8_t> parseJsonEnvelope(jsonifier::string_view_base<uint8_t> dataToParse, websocket_message& message) {
+				const uint8_t* iter = dataToParse.data();
+				const uint8_t* end	= dataToParse.data() + dataToParse.size();
+				jsonifier::string_view_base<uint8_t> returnValue{ reinterpret_cast<const uint8_t*>("null"), 4 };
+				skipWhitespace(iter, end);
+				expectCharacter<'{'>(iter, end);
+				skipWhitespace(iter, end);
+				if (iter < end && *iter == '}') {
+					return returnValue;
+				}
+				while (iter < end) {
+					skipWhitespace(iter, end);
+					jsonifier::string_view key{ readString(iter, end) };
+					skipWhitespace(iter, end);
+					expectCharacter<':'>(iter, end);
+					skipWhitespace(iter, end);
+					const uint8_t* valueStart = iter;
+					if (key == "d") {
+						skipValue(iter, end);
+						returnValue = { valueStart, static_cast<uint64_t>(iter - valueStart) };
+					} else if (key == "op") {
+						int64_t value{};
+						if (readInteger(iter, end, value)) {
+							message.op = value;
+						}
+					} else if (key == "s") {
+						int64_t value{};
+						if (readInteger(iter, end, value)) {
+							message.s = value;
+						}
+					} else if (key == "t") {
+						if (iter < end && *iter == '"') {
+							message.t = jsonifier::string{ readString(iter, end) };
+						} else {
+							skipValue(iter, end);
+						}
+					} else {
+						skipValue(iter, end);
+					}
+					skipWhitespace(iter, end);
+					if (iter < end && *iter == ',') {
+						++iter;
+						continue;
+					}
+					expectCharacter<'}'>(iter, end);
+					break;
+				}
+				return returnValue;
+			}
+
+		  protected:
+			DCA_INLINE static bool isWhitespace(uint8_t value) {
+				return value == ' ' || value == '\n' || value == '\r' || value == '\t';
+			}
+
+			DCA_INLINE static void skipWhitespace(const uint8_t*& iter, const uint8_t* end) {
+				while (iter < end && isWhitespace(*iter)) {
+					++iter;
+				}
+			}
+
+			template<uint8_t value> DCA_INLINE static void expectCharacter(const uint8_t*& iter, const uint8_t* end) {
+				if (iter >= end || *iter != value) {
+					throw json_envelope_error{ "json_envelope_parser::expectCharacter() error: unexpected character in payload." };
+				}
+				++iter;
+			}
+
+			/// @brief Reads a string's contents, leaving any escape sequences untouched.
+			DCA_INLINE static jsonifier::string_view readString(const uint8_t*& iter, const uint8_t* end) {
+				expectCharacter<'"'>(iter, end);
+				const uint8_t* start = iter;
+				while (iter < end && *iter != '"') {
+					iter += (*iter == '\\') ? 2 : 1;
+				}
+				if (iter >= end) {
+					throw json_envelope_error{ "json_envelope_parser::readString() error: unterminated string in payload." };
+				}
+				jsonifier::string_view returnValue{ reinterpret_cast<const char*>(start), static_cast<uint64_t>(iter - start) };
+				++iter;
+				return returnValue;
+			}
+
+			/// @brief Reads an integer, treating null as an absent value.
+			DCA_INLINE static bool readInteger(const uint8_t*& iter, const uint8_t* end, int64_t& value) {
+				bool negative{ iter < end && *iter == '-' };
+				if (negative) {
+					++iter;
+				}
+				if (iter >= end || *iter < '0' || *iter > '9') {
+					skipValue(iter, end);
+					return false;
+				}
+				uint64_t valueNew{};
+				while (iter < end && *iter >= '0' && *iter <= '9') {
+					valueNew = valueNew * 10 + static_cast<uint64_t>(*iter - '0');
+					++iter;
+				}
+				value = negative ? -static_cast<int64_t>(valueNew) : static_cast<int64_t>(valueNew);
+				return true;
+			}
+
+			/// @brief Skips over a single value, tracking only nesting depth and string boundaries.
+			DCA_INLINE static void skipValue(const uint8_t*& iter, const uint8_t* end) {
+				if (iter >= end) {
+					throw json_envelope_error{ "json_envelope_parser::skipValue() error: read past end of payload." };
+				}
+				if (*iter == '"') {
+					readString(iter, end);
+					return;
+				}
+				if (*iter != '{' && *iter != '[') {
+					while (iter < end && *iter != ',' && *iter != '}' && *iter != ']' && !isWhitespace(*iter)) {
+						++iter;
+					}
+					return;
+				}
+				uint64_t depth{};
+				while (iter < end) {
+					switch (*iter) {
+						case '"': {
+							readString(iter, end);
+							continue;
+						}
+						case '{':
+							[[fallthrough]];
+						case '[': {
+							++depth;
+							break;
+						}
+						case '}':
+							[[fallthrough]];
+						case ']': {
+							if (--depth == 0) {
+								++iter;
+								return;
+							}
+							break;
+						}
+						default: {
+							break;
+						}
+					}
+					++iter;
+				}
+				throw json_envelope_error{ "json_envelope_parser::skipValue() error: unterminated value in payload." };
+			}
+		};
+
 		class websocket_core;
 
 		class DiscordCoreAPI_Dll websocket_tcpconnection : public tcp_connection<websocket_tcpconnection> {
@@ -206,6 +515,9 @@ namespace discord_core_api {
 
 			virtual void onClosed() = 0;
 
+			/// @brief Called once a message has been queued by sendMessage, so that whichever thread drives the connection's io can be woken to flush it.
+			virtual void onMessageQueued();
+
 			bool areWeConnected();
 
 			bool parseMessage();
@@ -216,7 +528,6 @@ namespace discord_core_api {
 
 		  protected:
 			stop_watch<milliseconds> heartBeatStopWatch{ 20000ms };
-			jsonifier::string_base<uint8_t> currentMessage{};
 			std::atomic<websocket_state> currentState{};
 			bool haveWeReceivedHeartbeatAck{ true };
 			std::atomic_bool areWeCollectingData{};
@@ -233,6 +544,8 @@ namespace discord_core_api {
 			bool areWeResuming{};
 		};
 
+		class base_socket_agent;
+
 		/// @brief A websocket client, for communication via a tcp-connection.
 		class DiscordCoreAPI_Dll websocket_client : public websocket_core {
 		  public:
@@ -262,19 +575,97 @@ namespace discord_core_api {
 
 			void onClosed() override;
 
+			void onMessageQueued() override;
+
 			virtual ~websocket_client();
 
 		  protected:
-			unordered_map<uint64_t, unbounded_message_block<voice_connection_data>*> voiceConnectionDataBufferMap{};
+			unordered_map<uint64_t, mpsc_message_block<voice_connection_data, 16>*> voiceConnectionDataBufferMap{};
+			unique_ptr<zlib_decompressor_wrapper> zlibDecompressor{};
 			voice_connection_data voiceConnectionData{};
 			jsonifier::string resumeUrl{};
 			jsonifier::string sessionId{};
 			std::atomic_bool* doWeQuit{};
+			base_socket_agent* agent{};///< The agent whose thread drives this shard's io.
 			bool serverUpdateCollected{};
 			bool stateUpdateCollected{};
 			snowflake userId{};
 		};
 
+#if defined(__linux__)
+		/// @brief A hashed timer wheel, which holds at most one pending timer per key, at a fixed tick granularity.
+		class timer_wheel {
+		  public:
+			static constexpr milliseconds tickInterval{ 100 };
+			static constexpr uint64_t slotCount{ 512 };
+
+			DCA_INLINE timer_wheel() : currentTickTime{ hrclock::now() } {};
+
+			/// @brief Schedules a key's timer, replacing any timer that is already pending for it.
+			/// @param key the key to be scheduled.
+			/// @param delay the time after which the timer should fire, rounded up to a whole tick.
+			DCA_INLINE void schedule(uint64_t key, milliseconds delay) {
+				int64_t tickCountNew{ (delay.count() + tickInterval.count() - 1) / tickInterval.count() };
+				uint64_t tickCount{ tickCountNew > 0 ? static_cast<uint64_t>(tickCountNew) : 1 };
+				uint64_t generation{ ++currentGeneration };
+				if (auto iter = generations.find(key); iter != generations.end()) {
+					iter->second = generation;
+				} else {
+					generations.emplace(key, generation);
+				}
+				slots[(currentSlot + tickCount) % slotCount].emplace_back(timer_entry{ key, (tickCount - 1) / slotCount, generation });
+			}
+
+			/// @brief Fires every timer whose tick has passed.
+			/// @tparam function_type the type of the function to be invoked.
+			/// @param function the function to be invoked with the key of each timer that fires, which may schedule further timers.
+			template<typename function_type> DCA_INLINE void advance(function_type&& function) {
+				auto currentTime = hrclock::now();
+				while (currentTickTime + tickInterval <= currentTime) {
+					currentTickTime += tickInterval;
+					currentSlot = (currentSlot + 1) % slotCount;
+					jsonifier::vector<timer_entry> entries{};
+					std::swap(entries, slots[currentSlot]);
+					for (auto& value: entries) {
+						if (value.rounds > 0) {
+							--value.rounds;
+							slots[currentSlot].emplace_back(value);
+						} else if (auto iter = generations.find(value.key); iter != generations.end() && iter->second == value.generation) {
+							generations.erase(value.key);
+							function(value.key);
+						}
+					}
+				}
+			}
+
+			/// @brief Collects the time until the next occupied slot's tick.
+			/// @param maximum the longest time to report.
+			/// @return the time until the next timer could fire, or the maximum if it is sooner.
+			DCA_INLINE milliseconds getTimeUntilNextTimer(milliseconds maximum) const {
+				for (uint64_t x = 1; x <= slotCount; ++x) {
+					if (!slots[(currentSlot + x) % slotCount].empty()) {
+						auto timeUntil = std::chrono::duration_cast<milliseconds>(currentTickTime + tickInterval * static_cast<int64_t>(x) - hrclock::now());
+						return timeUntil < milliseconds{} ? milliseconds{} : (timeUntil < maximum ? timeUntil : maximum);
+					}
+				}
+				return maximum;
+			}
+
+		  protected:
+			struct timer_entry {
+				uint64_t key{};
+				uint64_t rounds{};
+				uint64_t generation{};
+			};
+
+			std::array<jsonifier::vector<timer_entry>, slotCount> slots{};
+			unordered_map<uint64_t, uint64_t> generations{};///< The generation of each key's pending timer, so that replaced timers are skipped. keys leave once their timer fires.
+			hrclock::time_point currentTickTime{};
+			uint64_t currentGeneration{};///< Never reused, so that a replaced timer cannot match a key's later timer.
+			uint64_t currentSlot{};
+		};
+#endif
+
 		class DiscordCoreAPI_Dll base_socket_agent {
 		  public:
 			friend class discord_core_api::discord_core_client;
@@ -284,15 +675,38 @@ namespace discord_core_api {
 
 			void connect(websocket_client& value);
 
+			/// @brief Wakes the agent's thread, so that data queued on one of its shards from another thread is sent without delay.
+			void wake();
+
+			/// @brief Has the agent's thread reconnect a shard as soon as it may, whichever thread closed it.
+			/// @param key the shard that was closed.
+			void onShardClosed(uint64_t key);
+
 			~base_socket_agent();
 
 		  protected:
 			unordered_map<uint64_t, websocket_client> shardMap{};
 			std::deque<connection_package> connections{};
 			std::atomic_bool* doWeQuit{};
+#if defined(__linux__)
+			static constexpr uint64_t wakeKey{ std::numeric_limits<uint64_t>::max() };
+			unordered_map<uint64_t, uint32_t> pendingPasses{};///< Shards which were not drained by their last pass, with the events to service them for again.
+			unbounded_message_block<uint64_t> closedShards{};///< Shards closed since the last pass, which are to be reconnected.
+			timer_wheel timers{};
+			int32_t epollFd{ -1 };
+			int32_t wakeFd{ -1 };
+#endif
 			std::jthread taskThread{};
 
 			void run(std::stop_token);
+
+#if defined(__linux__)
+			void processEvents(milliseconds maximumWait);
+
+			uint32_t serviceConnection(websocket_client& value, uint32_t events);
+
+			void onTimer(uint64_t key);
+#endif
 		};
 
 	}// namespace
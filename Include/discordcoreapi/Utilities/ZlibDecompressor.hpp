@@ -0,0 +1,137 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// ZlibDecompressor.hpp - Header for the zlib-stream decompressor class.
+/// Oct 17, 2026
+/// https://discordcoreapi.com
+/// \file ZlibDecompressor.hpp
+#pragma once
+
+#include <discordcoreapi/FoundationEntities.hpp>
+#include <zlib.h>
+
+namespace discord_core_api {
+
+	namespace discord_core_internal {
+
+		/**
+		 * \addtogroup discord_core_internal
+		 * @{
+		 */
+
+		/// @brief The suffix that discord appends to the end of every complete zlib-stream message.
+		constexpr uint8_t zlibSuffix[]{ 0x00, 0x00, 0xff, 0xff };
+
+		/// @brief A wrapper class for a zlib inflate stream, for decompressing a websocket's zlib-stream transport.
+		struct zlib_decompressor_wrapper {
+			/// @brief Deleter for z_stream instances.
+			struct z_stream_deleter {
+				/// @brief Operator to end and destroy a z_stream instance.
+				/// @param other the z_stream pointer to be deleted.
+				DCA_INLINE void operator()(z_stream* other) {
+					if (other) {
+						inflateEnd(other);
+						delete other;
+						other = nullptr;
+					}
+				}
+			};
+
+			/// @brief Constructor for zlib_decompressor_wrapper. initializes the inflate stream.
+			DCA_INLINE zlib_decompressor_wrapper() {
+				ptr.reset(new z_stream{});
+				int32_t error = inflateInit(ptr.get());
+
+				// check for initialization errors
+				if (error != Z_OK) {
+					throw dca_exception{ "Failed to create the zlib decompressor, reason: " + jsonifier::string{ zError(error) } };
+				}
+			}
+
+			/// @brief Collects a frame of the zlib stream, and decompresses it once a complete message has been collected.
+			/// @param dataToDecompress the compressed frame.
+			/// @param dataOut the decompressed message, if one was completed.
+			/// @return whether or not a complete message was decompressed.
+			/// @throws dca_exception if decompression fails.
+			DCA_INLINE bool decompressData(jsonifier::string_view_base<uint8_t> dataToDecompress, jsonifier::string_view_base<uint8_t>& dataOut) {
+				jsonifier::string_view_base<uint8_t> dataToInflate{ dataToDecompress };
+
+				// collect partial messages until the suffix arrives
+				if (inputBuffer.size() > 0 || !haveSuffix(dataToDecompress)) {
+					auto oldSize = inputBuffer.size();
+					inputBuffer.resize(oldSize + dataToDecompress.size());
+					std::memcpy(inputBuffer.data() + oldSize, dataToDecompress.data(), dataToDecompress.size());
+					dataToInflate = jsonifier::string_view_base<uint8_t>{ inputBuffer.data(), inputBuffer.size() };
+					if (!haveSuffix(dataToInflate)) {
+						return false;
+					}
+				}
+
+				if (outputBuffer.size() < dataToInflate.size() * 4) {
+					outputBuffer.resize(dataToInflate.size() * 4);
+				}
+				ptr->next_in  = const_cast<uint8_t*>(dataToInflate.data());
+				ptr->avail_in = static_cast<uInt>(dataToInflate.size());
+				uint64_t currentSize{};
+				do {
+					if (currentSize == outputBuffer.size()) {
+						outputBuffer.resize(outputBuffer.size() * 2);
+					}
+					ptr->next_out  = outputBuffer.data() + currentSize;
+					ptr->avail_out = static_cast<uInt>(outputBuffer.size() - currentSize);
+					int32_t error  = inflate(ptr.get(), Z_SYNC_FLUSH);
+					// no progress with the input used up means that inflate needs more input, which is the end of this message. with input left, it is an error.
+					if (error == Z_BUF_ERROR && ptr->avail_in == 0) {
+						break;
+					} else if (error != Z_OK) {
+						inputBuffer.clear();
+						throw dca_exception{ "Failed to decompress a zlib-stream payload, reason: " + jsonifier::string{ zError(error) } };
+					}
+					currentSize = outputBuffer.size() - ptr->avail_out;
+				} while (ptr->avail_in > 0 || ptr->avail_out == 0);
+
+				inputBuffer.clear();
+				dataOut = jsonifier::string_view_base<uint8_t>{ outputBuffer.data(), currentSize };
+				return true;
+			}
+
+		  protected:
+			unique_ptr<z_stream, z_stream_deleter> ptr{};///< Unique pointer to the z_stream instance.
+			jsonifier::string_base<uint8_t> outputBuffer{};///< Buffer for decompressed messages.
+			jsonifier::string_base<uint8_t> inputBuffer{};///< Buffer for partially collected messages.
+
+			/// @brief Checks whether a buffer ends with the zlib-stream suffix.
+			/// @param data the buffer to check.
+			/// @return whether or not the suffix is present.
+			DCA_INLINE static bool haveSuffix(jsonifier::string_view_base<uint8_t> data) {
+				return data.size() >= std::size(zlibSuffix) && std::memcmp(data.data() + data.size() - std::size(zlibSuffix), zlibSuffix, std::size(zlibSuffix)) == 0;
+			}
+		};
+
+		/**@}*/
+
+	}
+
+}
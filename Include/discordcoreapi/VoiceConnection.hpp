@@ -311,7 +311,7 @@ namespace discord_core_api {
 
 	  protected:
 		std::atomic<voice_connection_state> connectionState{ voice_connection_state::Collecting_Init_Data };
-		unbounded_message_block<discord_core_internal::voice_connection_data> voiceConnectionDataBuffer{};
+		mpsc_message_block<discord_core_internal::voice_connection_data, 16> voiceConnectionDataBuffer{};
 		std::coroutine_handle<discord_core_api::co_routine<void, false>::promise_type> token{};
 		nanoseconds intervalCount{ static_cast<int64_t>(960.0l / 48000.0l * 1000000000.0l) };
 		std::atomic<voice_active_state> prevActiveState{ voice_active_state::stopped };
@@ -104,7 +104,7 @@ namespace discord_core_api {
 		}
 		workload.callStack = "application_commands::getGlobalApplicationCommandsAsync()";
 		jsonifier::vector<application_command_data> returnData{};
-		application_commands::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await application_commands::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -117,7 +117,7 @@ namespace discord_core_api {
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "application_commands::createGlobalApplicationCommandAsync()";
 		application_command_data returnData{};
-		application_commands::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await application_commands::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -128,7 +128,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/applications/" + dataPackage.applicationId + "/commands/" + dataPackage.commandId;
 		workload.callStack	   = "application_commands::getGlobalApplicationCommandAsync()";
 		application_command_data returnData{};
-		application_commands::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await application_commands::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -152,7 +152,7 @@ namespace discord_core_api {
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "application_commands::editGlobalApplicationCommandAsync()";
 		application_command_data returnData{};
-		application_commands::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await application_commands::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -174,7 +174,7 @@ namespace discord_core_api {
 		workload.workloadClass = discord_core_internal::https_workload_class::Delete;
 		workload.relativePath  = "/applications/" + dataPackage.applicationId + "/commands/" + commandId.operator jsonifier::string();
 		workload.callStack	   = "application_commands::deleteGlobalApplicationCommandAsync()";
-		application_commands::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await application_commands::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -187,7 +187,7 @@ namespace discord_core_api {
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "application_commands::bulkOverwriteGlobalApplicationCommandsAsync()";
 		jsonifier::vector<application_command_data> returnData{};
-		application_commands::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await application_commands::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -201,7 +201,7 @@ namespace discord_core_api {
 		}
 		workload.callStack = "application_commands::getGuildApplicationCommandsAsync()";
 		jsonifier::vector<application_command_data> returnData{};
-		application_commands::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await application_commands::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -215,7 +215,7 @@ namespace discord_core_api {
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "application_commands::createGuildApplicationCommandAsync()";
 		application_command_data returnData{};
-		application_commands::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await application_commands::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -226,7 +226,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/applications/" + dataPackage.applicationId + "/guilds/" + dataPackage.guildId + "/commands/" + dataPackage.commandId;
 		workload.callStack	   = "application_commands::getGuildApplicationCommandAsync()";
 		application_command_data returnData{};
-		application_commands::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await application_commands::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -250,7 +250,7 @@ namespace discord_core_api {
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "application_commands::editGuildApplicationCommandAsync()";
 		application_command_data returnData{};
-		application_commands::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await application_commands::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -272,7 +272,7 @@ namespace discord_core_api {
 		workload.workloadClass = discord_core_internal::https_workload_class::Delete;
 		workload.relativePath  = "/applications/" + dataPackage.applicationId + "/guilds/" + dataPackage.guildId + "/commands/" + commandId;
 		workload.callStack	   = "application_commands::deleteGuildApplicationCommandAsync()";
-		application_commands::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await application_commands::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -285,7 +285,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/applications/" + dataPackage.applicationId + "/guilds/" + dataPackage.guildId + "/commands";
 		workload.callStack	   = "application_commands::bulkOverwriteGuildApplicationCommandsAsync()";
 		jsonifier::vector<application_command_data> returnData{};
-		application_commands::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await application_commands::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -297,7 +297,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/applications/" + dataPackage.applicationId + "/guilds/" + dataPackage.guildId + "/commands/permissions";
 		workload.callStack	   = "application_commands::getGuildApplicationCommandPermissionsAsync()";
 		jsonifier::vector<guild_application_command_permissions_data> returnData{};
-		application_commands::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await application_commands::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -320,7 +320,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/applications/" + dataPackage.applicationId + "/guilds/" + dataPackage.guildId + "/commands/" + commandId + "/permissions";
 		workload.callStack	   = "application_commands::getApplicationCommandPermissionsAsync()";
 		guild_application_command_permissions_data returnData{};
-		application_commands::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await application_commands::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -345,7 +345,7 @@ namespace discord_core_api {
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "application_commands::editGuildApplicationCommandPermissionsAsync()";
 		guild_application_command_permissions_data returnData{};
-		application_commands::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await application_commands::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
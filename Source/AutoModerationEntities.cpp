@@ -62,7 +62,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/guilds/" + dataPackage.guildId + "/auto-moderation/rules";
 		workload.callStack	   = "auto_moderation_rules::listAutoModerationRulesForGuildAsync()";
 		jsonifier::vector<auto_moderation_rule_data> returnVector{};
-		auto_moderation_rules::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnVector);
+		co_await auto_moderation_rules::httpsClient->submitWorkloadAsync(std::move(workload), returnVector);
 		co_return std::move(returnVector);
 	}
 
@@ -73,7 +73,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/guilds/" + dataPackage.guildId + "/auto-moderation/rules/" + dataPackage.autoModerationRuleId.operator jsonifier::string();
 		workload.callStack	   = "auto_moderation_rules::getAutoModerationRuleAsync()";
 		auto_moderation_rule_data returnData{};
-		auto_moderation_rules::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await auto_moderation_rules::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -85,7 +85,7 @@ namespace discord_core_api {
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "auto_moderation_rules::createAutoModerationRuleAsync()";
 		auto_moderation_rule_data returnData{};
-		auto_moderation_rules::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await auto_moderation_rules::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -97,7 +97,7 @@ namespace discord_core_api {
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "auto_moderation_rules::modifyAutoModerationRuleAsync()";
 		auto_moderation_rule_data returnData{};
-		auto_moderation_rules::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await auto_moderation_rules::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -107,7 +107,7 @@ namespace discord_core_api {
 		workload.workloadClass = discord_core_internal::https_workload_class::Delete;
 		workload.relativePath  = "/guilds/" + dataPackage.guildId + "/auto-moderation/rules/" + dataPackage.autoModerationRuleId;
 		workload.callStack	   = "auto_moderation_rules::deleteAutoModerationRuleAsync()";
-		auto_moderation_rules::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await auto_moderation_rules::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -174,7 +174,7 @@ namespace discord_core_api {
 		return *this;
 	}
 
-	channel_cache_data::operator channel_data() {
+	channel_cache_data::operator channel_data() const {
 		channel_data returnData{};
 		returnData.managed				= getFlagValue(channel_flags::managed);
 		returnData.permissionOverwrites = permissionOverwrites;
@@ -218,6 +218,7 @@ namespace discord_core_api {
 	void channels::initialize(discord_core_internal::https_client* client, config_manager* configManagerNew) {
 		channels::doWeCacheChannelsBool = configManagerNew->doWeCacheChannels();
 		channels::httpsClient			= client;
+		channels::cache.setSnapshotReads(configManagerNew->doWeUseSnapshotReads());
 	}
 
 	co_routine<channel_data> channels::getChannelAsync(get_channel_data dataPackage) {
@@ -227,10 +228,10 @@ namespace discord_core_api {
 		workload.relativePath  = "/channels/" + dataPackage.channelId;
 		workload.callStack	   = "channels::getChannelAsync()";
 		channel_data data{ dataPackage.channelId };
-		if (cache.contains(data.id)) {
-			data = cache[data.id];
-		}
-		channels::httpsClient->submitWorkloadAndGetResult(std::move(workload), data);
+		cache.visit(data.id, [&](const channel_cache_data& value) {
+			data = value;
+		});
+		co_await channels::httpsClient->submitWorkloadAsync(std::move(workload), data);
 		if (doWeCacheChannelsBool) {
 			insertChannel(static_cast<channel_cache_data>(data));
 		}
@@ -238,13 +239,20 @@ namespace discord_core_api {
 	}
 
 	channel_cache_data channels::getCachedChannel(get_channel_data dataPackage) {
-		if (channels::cache.contains(dataPackage.channelId)) {
-			return cache[dataPackage.channelId];
+		channel_cache_data returnValue{};
+		if (channels::cache.visit(dataPackage.channelId, [&](const channel_cache_data& value) {
+				returnValue = value;
+			})) {
+			return returnValue;
 		} else {
 			return getChannelAsync(dataPackage).get();
 		}
 	}
 
+	cache_snapshot<channel_cache_data> channels::getCachedChannelSnapshot(get_channel_data dataPackage) {
+		return channels::cache.find(dataPackage.channelId);
+	}
+
 	co_routine<channel_data> channels::modifyChannelAsync(modify_channel_data dataPackage) {
 		discord_core_internal::https_workload_data workload{ discord_core_internal::https_workload_type::Patch_Channel };
 		co_await newThreadAwaitable<channel_data>();
@@ -256,10 +264,10 @@ namespace discord_core_api {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
 		channel_data data{ dataPackage.channelId };
-		if (cache.contains(data.id)) {
-			data = cache[data.id];
-		}
-		channels::httpsClient->submitWorkloadAndGetResult(std::move(workload), data);
+		cache.visit(data.id, [&](const channel_cache_data& value) {
+			data = value;
+		});
+		co_await channels::httpsClient->submitWorkloadAsync(std::move(workload), data);
 		if (doWeCacheChannelsBool) {
 			insertChannel(static_cast<channel_cache_data>(data));
 		}
@@ -275,7 +283,7 @@ namespace discord_core_api {
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
-		channels::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await channels::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -289,7 +297,7 @@ namespace discord_core_api {
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
-		channels::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await channels::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -300,7 +308,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/channels/" + dataPackage.channelId + "/invites";
 		workload.callStack	   = "channels::getChannelInvitesAsync()";
 		jsonifier::vector<invite_data> returnData{};
-		channels::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await channels::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -315,7 +323,7 @@ namespace discord_core_api {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
 		invite_data returnData{};
-		channels::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await channels::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -328,7 +336,7 @@ namespace discord_core_api {
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
-		channels::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await channels::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -340,7 +348,7 @@ namespace discord_core_api {
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "channels::followNewsChannelAsync()";
 		channel_data returnData{};
-		channels::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await channels::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -350,7 +358,7 @@ namespace discord_core_api {
 		workload.workloadClass = discord_core_internal::https_workload_class::Post;
 		workload.relativePath  = "/channels/" + dataPackage.channelId + "/typing";
 		workload.callStack	   = "channels::triggerTypingIndicatorAsync()";
-		channels::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await channels::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -361,7 +369,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/guilds/" + dataPackage.guildId + "/channels";
 		workload.callStack	   = "channels::getGuildChannelsAsync()";
 		jsonifier::vector<channel_data> returnData{};
-		channels::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await channels::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -376,7 +384,7 @@ namespace discord_core_api {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
 		channel_data returnData{};
-		channels::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await channels::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -390,7 +398,7 @@ namespace discord_core_api {
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
-		channels::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await channels::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -402,7 +410,7 @@ namespace discord_core_api {
 		workload.callStack	   = "channels::createDMChannelAsync()";
 		parser.serializeJson(dataPackage, workload.content);
 		channel_data returnData{};
-		channels::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await channels::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -413,7 +421,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/voice/regions";
 		workload.callStack	   = "channels::getVoiceRegionsAsync()";
 		jsonifier::vector<voice_region_data> returnData{};
-		channels::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await channels::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -425,7 +433,7 @@ namespace discord_core_api {
 		return channels::doWeCacheChannelsBool;
 	}
 
-	object_cache<channel_cache_data> channels::cache{};
+	entity_cache<channel_cache_data> channels::cache{};
 	discord_core_internal::https_client* channels::httpsClient{};
 	bool channels::doWeCacheChannelsBool{};
 }
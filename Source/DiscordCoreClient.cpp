@@ -120,6 +120,9 @@ namespace discord_core_api {
 		std::signal(SIGABRT, &signalHandler);
 		std::signal(SIGFPE, &signalHandler);
 		message_printer::initialize(configManager);
+		discord_core_internal::connection_settings::connectTimeout	 = configManager.getConnectTimeout();
+		discord_core_internal::connection_settings::handshakeTimeout = configManager.getHandshakeTimeout();
+		discord_core_internal::connection_settings::writePolicy		 = configManager.getWritePolicy();
 		if (!discord_core_internal::ssl_context_holder::initialize()) {
 			message_printer::printError<print_message_type::general>("Failed to initialize the SSL_CTX structure!");
 			return;
@@ -192,6 +195,23 @@ namespace discord_core_api {
 		return std::chrono::duration_cast<milliseconds>(sys_clock::now().time_since_epoch()) - startupTimeSinceEpoch;
 	}
 
+	discord_core_internal::rate_limit_metrics discord_core_client::getRateLimitMetrics() {
+		return httpsClient->getRateLimitMetrics();
+	}
+
+	std::array<discord_core_internal::latency_histogram::snapshot, discord_core_internal::httpsLaneCount> discord_core_client::getLaneLatencies() {
+		return httpsClient->getLaneLatencies();
+	}
+
+	discord_core_internal::connection_metrics discord_core_client::getConnectionMetrics() {
+		discord_core_internal::connection_metrics returnValue{};
+		returnValue.dnsCacheHits	= discord_core_internal::dns_cache::hitCount.load(std::memory_order_relaxed);
+		returnValue.dnsCacheMisses	= discord_core_internal::dns_cache::missCount.load(std::memory_order_relaxed);
+		returnValue.resumedSessions = discord_core_internal::ssl_context_holder::resumedSessionCount.load(std::memory_order_relaxed);
+		returnValue.fullHandshakes	= discord_core_internal::ssl_context_holder::fullHandshakeCount.load(std::memory_order_relaxed);
+		return returnValue;
+	}
+
 	void discord_core_client::registerFunctionsInternal() {
 		if (getBotUser().id != 0) {
 			jsonifier::vector<application_command_data> theCommands{
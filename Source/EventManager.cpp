@@ -181,181 +181,103 @@ namespace jsonifier {
 
 namespace discord_core_api {
 
-	template<> unordered_map<jsonifier::string, unbounded_message_block<message_data>*> object_collector<message_data>::objectsBuffersMap;
+	template<> unordered_map<jsonifier::string, object_collector<message_data>*> object_collector<message_data>::objectCollectorsMap;
 
-	template<> unordered_map<jsonifier::string, unbounded_message_block<reaction_data>*> object_collector<reaction_data>::objectsBuffersMap;
+	template<> unordered_map<jsonifier::string, object_collector<reaction_data>*> object_collector<reaction_data>::objectCollectorsMap;
 
 	on_input_event_creation_data::on_input_event_creation_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_application_command_permissions_update_data::on_application_command_permissions_update_data(jsonifier::jsonifier_core<false>& parserNew,
 		jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_auto_moderation_rule_creation_data::on_auto_moderation_rule_creation_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_auto_moderation_rule_update_data::on_auto_moderation_rule_update_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_auto_moderation_rule_deletion_data::on_auto_moderation_rule_deletion_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_auto_moderation_action_execution_data::on_auto_moderation_action_execution_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_channel_creation_data::on_channel_creation_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 		if (channels::doWeCacheChannels()) {
 			channels::insertChannel(static_cast<channel_cache_data>(value));
 		}
 		if (guilds::doWeCacheGuilds()) {
-			if (guilds::getCache().contains(value.guildId)) {
-				guilds::getCache()[value.guildId].channels.emplace_back(value.id);
-			}
+			guilds::getEntityCache().modify(value.guildId, [&](guild_cache_data& guild) {
+				guild.channels.emplace_back(value.id);
+			});
 		}
 	}
 
 	on_channel_update_data::on_channel_update_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<updated_event_data*>(this), dataToParse);
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 		if (channels::doWeCacheChannels()) {
 			oldValue = channels::getCachedChannel({ .channelId = value.id });
 			channels::insertChannel(static_cast<channel_cache_data>(value));
 		}
+		permission_engine::updateChannel(value);
 	}
 
 	on_channel_deletion_data::on_channel_deletion_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 		if (channels::doWeCacheChannels()) {
 			channels::removeChannel(static_cast<channel_cache_data>(value));
 		}
 		if (guilds::doWeCacheGuilds()) {
-			if (guilds::getCache().contains(value.guildId)) {
-				for (uint64_t x = 0; x < guilds::getCache().operator[](value.guildId).channels.size(); ++x) {
-					if (guilds::getCache().operator[](value.guildId).channels.at(x) == static_cast<uint64_t>(value.id)) {
-						guilds::getCache().operator[](value.guildId).channels.erase(guilds::getCache().operator[](value.guildId).channels.begin() + static_cast<int64_t>(x));
+			guilds::getEntityCache().modify(value.guildId, [&](guild_cache_data& guild) {
+				for (uint64_t x = 0; x < guild.channels.size(); ++x) {
+					if (guild.channels.at(x) == static_cast<uint64_t>(value.id)) {
+						guild.channels.erase(guild.channels.begin() + static_cast<int64_t>(x));
 					}
 				}
-			}
+			});
 		}
+		permission_engine::removeChannel(value.guildId, value.id);
 	}
 
 	on_channel_pins_update_data::on_channel_pins_update_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_thread_creation_data::on_thread_creation_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_thread_update_data::on_thread_update_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_thread_deletion_data::on_thread_deletion_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_thread_list_sync_data::on_thread_list_sync_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_thread_member_update_data::on_thread_member_update_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_thread_members_update_data::on_thread_members_update_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_guild_creation_data::on_guild_creation_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 		if (guild_members::doWeCacheGuildMembers()) {
 			for (auto& valueNew: value.members) {
 				try {
@@ -413,23 +335,20 @@ namespace discord_core_api {
 		if (guilds::doWeCacheGuilds()) {
 			guilds::insertGuild(static_cast<guild_cache_data>(value));
 		}
+		permission_engine::seedGuild(value.id, value.ownerId, value.roles, value.channels);
 	}
 
 	on_guild_update_data::on_guild_update_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<updated_event_data*>(this), dataToParse);
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 		if (guilds::doWeCacheGuilds()) {
 			oldValue = guilds::getCachedGuild({ value.id });
 			guilds::insertGuild(static_cast<guild_cache_data>(value));
 		}
+		permission_engine::updateGuildOwner(value.id, value.ownerId);
 	}
 
 	on_guild_deletion_data::on_guild_deletion_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 		for (auto& valueNew: value.members) {
 			guild_members::removeGuildMember(valueNew);
 		}
@@ -442,179 +361,130 @@ namespace discord_core_api {
 		if (guilds::doWeCacheGuilds()) {
 			guilds::removeGuild(value);
 		}
+		permission_engine::removeGuild(value.id);
 	}
 
 	on_guild_ban_add_data::on_guild_ban_add_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
-		if (guilds::getCache().contains(value.guildId)) {
-			for (uint64_t x = 0; x < guilds::getCache().operator[](value.guildId).members.size(); ++x) {
-				if (guilds::getCache().operator[](value.guildId).members.at(x) == static_cast<uint64_t>(value.user.id)) {
-					guilds::getCache().operator[](value.guildId).members.erase(guilds::getCache().operator[](value.guildId).members.begin() + static_cast<int64_t>(x));
-					--guilds::getCache()[value.guildId].memberCount;
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
+		guilds::getEntityCache().modify(value.guildId, [&](guild_cache_data& guild) {
+			for (uint64_t x = 0; x < guild.members.size(); ++x) {
+				if (guild.members.at(x) == static_cast<uint64_t>(value.user.id)) {
+					guild.members.erase(guild.members.begin() + static_cast<int64_t>(x));
+					--guild.memberCount;
 				}
 			}
-		}
+		});
 	}
 
 	on_guild_ban_remove_data::on_guild_ban_remove_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_guild_emojis_update_data::on_guild_emojis_update_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
-		if (guilds::getCache().contains(value.guildId)) {
-			guilds::getCache()[value.guildId].emoji.clear();
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
+		guilds::getEntityCache().modify(value.guildId, [&](guild_cache_data& guild) {
+			guild.emoji.clear();
 			for (auto& valueNew: value.emojis) {
-				guilds::getCache()[value.guildId].emoji.emplace_back(valueNew.id);
+				guild.emoji.emplace_back(valueNew.id);
 			}
-		}
+		});
 	}
 
 	on_guild_stickers_update_data::on_guild_stickers_update_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_guild_integrations_update_data::on_guild_integrations_update_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_guild_member_add_data::on_guild_member_add_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 		if (guild_members::doWeCacheGuildMembers()) {
 			guild_members::insertGuildMember(static_cast<guild_member_cache_data>(value));
 		}
 		if (guilds::doWeCacheGuilds()) {
-			if (guilds::getCache().contains(value.guildId)) {
-				++guilds::getCache()[value.guildId].memberCount;
-				guilds::getCache()[value.guildId].members.emplace_back(value.user.id);
-			}
+			guilds::getEntityCache().modify(value.guildId, [&](guild_cache_data& guild) {
+				++guild.memberCount;
+				guild.members.emplace_back(value.user.id);
+			});
 		}
 	}
 
 	on_guild_member_remove_data::on_guild_member_remove_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 		if (guild_members::doWeCacheGuildMembers()) {
 			guild_member_data guildMember = guild_members::getCachedGuildMember({ .guildMemberId = value.user.id, .guildId = value.guildId });
 			guild_members::removeGuildMember(guildMember);
 		}
 		if (guilds::doWeCacheGuilds()) {
-			if (guilds::getCache().contains(value.guildId)) {
-				for (uint64_t x = 0; x < guilds::getCache().operator[](value.guildId).members.size(); ++x) {
-					if (guilds::getCache().operator[](value.guildId).members.at(x) == static_cast<uint64_t>(value.user.id)) {
-						guilds::getCache().operator[](value.guildId).members.erase(guilds::getCache().operator[](value.guildId).members.begin() + static_cast<int64_t>(x));
-						--guilds::getCache()[value.guildId].memberCount;
+			guilds::getEntityCache().modify(value.guildId, [&](guild_cache_data& guild) {
+				for (uint64_t x = 0; x < guild.members.size(); ++x) {
+					if (guild.members.at(x) == static_cast<uint64_t>(value.user.id)) {
+						guild.members.erase(guild.members.begin() + static_cast<int64_t>(x));
+						--guild.memberCount;
 					}
 				}
-			}
+			});
 		}
+		permission_engine::removeMember(value.guildId, value.user.id);
 	}
 
 	on_guild_member_update_data::on_guild_member_update_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<updated_event_data*>(this), dataToParse);
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 		if (guild_members::doWeCacheGuildMembers()) {
 			oldValue = guild_members::getCachedGuildMember({ .guildMemberId = value.user.id, .guildId = value.guildId });
 			guild_members::insertGuildMember(static_cast<guild_member_cache_data>(value));
 		}
+		permission_engine::updateMember(value.guildId, value.user.id, value.roles);
 	}
 
 	on_guild_members_chunk_data::on_guild_members_chunk_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_role_creation_data::on_role_creation_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 		if (roles::doWeCacheRoles()) {
 			roles::insertRole(static_cast<role_cache_data>(value.role));
 		}
 		if (guilds::doWeCacheGuilds()) {
-			if (guilds::getCache().contains(value.guildId)) {
-				guilds::getCache()[value.guildId].roles.emplace_back(value.role.id);
-			}
+			guilds::getEntityCache().modify(value.guildId, [&](guild_cache_data& guild) {
+				guild.roles.emplace_back(value.role.id);
+			});
 		}
+		permission_engine::updateRole(value.guildId, value.role.id, value.role.permissions.operator uint64_t());
 	}
 
 	on_role_update_data::on_role_update_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<updated_event_data*>(this), dataToParse);
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 		if (roles::doWeCacheRoles()) {
 			oldValue = roles::getCachedRole({ .guildId = value.guildId, .roleId = value.role.id });
 			roles::insertRole(static_cast<role_cache_data>(value.role));
 		}
+		permission_engine::updateRole(value.guildId, value.role.id, value.role.permissions.operator uint64_t());
 	}
 
 	on_role_deletion_data::on_role_deletion_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 		if (roles::doWeCacheRoles()) {
 			roles::removeRole(static_cast<role_cache_data>(value.role));
 		}
 		if (guilds::doWeCacheGuilds()) {
-			if (guilds::getCache().contains(value.guildId)) {
-				for (uint64_t x = 0; x < guilds::getCache().operator[](value.guildId).roles.size(); ++x) {
-					if (guilds::getCache().operator[](value.guildId).roles.at(x) == static_cast<uint64_t>(value.role.id)) {
-						guilds::getCache().operator[](value.guildId).roles.erase(guilds::getCache().operator[](value.guildId).roles.begin() + static_cast<int64_t>(x));
+			guilds::getEntityCache().modify(value.guildId, [&](guild_cache_data& guild) {
+				for (uint64_t x = 0; x < guild.roles.size(); ++x) {
+					if (guild.roles.at(x) == static_cast<uint64_t>(value.role.id)) {
+						guild.roles.erase(guild.roles.begin() + static_cast<int64_t>(x));
 					}
 				}
-			}
+			});
 		}
+		permission_engine::removeRole(value.guildId, value.role.id);
 	}
 
 	on_voice_server_update_data::on_voice_server_update_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse,
 		discord_core_internal::websocket_client* sslShard) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 		if (sslShard->areWeCollectingData.load(std::memory_order_acquire) && !sslShard->serverUpdateCollected && !sslShard->stateUpdateCollected) {
 			sslShard->voiceConnectionData		   = discord_core_internal::voice_connection_data{};
 			sslShard->voiceConnectionData.endPoint = value.endpoint;
@@ -624,7 +494,9 @@ namespace discord_core_api {
 			sslShard->voiceConnectionData.endPoint = value.endpoint;
 			sslShard->voiceConnectionData.token	   = value.token;
 			if (sslShard->voiceConnectionDataBufferMap.contains(value.guildId.operator const uint64_t&())) {
-				sslShard->voiceConnectionDataBufferMap[value.guildId.operator const uint64_t&()]->send(sslShard->voiceConnectionData);
+				if (!sslShard->voiceConnectionDataBufferMap[value.guildId.operator const uint64_t&()]->send(sslShard->voiceConnectionData)) {
+					message_printer::printError<print_message_type::websocket>("Voice connection data for guild " + value.guildId.operator jsonifier::string() + " was dropped, as its buffer is full.");
+				}
 			}
 			sslShard->areWeCollectingData.store(false, std::memory_order_release);
 			sslShard->serverUpdateCollected = false;
@@ -633,84 +505,39 @@ namespace discord_core_api {
 	};
 
 	on_guild_scheduled_event_creation_data::on_guild_scheduled_event_creation_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_guild_scheduled_event_update_data::on_guild_scheduled_event_update_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_guild_scheduled_event_deletion_data::on_guild_scheduled_event_deletion_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_guild_scheduled_event_user_add_data::on_guild_scheduled_event_user_add_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_guild_scheduled_event_user_remove_data::on_guild_scheduled_event_user_remove_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_integration_creation_data::on_integration_creation_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_integration_update_data::on_integration_update_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_integration_deletion_data::on_integration_deletion_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_interaction_creation_data::on_interaction_creation_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 		unique_ptr<input_event_data> eventData{ makeUnique<input_event_data>(value) };
 		switch (value.type) {
 			case interaction_type::Application_Command: {
@@ -789,151 +616,76 @@ namespace discord_core_api {
 	}
 
 	on_invite_creation_data::on_invite_creation_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_invite_deletion_data::on_invite_deletion_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_message_creation_data::on_message_creation_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
-		for (auto& [key, valueNew]: message_collector::objectsBuffersMap) {
-			valueNew->send(value);
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
+		for (auto& [key, valueNew]: message_collector::objectCollectorsMap) {
+			valueNew->deliver(value);
 		}
 	}
 
 	on_message_update_data::on_message_update_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
-		for (auto& [key, valueNew]: message_collector::objectsBuffersMap) {
-			valueNew->send(value);
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
+		for (auto& [key, valueNew]: message_collector::objectCollectorsMap) {
+			valueNew->deliver(value);
 		}
 	}
 
 	on_message_deletion_data::on_message_deletion_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_message_delete_bulk_data::on_message_delete_bulk_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_reaction_add_data::on_reaction_add_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
-		for (auto& [key, valueNew]: reaction_collector::objectsBuffersMap) {
-			valueNew->send(value);
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
+		for (auto& [key, valueNew]: reaction_collector::objectCollectorsMap) {
+			valueNew->deliver(value);
 		}
 	}
 
 	on_reaction_remove_data::on_reaction_remove_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_reaction_remove_all_data::on_reaction_remove_all_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_reaction_remove_emoji_data::on_reaction_remove_emoji_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_presence_update_data::on_presence_update_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_stage_instance_creation_data::on_stage_instance_creation_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_stage_instance_update_data::on_stage_instance_update_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_stage_instance_deletion_data::on_stage_instance_deletion_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_typing_start_data::on_typing_start_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_user_update_data::on_user_update_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<updated_event_data*>(this), dataToParse);
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 		oldValue = users::getCachedUser({ value.id });
 		if (users::doWeCacheUsers()) {
 			users::insertUser(static_cast<user_cache_data>(value));
@@ -942,12 +694,7 @@ namespace discord_core_api {
 
 	on_voice_state_update_data::on_voice_state_update_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse,
 		discord_core_internal::websocket_client* sslShard) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 		if (sslShard->areWeCollectingData.load(std::memory_order_acquire) && !sslShard->stateUpdateCollected && !sslShard->serverUpdateCollected &&
 			value.userId == sslShard->userId) {
 			sslShard->voiceConnectionData			= discord_core_internal::voice_connection_data{};
@@ -956,7 +703,9 @@ namespace discord_core_api {
 		} else if (sslShard->areWeCollectingData.load(std::memory_order_acquire) && !sslShard->stateUpdateCollected && value.userId == sslShard->userId) {
 			sslShard->voiceConnectionData.sessionId = value.sessionId;
 			if (sslShard->voiceConnectionDataBufferMap.contains(value.guildId.operator const uint64_t&())) {
-				sslShard->voiceConnectionDataBufferMap[value.guildId.operator const uint64_t&()]->send(std::move(sslShard->voiceConnectionData));
+				if (!sslShard->voiceConnectionDataBufferMap[value.guildId.operator const uint64_t&()]->send(std::move(sslShard->voiceConnectionData))) {
+					message_printer::printError<print_message_type::websocket>("Voice connection data for guild " + value.guildId.operator jsonifier::string() + " was dropped, as its buffer is full.");
+				}
 			}
 			sslShard->areWeCollectingData.store(false, std::memory_order_release);
 			sslShard->serverUpdateCollected = false;
@@ -970,21 +719,11 @@ namespace discord_core_api {
 	}
 
 	on_webhook_update_data::on_webhook_update_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	on_auto_complete_entry_data::on_auto_complete_entry_data(jsonifier::jsonifier_core<false>& parserNew, jsonifier::string_view_base<uint8_t> dataToParse) {
-		parserNew.parseJson<jsonifier::parse_options{ .partialRead = true }>(*static_cast<event_data*>(this), dataToParse);
-		if (auto result = parserNew.getErrors(); result.size() > 0) {
-			for (auto& valueNew: result) {
-				message_printer::printError<print_message_type::general>(valueNew.reportError());
-			}
-		}
+		discord_core_internal::parseGatewayData(parserNew, value, dataToParse);
 	}
 
 	discord_core_internal::event_delegate_token event_manager::onApplicationCommandsPermissionsUpdate(
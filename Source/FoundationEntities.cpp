@@ -78,6 +78,7 @@ namespace discord_core_api {
 				workloadClass	= other.workloadClass;
 				workloadType	= other.workloadType;
 				payloadType		= other.payloadType;
+				priority		= other.priority;
 			}
 			return *this;
 		}
@@ -88,6 +89,39 @@ namespace discord_core_api {
 
 		https_workload_data& https_workload_data::operator=(https_workload_type type) {
 			workloadType = type;
+			switch (type) {
+				case https_workload_type::Post_Interaction_Response:
+					[[fallthrough]];
+				case https_workload_type::Patch_Interaction_Response:
+					[[fallthrough]];
+				case https_workload_type::Delete_Interaction_Response:
+					[[fallthrough]];
+				case https_workload_type::Post_Followup_Message:
+					[[fallthrough]];
+				case https_workload_type::Patch_Followup_Message:
+					[[fallthrough]];
+				case https_workload_type::Delete_Followup_Message: {
+					priority = https_workload_priority::Critical;
+					break;
+				}
+				// Background requests are shed as the invalid-request budget runs low, so only reads and best-effort calls belong here.
+				case https_workload_type::Get_Guild_Audit_Logs:
+					[[fallthrough]];
+				case https_workload_type::Get_Guild_Members:
+					[[fallthrough]];
+				case https_workload_type::Get_Guild_Bans:
+					[[fallthrough]];
+				case https_workload_type::Get_Guild_Prune_Count:
+					[[fallthrough]];
+				case https_workload_type::Post_Trigger_Typing_Indicator: {
+					priority = https_workload_priority::Background;
+					break;
+				}
+				default: {
+					priority = https_workload_priority::Normal;
+					break;
+				}
+			}
 			return *this;
 		}
 
@@ -237,7 +237,7 @@ namespace discord_core_api {
 		return *this;
 	}
 
-	guild_cache_data::operator guild_data() {
+	guild_cache_data::operator guild_data() const {
 		guild_data returnData{};
 		returnData.voiceConnection = voiceConnection;
 		for (auto& value: channels) {
@@ -318,6 +318,7 @@ namespace discord_core_api {
 	void guilds::initialize(discord_core_internal::https_client* client, config_manager* configManagerNew) {
 		guilds::doWeCacheGuildsBool = configManagerNew->doWeCacheGuilds();
 		guilds::httpsClient			= client;
+		guilds::cache.setSnapshotReads(configManagerNew->doWeUseSnapshotReads());
 		stopWatchNew.reset();
 	}
 
@@ -355,7 +356,7 @@ namespace discord_core_api {
 		}
 		workload.callStack = "guilds::getAuditLogDataAsync()";
 		audit_log_data returnData{};
-		guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await guilds::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -367,15 +368,15 @@ namespace discord_core_api {
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "guilds::createGuildAsync()";
 		guild_data returnData{};
-		guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await guilds::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
 	jsonifier::vector<guild_data> guilds::getAllGuildsAsync() {
 		jsonifier::vector<guild_data> returnData{};
-		for (auto& value: guilds::cache) {
-			returnData.emplace_back(*value);
-		}
+		guilds::cache.forEach([&](const guild_cache_data& value) {
+			returnData.emplace_back(value);
+		});
 		return returnData;
 	}
 
@@ -387,10 +388,10 @@ namespace discord_core_api {
 		workload.callStack	   = "guilds::getGuildAsync()";
 		guild_data data{ dataPackage.guildId };
 		;
-		if (cache.contains(data.id)) {
-			data = cache[data.id];
-		}
-		guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), data);
+		cache.visit(data.id, [&](const guild_cache_data& value) {
+			data = value;
+		});
+		co_await guilds::httpsClient->submitWorkloadAsync(std::move(workload), data);
 		if (doWeCacheGuildsBool) {
 			insertGuild(static_cast<guild_cache_data>(data));
 		}
@@ -398,13 +399,20 @@ namespace discord_core_api {
 	}
 
 	guild_cache_data guilds::getCachedGuild(get_guild_data dataPackage) {
-		if (guilds::cache.contains(dataPackage.guildId)) {
-			return cache[dataPackage.guildId];
+		guild_cache_data returnValue{};
+		if (guilds::cache.visit(dataPackage.guildId, [&](const guild_cache_data& value) {
+				returnValue = value;
+			})) {
+			return returnValue;
 		} else {
 			return getGuildAsync(dataPackage).get();
 		}
 	}
 
+	cache_snapshot<guild_cache_data> guilds::getCachedGuildSnapshot(get_guild_data dataPackage) {
+		return guilds::cache.find(dataPackage.guildId);
+	}
+
 	co_routine<guild_preview_data> guilds::getGuildPreviewAsync(get_guild_preview_data dataPackage) {
 		discord_core_internal::https_workload_data workload{ discord_core_internal::https_workload_type::Get_Guild_Preview };
 		co_await newThreadAwaitable<guild_preview_data>();
@@ -412,7 +420,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/guilds/" + dataPackage.guildId + "/preview";
 		workload.callStack	   = "guilds::getGuildPreviewAsync()";
 		guild_preview_data returnData{};
-		guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await guilds::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -427,10 +435,10 @@ namespace discord_core_api {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
 		guild_data data{ dataPackage.guildId };
-		if (cache.contains(data.id)) {
-			data = cache[data.id];
-		}
-		guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), data);
+		cache.visit(data.id, [&](const guild_cache_data& value) {
+			data = value;
+		});
+		co_await guilds::httpsClient->submitWorkloadAsync(std::move(workload), data);
 		if (doWeCacheGuildsBool) {
 			insertGuild(static_cast<guild_cache_data>(data));
 		}
@@ -443,7 +451,7 @@ namespace discord_core_api {
 		workload.workloadClass = discord_core_internal::https_workload_class::Delete;
 		workload.relativePath  = "/guilds/" + dataPackage.guildId;
 		workload.callStack	   = "guilds::deleteGuildAsync()";
-		guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await guilds::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -470,7 +478,7 @@ namespace discord_core_api {
 		}
 		workload.callStack = "guilds::getGuildBansAsync()";
 		jsonifier::vector<ban_data> returnData{};
-		guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await guilds::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -481,7 +489,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/guilds/" + dataPackage.guildId + "/bans/" + dataPackage.userId;
 		workload.callStack	   = "guilds::getGuildBanAsync()";
 		ban_data data{};
-		guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), data);
+		co_await guilds::httpsClient->submitWorkloadAsync(std::move(workload), data);
 		co_return std::move(data);
 	}
 
@@ -495,7 +503,7 @@ namespace discord_core_api {
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
-		guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await guilds::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -508,7 +516,7 @@ namespace discord_core_api {
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
-		guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await guilds::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -539,7 +547,7 @@ namespace discord_core_api {
 			}
 		}
 		guild_prune_count_data returnData{};
-		guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await guilds::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -554,7 +562,7 @@ namespace discord_core_api {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
 		guild_prune_count_data returnData{};
-		guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await guilds::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -565,7 +573,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/guilds/" + dataPackage.guildId + "/regions";
 		workload.callStack	   = "guilds::getGuildVoiceRegionsAsync()";
 		jsonifier::vector<voice_region_data> returnData{};
-		guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await guilds::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -576,7 +584,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/guilds/" + dataPackage.guildId + "/invites";
 		workload.callStack	   = "guilds::getGuildInvitesAsync()";
 		jsonifier::vector<invite_data> returnData{};
-		guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await guilds::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 
 		co_return returnData;
 	}
@@ -588,7 +596,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/guilds/" + dataPackage.guildId + "/integrations";
 		workload.callStack	   = "guilds::getGuildIntegrationsAsync()";
 		jsonifier::vector<integration_data> returnData{};
-		guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await guilds::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -601,7 +609,7 @@ namespace discord_core_api {
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
-		guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await guilds::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -612,7 +620,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/guilds/" + dataPackage.guildId + "/widget";
 		workload.callStack	   = "guilds::getGuildWidgetSettingsAsync()";
 		guild_widget_data returnData{};
-		guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await guilds::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -627,7 +635,7 @@ namespace discord_core_api {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
 		guild_widget_data returnData{};
-		guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await guilds::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -638,7 +646,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/guilds/" + dataPackage.guildId + "/widget.json";
 		workload.callStack	   = "guilds::getGuildWidgetAsync()";
 		guild_widget_data returnData{};
-		guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await guilds::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -649,7 +657,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/guilds/" + dataPackage.guildId + "/vanity-url";
 		workload.callStack	   = "guilds::getGuildVanityInviteAsync()";
 		invite_data returnData{};
-		guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await guilds::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -682,7 +690,7 @@ namespace discord_core_api {
 		}
 		workload.callStack = "guilds::getGuildWidgetImageAsync()";
 		guild_widget_image_data returnData{};
-		guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await guilds::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -693,7 +701,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/guilds/" + dataPackage.guildId + "/welcome-screen";
 		workload.callStack	   = "guilds::getGuildWelcomeScreenAsync()";
 		welcome_screen_data returnData{};
-		guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await guilds::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -708,7 +716,7 @@ namespace discord_core_api {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
 		welcome_screen_data returnData{};
-		guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await guilds::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	};
 
@@ -719,7 +727,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/guilds/templates/" + dataPackage.templateCode;
 		workload.callStack	   = "guilds::getGuildTemplateAsync()";
 		guild_template_data returnData{};
-		guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await guilds::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -731,7 +739,7 @@ namespace discord_core_api {
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "guilds::createGuildFromGuildTemplateAsync()";
 		guild_data returnData{};
-		guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await guilds::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -742,7 +750,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/guilds/" + dataPackage.guildId + "/templates";
 		workload.callStack	   = "guilds::getGuildTemplatesAsync()";
 		jsonifier::vector<guild_template_data> returnData{};
-		guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await guilds::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -754,7 +762,7 @@ namespace discord_core_api {
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "guilds::createGuildTemplateAsync()";
 		guild_template_data returnData{};
-		guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await guilds::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -765,7 +773,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/guilds/" + dataPackage.guildId + "/templates/" + dataPackage.templateCode;
 		workload.callStack	   = "guilds::syncGuildTemplateAsync()";
 		guild_template_data returnData{};
-		guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await guilds::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -777,7 +785,7 @@ namespace discord_core_api {
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "guilds::modifyGuildTemplateAsync()";
 		guild_template_data returnData{};
-		guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await guilds::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -787,7 +795,7 @@ namespace discord_core_api {
 		workload.workloadClass = discord_core_internal::https_workload_class::Delete;
 		workload.relativePath  = "/guilds/" + dataPackage.guildId + "/templates/" + dataPackage.templateCode;
 		workload.callStack	   = "guilds::deleteGuildTemplateAsync()";
-		guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await guilds::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -815,7 +823,7 @@ namespace discord_core_api {
 
 		workload.callStack = "guilds::getInviteAsync()";
 		invite_data returnData{};
-		guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await guilds::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -828,7 +836,7 @@ namespace discord_core_api {
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
-		guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await guilds::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -855,7 +863,7 @@ namespace discord_core_api {
 		}
 		workload.callStack = "users::getCurrentUserGuildsAsync()";
 		jsonifier::vector<guild_data> returnData{};
-		guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await guilds::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -865,11 +873,15 @@ namespace discord_core_api {
 		workload.workloadClass = discord_core_internal::https_workload_class::Delete;
 		workload.relativePath  = "/users/@me/guilds/" + dataPackage.guildId;
 		workload.callStack	   = "guilds::leaveGuildAsync()";
-		guilds::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await guilds::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
 	object_cache<guild_cache_data>& guilds::getCache() {
+		return guilds::cache.getObjectCache();
+	}
+
+	entity_cache<guild_cache_data>& guilds::getEntityCache() {
 		return guilds::cache;
 	}
 
@@ -882,7 +894,7 @@ namespace discord_core_api {
 	}
 
 	discord_core_internal::https_client* guilds::httpsClient{};
-	object_cache<guild_cache_data> guilds::cache{};
+	entity_cache<guild_cache_data> guilds::cache{};
 	bool guilds::doWeCacheGuildsBool{};
 
 }
@@ -155,7 +155,214 @@ namespace discord_core_api {
 		*this = std::move(other);
 	}
 
+	void guild_member_store::emplace(const guild_member_cache_data& member) {
+		auto& shard = getShard(member.guildId);
+		std::unique_lock lock{ shard.storeMutex };
+		auto guildIter = shard.guilds.find(member.guildId);
+		if (guildIter == shard.guilds.end()) {
+			guildIter = shard.guilds.emplace(member.guildId, guild_member_columns{});
+		}
+		auto& columns = guildIter->second;
+		if (auto iter = columns.rowIndices.find(member.user.id); iter != columns.rowIndices.end()) {
+			writeRow(columns, iter->second, member);
+			return;
+		}
+		auto row = static_cast<uint32_t>(columns.userIds.size());
+		columns.rowIndices[member.user.id] = row;
+		columns.userIds.emplace_back(member.user.id);
+		columns.permissions.emplace_back();
+		columns.joinedAt.emplace_back();
+		columns.avatars.emplace_back();
+		columns.flags.emplace_back();
+		columns.roleOffsets.emplace_back();
+		columns.roleCounts.emplace_back();
+		columns.nickOffsets.emplace_back();
+		columns.nickLengths.emplace_back();
+		writeRow(columns, row, member);
+	}
+
+	bool guild_member_store::find(const two_id_key& key, guild_member_cache_data& member) {
+		auto& shard = getShard(key.idOne);
+		std::shared_lock lock{ shard.storeMutex };
+		auto guildIter = shard.guilds.find(key.idOne);
+		if (guildIter == shard.guilds.end()) {
+			return false;
+		}
+		auto& columns = guildIter->second;
+		auto rowIter  = columns.rowIndices.find(key.idTwo);
+		if (rowIter == columns.rowIndices.end()) {
+			return false;
+		}
+		auto row			  = rowIter->second;
+		member.permissionsVal = columns.permissions[row];
+		member.joinedAt		  = columns.joinedAt[row];
+		member.avatar		  = columns.avatars[row];
+		member.flags		  = columns.flags[row];
+		member.guildId		  = key.idOne;
+		member.user.id		  = key.idTwo;
+		member.roles.clear();
+		member.roles.reserve(columns.roleCounts[row]);
+		for (uint64_t x = 0; x < columns.roleCounts[row]; ++x) {
+			member.roles.emplace_back(columns.rolePool[columns.roleOffsets[row] + x]);
+		}
+		member.nick.resize(columns.nickLengths[row]);
+		std::memcpy(member.nick.data(), columns.nickPool.data() + columns.nickOffsets[row], columns.nickLengths[row]);
+		return true;
+	}
+
+	bool guild_member_store::contains(const two_id_key& key) {
+		auto& shard = getShard(key.idOne);
+		std::shared_lock lock{ shard.storeMutex };
+		auto guildIter = shard.guilds.find(key.idOne);
+		return guildIter != shard.guilds.end() && guildIter->second.rowIndices.contains(key.idTwo);
+	}
+
+	void guild_member_store::erase(const two_id_key& key) {
+		auto& shard = getShard(key.idOne);
+		std::unique_lock lock{ shard.storeMutex };
+		auto guildIter = shard.guilds.find(key.idOne);
+		if (guildIter == shard.guilds.end()) {
+			return;
+		}
+		auto& columns = guildIter->second;
+		if (auto rowIter = columns.rowIndices.find(key.idTwo); rowIter != columns.rowIndices.end()) {
+			eraseRow(columns, rowIter->second);
+			if (columns.userIds.size() == 0) {
+				shard.guilds.erase(key.idOne);
+			}
+		}
+	}
+
+	uint64_t guild_member_store::count() {
+		uint64_t returnValue{};
+		for (auto& shard: shards) {
+			std::shared_lock lock{ shard.storeMutex };
+			for (auto& [guildId, columns]: shard.guilds) {
+				returnValue += columns.userIds.size();
+			}
+		}
+		return returnValue;
+	}
+
+	uint64_t guild_member_store::getMemoryUsage() {
+		uint64_t returnValue{};
+		for (auto& shard: shards) {
+			std::shared_lock lock{ shard.storeMutex };
+			returnValue += shard.guilds.capacity() * sizeof(std::pair<snowflake, guild_member_columns>);
+			for (auto& [guildId, columns]: shard.guilds) {
+				returnValue += columns.rowIndices.capacity() * sizeof(std::pair<snowflake, uint32_t>);
+				returnValue += columns.flags.capacity() * sizeof(guild_member_flags);
+				returnValue += columns.roleOffsets.capacity() * sizeof(uint32_t);
+				returnValue += columns.nickOffsets.capacity() * sizeof(uint32_t);
+				returnValue += columns.permissions.capacity() * sizeof(uint64_t);
+				returnValue += columns.nickLengths.capacity() * sizeof(uint32_t);
+				returnValue += columns.roleCounts.capacity() * sizeof(uint32_t);
+				returnValue += columns.rolePool.capacity() * sizeof(snowflake);
+				returnValue += columns.avatars.capacity() * sizeof(icon_hash);
+				returnValue += columns.joinedAt.capacity() * sizeof(uint64_t);
+				returnValue += columns.userIds.capacity() * sizeof(snowflake);
+				returnValue += columns.nickPool.capacity();
+			}
+		}
+		return returnValue;
+	}
+
+	guild_member_store::store_shard& guild_member_store::getShard(snowflake guildId) {
+		return shards[key_accessor<snowflake>::getHashKey(guildId) >> (64 - std::countr_zero(shardCount))];
+	}
+
+	void guild_member_store::writeRow(guild_member_columns& columns, uint32_t row, const guild_member_cache_data& member) {
+		columns.permissions[row] = member.permissionsVal;
+		columns.joinedAt[row]	 = member.joinedAt;
+		columns.avatars[row]	 = member.avatar;
+		columns.flags[row]		 = member.flags;
+		auto roleCount			 = static_cast<uint32_t>(member.roles.size());
+		if (roleCount > columns.roleCounts[row]) {
+			columns.staleRoles += columns.roleCounts[row];
+			columns.rolePool.resize(columns.rolePool.size() + roleCount);
+			columns.roleOffsets[row] = static_cast<uint32_t>(columns.rolePool.size() - roleCount);
+		} else {
+			columns.staleRoles += columns.roleCounts[row] - roleCount;
+		}
+		for (uint64_t x = 0; x < roleCount; ++x) {
+			columns.rolePool[columns.roleOffsets[row] + x] = member.roles[x];
+		}
+		columns.roleCounts[row] = roleCount;
+		auto nickLength			= static_cast<uint32_t>(member.nick.size());
+		if (nickLength > columns.nickLengths[row]) {
+			columns.staleNickBytes += columns.nickLengths[row];
+			columns.nickPool.resize(columns.nickPool.size() + nickLength);
+			columns.nickOffsets[row] = static_cast<uint32_t>(columns.nickPool.size() - nickLength);
+		} else {
+			columns.staleNickBytes += columns.nickLengths[row] - nickLength;
+		}
+		std::memcpy(columns.nickPool.data() + columns.nickOffsets[row], member.nick.data(), nickLength);
+		columns.nickLengths[row] = nickLength;
+		compact(columns);
+	}
+
+	void guild_member_store::eraseRow(guild_member_columns& columns, uint32_t row) {
+		auto lastRow = static_cast<uint32_t>(columns.userIds.size() - 1);
+		columns.rowIndices.erase(columns.userIds[row]);
+		columns.staleNickBytes += columns.nickLengths[row];
+		columns.staleRoles	   += columns.roleCounts[row];
+		if (row != lastRow) {
+			columns.permissions[row] = columns.permissions[lastRow];
+			columns.roleOffsets[row] = columns.roleOffsets[lastRow];
+			columns.nickOffsets[row] = columns.nickOffsets[lastRow];
+			columns.nickLengths[row] = columns.nickLengths[lastRow];
+			columns.roleCounts[row]	 = columns.roleCounts[lastRow];
+			columns.joinedAt[row]	 = columns.joinedAt[lastRow];
+			columns.avatars[row]	 = columns.avatars[lastRow];
+			columns.userIds[row]	 = columns.userIds[lastRow];
+			columns.flags[row]		 = columns.flags[lastRow];
+			if (auto iter = columns.rowIndices.find(columns.userIds[row]); iter != columns.rowIndices.end()) {
+				iter->second = row;
+			}
+		}
+		columns.permissions.resize(lastRow);
+		columns.roleOffsets.resize(lastRow);
+		columns.nickOffsets.resize(lastRow);
+		columns.nickLengths.resize(lastRow);
+		columns.roleCounts.resize(lastRow);
+		columns.joinedAt.resize(lastRow);
+		columns.avatars.resize(lastRow);
+		columns.userIds.resize(lastRow);
+		columns.flags.resize(lastRow);
+		compact(columns);
+	}
+
+	void guild_member_store::compact(guild_member_columns& columns) {
+		if (columns.staleRoles >= compactionThreshold && columns.staleRoles * 2 >= columns.rolePool.size()) {
+			jsonifier::vector<snowflake> newRolePool{};
+			newRolePool.reserve(columns.rolePool.size() - columns.staleRoles);
+			for (uint64_t x = 0; x < columns.userIds.size(); ++x) {
+				auto newOffset = static_cast<uint32_t>(newRolePool.size());
+				for (uint64_t y = 0; y < columns.roleCounts[x]; ++y) {
+					newRolePool.emplace_back(columns.rolePool[columns.roleOffsets[x] + y]);
+				}
+				columns.roleOffsets[x] = newOffset;
+			}
+			columns.rolePool   = std::move(newRolePool);
+			columns.staleRoles = 0;
+		}
+		if (columns.staleNickBytes >= compactionThreshold && columns.staleNickBytes * 2 >= columns.nickPool.size()) {
+			jsonifier::string newNickPool{};
+			newNickPool.resize(columns.nickPool.size() - columns.staleNickBytes);
+			uint64_t newOffset{};
+			for (uint64_t x = 0; x < columns.userIds.size(); ++x) {
+				auto oldOffset		   = columns.nickOffsets[x];
+				columns.nickOffsets[x] = static_cast<uint32_t>(newOffset);
+				std::memcpy(newNickPool.data() + newOffset, columns.nickPool.data() + oldOffset, columns.nickLengths[x]);
+				newOffset += columns.nickLengths[x];
+			}
+			columns.nickPool	   = std::move(newNickPool);
+			columns.staleNickBytes = 0;
+		}
+	}
+
 	void guild_members::initialize(discord_core_internal::https_client* client, config_manager* configManagerNew) {
+		guild_members::doWeUseColumnarStoreBool	 = configManagerNew->doWeUseColumnarGuildMembers();
 		guild_members::doWeCacheGuildMembersBool = configManagerNew->doWeCacheGuildMembers();
 		guild_members::doWeCacheVoiceStatesBool	 = configManagerNew->doWeCacheVoiceStates();
 		guild_members::httpsClient				 = client;
@@ -171,10 +378,10 @@ namespace discord_core_api {
 		data.user.id = dataPackage.guildMemberId;
 		data.guildId = dataPackage.guildId;
 		two_id_key key{ data };
-		if (cache.contains(key)) {
-			data = cache[key];
+		if (guild_member_cache_data cachedMember{}; findGuildMember(key, cachedMember)) {
+			data = cachedMember;
 		}
-		guild_members::httpsClient->submitWorkloadAndGetResult(std::move(workload), data);
+		co_await guild_members::httpsClient->submitWorkloadAsync(std::move(workload), data);
 		if (doWeCacheGuildMembersBool) {
 			insertGuildMember(static_cast<guild_member_cache_data>(data));
 		}
@@ -186,8 +393,8 @@ namespace discord_core_api {
 		data.user.id = dataPackage.guildMemberId;
 		data.guildId = dataPackage.guildId;
 		two_id_key key{ data };
-		if (cache.contains(key)) {
-			return cache[key];
+		if (findGuildMember(key, data)) {
+			return data;
 		} else {
 			return getGuildMemberAsync(dataPackage).get();
 		}
@@ -208,7 +415,7 @@ namespace discord_core_api {
 		}
 		workload.callStack = "guild_members::listGuildMembersAsync()";
 		jsonifier::vector<guild_member_data> returnData{};
-		guild_members::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await guild_members::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -227,7 +434,7 @@ namespace discord_core_api {
 		}
 		workload.callStack = "guild_members::searchGuildMembersAsync()";
 		jsonifier::vector<guild_member_data> returnData{};
-		guild_members::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await guild_members::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -239,7 +446,7 @@ namespace discord_core_api {
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "guild_members::addGuildMemberAsync()";
 		guild_member_data returnData{};
-		guild_members::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await guild_members::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -254,7 +461,7 @@ namespace discord_core_api {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
 		guild_member_data returnData{};
-		guild_members::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await guild_members::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -283,11 +490,11 @@ namespace discord_core_api {
 		data.user.id = dataPackage.guildMemberId;
 		data.guildId = dataPackage.guildId;
 		two_id_key key{ data };
-		if (cache.contains(key)) {
-			data = cache[key];
+		if (guild_member_cache_data cachedMember{}; findGuildMember(key, cachedMember)) {
+			data = cachedMember;
 		}
 		try {
-			guild_members::httpsClient->submitWorkloadAndGetResult(std::move(workload), data);
+			co_await guild_members::httpsClient->submitWorkloadAsync(std::move(workload), data);
 		} catch (const std::runtime_error& error) {
 			std::cout << error.what() << std::endl;
 		}
@@ -306,7 +513,7 @@ namespace discord_core_api {
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
-		guild_members::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await guild_members::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -367,17 +574,31 @@ namespace discord_core_api {
 	}
 
 	voice_state_data_light guild_members::getVoiceStateData(const two_id_key& key) {
-		if (vsCache.contains(key)) {
-			return vsCache[key];
-		} else {
-			return {};
-		}
+		voice_state_data_light returnData{};
+		vsCache.visit(key, [&](const voice_state_data_light& value) {
+			returnData = value;
+		});
+		return returnData;
 	}
 
 	void guild_members::removeGuildMember(const two_id_key& key) {
-		cache.erase(key);
+		if (doWeUseColumnarStoreBool) {
+			memberStore.erase(key);
+		} else {
+			cache.erase(key);
+		}
 	};
 
+	bool guild_members::findGuildMember(const two_id_key& key, guild_member_cache_data& member) {
+		if (doWeUseColumnarStoreBool) {
+			return memberStore.find(key, member);
+		} else {
+			return cache.visit(key, [&](const guild_member_cache_data& value) {
+				member = value;
+			});
+		}
+	}
+
 	void guild_members::removeVoiceState(const two_id_key& key) {
 		vsCache.erase(key);
 	}
@@ -390,9 +611,32 @@ namespace discord_core_api {
 		return guild_members::doWeCacheVoiceStatesBool;
 	}
 
+	uint64_t guild_members::getCachedGuildMemberCount() {
+		return doWeUseColumnarStoreBool ? memberStore.count() : cache.count();
+	}
+
+	uint64_t guild_members::getCacheMemoryUsage() {
+		if (doWeUseColumnarStoreBool) {
+			return memberStore.getMemoryUsage();
+		}
+		uint64_t returnValue{};
+		for (auto& value: cache) {
+			auto memberStart = reinterpret_cast<const char*>(value.get());
+			returnValue		 += sizeof(unique_ptr<guild_member_cache_data>) + sizeof(guild_member_cache_data);
+			returnValue		 += value->roles.capacity() * sizeof(snowflake);
+			// Only count the nick if it lives outside of the object, rather than in its small-string buffer.
+			if (value->nick.data() < memberStart || value->nick.data() >= memberStart + sizeof(guild_member_cache_data)) {
+				returnValue += value->nick.capacity() + 1;
+			}
+		}
+		return returnValue;
+	}
+
 	object_cache<voice_state_data_light> guild_members::vsCache{};
 	object_cache<guild_member_cache_data> guild_members::cache{};
 	discord_core_internal::https_client* guild_members::httpsClient{};
+	guild_member_store guild_members::memberStore{};
 	bool guild_members::doWeCacheGuildMembersBool{};
+	bool guild_members::doWeUseColumnarStoreBool{};
 	bool guild_members::doWeCacheVoiceStatesBool{};
 };
@@ -64,7 +64,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/guilds/" + dataPackage.guildId + "/scheduled-events";
 		workload.callStack	   = "guild_scheduled_events::getGuildScheduledEventAsync()";
 		jsonifier::vector<guild_scheduled_event_data> returnData{};
-		guild_scheduled_events::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await guild_scheduled_events::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -76,7 +76,7 @@ namespace discord_core_api {
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "guild_scheduled_events::createGuildScheduledEventAsync()";
 		guild_scheduled_event_data returnData{};
-		guild_scheduled_events::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await guild_scheduled_events::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -91,7 +91,7 @@ namespace discord_core_api {
 		workload.relativePath += stream.str();
 		workload.callStack = "guild_scheduled_events::getGuildScheduledEventAsync()";
 		guild_scheduled_event_data returnData{};
-		guild_scheduled_events::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await guild_scheduled_events::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -103,7 +103,7 @@ namespace discord_core_api {
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "guild_scheduled_events::modifyGuildScheduledEventAsync()";
 		guild_scheduled_event_data returnData{};
-		guild_scheduled_events::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await guild_scheduled_events::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -113,7 +113,7 @@ namespace discord_core_api {
 		workload.workloadClass = discord_core_internal::https_workload_class::Delete;
 		workload.relativePath  = "/guilds/" + dataPackage.guildId + "/scheduled-events/" + dataPackage.guildScheduledEventId;
 		workload.callStack	   = "guild_scheduled_events::deleteGuildScheduledEventAsync()";
-		guild_scheduled_events::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await guild_scheduled_events::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -154,7 +154,7 @@ namespace discord_core_api {
 		}
 		workload.callStack = "guild_scheduled_events::getGuildScheduledEventUsersAsync()";
 		jsonifier::vector<guild_scheduled_event_user_data> returnData{};
-		guild_scheduled_events::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await guild_scheduled_events::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
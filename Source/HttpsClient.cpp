@@ -32,63 +32,138 @@
 #include <discordcoreapi/CoRoutine.hpp>
 #include <discordcoreapi/DiscordCoreClient.hpp>
 
+#if defined(__linux__)
+	#include <sys/eventfd.h>
+	#include <sys/epoll.h>
+#endif
+
 namespace discord_core_api {
 
 	namespace discord_core_internal {
 
 		DCA_INLINE void rate_limit_queue::initialize() {
+			std::unique_lock lock{ accessMutex };
 			for (int64_t enumOne = static_cast<int64_t>(https_workload_type::Unset); enumOne != static_cast<int64_t>(https_workload_type::Last); enumOne++) {
-				auto tempBucket = jsonifier::toString(std::chrono::duration_cast<nanoseconds>(sys_clock::now().time_since_epoch()).count());
-				buckets.emplace(static_cast<https_workload_type>(enumOne), tempBucket);
-				rateLimits.emplace(tempBucket, makeUnique<rate_limit_data>())
-					.getRawPtr()
-					->second->sampledTimeInMs.store(std::chrono::duration_cast<milliseconds>(sys_clock::now().time_since_epoch()));
-				std::this_thread::sleep_for(1ms);
+				buckets.emplace(static_cast<https_workload_type>(enumOne), "type-" + jsonifier::toString(enumOne));
 			}
+			lastEvictionTime = std::chrono::duration_cast<milliseconds>(sys_clock::now().time_since_epoch());
 		}
 
-		DCA_INLINE rate_limit_data* rate_limit_queue::getEndpointAccess(https_workload_type workloadType) {
-			stop_watch<milliseconds> stopWatch{ milliseconds{ 25000 } };
-			stopWatch.reset();
-			auto targetTime =
-				std::chrono::duration_cast<std::chrono::duration<int64_t, std::milli>>(rateLimits[buckets[workloadType]]->sampledTimeInMs.load(std::memory_order_acquire)) +
-				std::chrono::duration_cast<std::chrono::duration<int64_t, std::milli>>(rateLimits[buckets[workloadType]]->sRemain.load(std::memory_order_acquire));
-			if (rateLimits[buckets[workloadType]]->getsRemaining.load(std::memory_order_acquire) <= 0) {
-				auto newNow = std::chrono::duration_cast<std::chrono::duration<int64_t, std::milli>>(sys_clock::now().time_since_epoch());
-				while ((newNow - targetTime).count() <= 0) {
-					if (stopWatch.hasTimeElapsed()) {
-						return nullptr;
+		DCA_INLINE jsonifier::string_view rate_limit_queue::getMajorParameter(jsonifier::string_view relativePath) {
+			static constexpr jsonifier::string_view majorRoutes[]{ "/channels/", "/guilds/", "/webhooks/" };
+			for (auto& value: majorRoutes) {
+				if (relativePath.size() > value.size() && relativePath.substr(0, value.size()) == value) {
+					auto endPosition = relativePath.findFirstOf("/?", value.size());
+					if (value == "/webhooks/" && endPosition != jsonifier::string_view::npos && relativePath[endPosition] == '/') {
+						endPosition = relativePath.findFirstOf("/?", endPosition + 1);
+					}
+					if (endPosition == jsonifier::string_view::npos) {
+						endPosition = relativePath.size();
 					}
-					newNow = std::chrono::duration_cast<std::chrono::duration<int64_t, std::milli>>(sys_clock::now().time_since_epoch());
-					std::this_thread::sleep_for(1us);
+					return relativePath.substr(value.size(), endPosition - value.size());
 				}
 			}
-			stopWatch.reset();
-			while (!rateLimits[buckets[workloadType]]->accessMutex.try_lock()) {
-				std::this_thread::sleep_for(1us);
-				if (stopWatch.hasTimeElapsed()) {
-					return nullptr;
+			return {};
+		}
+
+		DCA_INLINE rate_limit_data* rate_limit_queue::acquireRateLimitData(https_workload_type workloadType, jsonifier::string_view majorParameter) {
+			{
+				std::shared_lock lock{ accessMutex };
+				auto key = buckets.at(workloadType) + ":" + majorParameter;
+				if (auto iter = rateLimits.find(key); iter != rateLimits.end()) {
+					iter->second->referenceCount.fetch_add(1, std::memory_order_acq_rel);
+					return iter->second.get();
+				}
+			}
+			std::unique_lock lock{ accessMutex };
+			auto currentTime = std::chrono::duration_cast<milliseconds>(sys_clock::now().time_since_epoch());
+			if (currentTime - lastEvictionTime >= evictionInterval) {
+				evictIdleBuckets(currentTime);
+			}
+			auto key  = buckets.at(workloadType) + ":" + majorParameter;
+			auto iter = rateLimits.find(key);
+			if (iter == rateLimits.end()) {
+				iter = rateLimits.emplace(key, makeUnique<rate_limit_data>());
+				iter->second->sampledTimeInMs.store(currentTime, std::memory_order_release);
+			}
+			iter->second->referenceCount.fetch_add(1, std::memory_order_acq_rel);
+			return iter->second.get();
+		}
+
+		DCA_INLINE void rate_limit_queue::evictIdleBuckets(milliseconds currentTime) {
+			jsonifier::vector<jsonifier::string> idleKeys{};
+			for (auto& [key, value]: rateLimits) {
+				if (value->referenceCount.load(std::memory_order_acquire) == 0 && currentTime - value->sampledTimeInMs.load(std::memory_order_acquire) >= bucketIdleTimeout) {
+					idleKeys.emplace_back(key);
+				}
+			}
+			for (auto& value: idleKeys) {
+				rateLimits.erase(value);
+			}
+			lastEvictionTime = currentTime;
+		}
+
+		DCA_INLINE rate_limit_data* rate_limit_queue::getEndpointAccess(https_workload_type workloadType, jsonifier::string_view majorParameter) {
+			static constexpr milliseconds maxWaitTime{ 25000 };
+			auto rateLimitData = acquireRateLimitData(workloadType, majorParameter);
+			if (rateLimitData->getsRemaining.load(std::memory_order_acquire) <= 0) {
+				milliseconds targetTime{ rateLimitData->sampledTimeInMs.load(std::memory_order_acquire) +
+					std::chrono::duration_cast<milliseconds>(rateLimitData->sRemain.load(std::memory_order_acquire)) };
+				auto timeRemaining = targetTime - std::chrono::duration_cast<milliseconds>(sys_clock::now().time_since_epoch());
+				if (timeRemaining.count() > 0) {
+					std::this_thread::sleep_for(std::min(timeRemaining, maxWaitTime));
+					if (timeRemaining > maxWaitTime) {
+						rateLimitData->referenceCount.fetch_sub(1, std::memory_order_acq_rel);
+						return nullptr;
+					}
 				}
 			}
-			return rateLimits.at(buckets.at(workloadType)).get();
+			if (!rateLimitData->acquire(maxWaitTime)) {
+				rateLimitData->referenceCount.fetch_sub(1, std::memory_order_acq_rel);
+				return nullptr;
+			}
+			return rateLimitData;
 		}
 
-		DCA_INLINE void rate_limit_queue::releaseEndPointAccess(https_workload_type type) {
-			rateLimits.at(buckets.at(type))->accessMutex.unlock();
+		DCA_INLINE milliseconds rate_limit_queue::tryGetEndpointAccess(rate_limit_data* rateLimitData) {
+			if (rateLimitData->getsRemaining.load(std::memory_order_acquire) <= 0) {
+				milliseconds targetTime{ rateLimitData->sampledTimeInMs.load(std::memory_order_acquire) +
+					std::chrono::duration_cast<milliseconds>(rateLimitData->sRemain.load(std::memory_order_acquire)) };
+				auto timeRemaining = targetTime - std::chrono::duration_cast<milliseconds>(sys_clock::now().time_since_epoch());
+				if (timeRemaining.count() >= 0) {
+					return std::max(timeRemaining, milliseconds{ 1 });
+				}
+			}
+			return rateLimitData->tryAcquire() ? milliseconds{} : milliseconds{ -1 };
 		}
 
-		jsonifier::vector<jsonifier::string_view> tokenize(jsonifier::string_view in, const char* sep = "\r\n") {
-			jsonifier::vector<jsonifier::string_view> result{};
-			jsonifier::string_view::size_type b = 0;
-			jsonifier::string_view::size_type e = 0;
-			while ((b = in.findFirstNotOf(sep, e)) != jsonifier::string_view::npos) {
-				e = in.findFirstOf(sep, b);
-				if (e == jsonifier::string_view::npos) {
-					break;
+		DCA_INLINE void rate_limit_queue::releaseEndPointAccess(https_workload_type workloadType, jsonifier::string_view majorParameter, rate_limit_data* rateLimitData) {
+			rateLimitData->release();
+			jsonifier::string bucket{};
+			{
+				std::unique_lock lock{ rateLimitData->accessMutex };
+				bucket = rateLimitData->bucket;
+			}
+			bool doWeRemap{};
+			if (!bucket.empty()) {
+				std::shared_lock lock{ accessMutex };
+				doWeRemap = buckets.at(workloadType) != bucket;
+			}
+			if (doWeRemap) {
+				std::unique_lock lock{ accessMutex };
+				buckets.find(workloadType)->second = bucket;
+				auto key = bucket + ":" + majorParameter;
+				if (!rateLimits.contains(key)) {
+					auto newRateLimitData = makeUnique<rate_limit_data>();
+					newRateLimitData->sampledTimeInMs.store(rateLimitData->sampledTimeInMs.load(std::memory_order_acquire), std::memory_order_release);
+					newRateLimitData->getsRemaining.store(rateLimitData->getsRemaining.load(std::memory_order_acquire), std::memory_order_release);
+					newRateLimitData->sRemain.store(rateLimitData->sRemain.load(std::memory_order_acquire), std::memory_order_release);
+					newRateLimitData->doWeWait.store(rateLimitData->doWeWait.load(std::memory_order_acquire), std::memory_order_release);
+					newRateLimitData->bucket = bucket;
+					rateLimits.emplace(key, std::move(newRateLimitData));
 				}
-				result.emplace_back(in.substr(b, e - b));
 			}
-			return result;
+			rateLimitData->referenceCount.fetch_sub(1, std::memory_order_acq_rel);
 		}
 
 		uint64_t parseCode(jsonifier::string_view string) {
@@ -97,12 +172,12 @@ namespace discord_core_api {
 				return 0;
 			}
 
-			while (std::isspace(string[start])) {
+			while (start < string.size() && std::isspace(static_cast<uint8_t>(string[start]))) {
 				start++;
 			}
 
 			uint64_t end = start;
-			while (std::isdigit(string[end])) {
+			while (end < string.size() && std::isdigit(static_cast<uint8_t>(string[end]))) {
 				end++;
 			}
 			jsonifier::string_view codeStr = string.substr(start, end - start);
@@ -119,28 +194,29 @@ namespace discord_core_api {
 			stopWatch.reset();
 			do {
 				stringNew = getInputBuffer();
-				inputBufferReal += stringNew;
 				switch (data.currentState) {
 					case https_state::Collecting_Headers: {
-						if (!parseHeaders()) {
-							return;
+						data.responseHeaders.headerBlock += stringNew;
+						if (parseHeaders()) {
+							if (data.currentState == https_state::Collecting_Contents) {
+								parseContents();
+							} else if (data.currentState == https_state::Collecting_Chunked_Contents) {
+								parseChunk();
+							}
 						}
 						break;
 					}
 					case https_state::Collecting_Contents: {
-						if (!parseContents()) {
-							return;
-						}
+						data.responseData += stringNew;
+						parseContents();
 						break;
 					}
 					case https_state::Collecting_Chunked_Contents: {
-						if (!parseChunk()) {
-							return;
-						}
+						data.responseData += stringNew;
+						parseChunk();
 						break;
 					}
 					case https_state::complete: {
-						inputBufferReal.clear();
 						return;
 					}
 				}
@@ -160,21 +236,21 @@ namespace discord_core_api {
 		void https_connection::resetValues(https_workload_data&& workloadDataNew, rate_limit_data* rateLimitDataNew) {
 			currentRateLimitData = rateLimitDataNew;
 			if (currentBaseUrl != workloadDataNew.baseUrl) {
-				tcp_connection::reset();
+				disconnect();
 				currentBaseUrl = workloadDataNew.baseUrl;
 			}
 			workload = std::move(workloadDataNew);
 			if (workload.baseUrl == "") {
 				workload.baseUrl = "https://discord.com/api/v10";
 			}
-			inputBufferReal.clear();
 			data = https_response_data{};
 		}
 
 		void https_rnr_builder::updateRateLimitData(rate_limit_data& rateLimitData) {
 			auto connection{ static_cast<https_connection*>(this) };
 			if (connection->data.responseHeaders.contains("x-ratelimit-bucket")) {
-				rateLimitData.bucket = connection->data.responseHeaders.at("x-ratelimit-bucket");
+				std::unique_lock lock{ rateLimitData.accessMutex };
+				rateLimitData.bucket = static_cast<jsonifier::string>(connection->data.responseHeaders.at("x-ratelimit-bucket"));
 			}
 			if (connection->data.responseHeaders.contains("x-ratelimit-reset-after")) {
 				rateLimitData.sRemain.store(seconds{ static_cast<int64_t>(ceil(jsonifier::strToDouble(connection->data.responseHeaders.at("x-ratelimit-reset-after").data()))) },
@@ -191,19 +267,6 @@ namespace discord_core_api {
 
 		https_response_data https_rnr_builder::finalizeReturnValues(rate_limit_data& rateLimitData) {
 			auto connection{ static_cast<https_connection*>(this) };
-			if (connection->data.responseData.size() >= connection->data.contentLength && connection->data.contentLength > 0) {
-				connection->data.responseData = connection->data.responseData.substr(0, connection->data.contentLength);
-			} else {
-				auto pos1 = connection->data.responseData.findFirstOf('{');
-				auto pos2 = connection->data.responseData.findLastOf('}');
-				auto pos3 = connection->data.responseData.findFirstOf('[');
-				auto pos4 = connection->data.responseData.findLastOf(']');
-				if (pos1 != jsonifier::string_view::npos && pos2 != jsonifier::string_view::npos && pos1 < pos3) {
-					connection->data.responseData = connection->data.responseData.substr(pos1, pos2 + 1);
-				} else if (pos3 != jsonifier::string_view::npos && pos4 != jsonifier::string_view::npos) {
-					connection->data.responseData = connection->data.responseData.substr(pos3, pos4 + 1);
-				}
-			}
 			updateRateLimitData(rateLimitData);
 			if (connection->data.responseCode != 204 && connection->data.responseCode != 200 && connection->data.responseCode != 201) {
 				throw dca_exception{ "Sorry, but that https request threw the following error: " + connection->data.responseCode.operator jsonifier::string() +
@@ -212,133 +275,197 @@ namespace discord_core_api {
 			return std::move(connection->data);
 		}
 
-		jsonifier::string https_rnr_builder::buildRequest(const https_workload_data& workload) {
-			jsonifier::string baseUrlNew{};
-			if (workload.baseUrl.find(".com") != jsonifier::string_view::npos) {
-				baseUrlNew = workload.baseUrl.substr(workload.baseUrl.find("https://") + jsonifier::string_view("https://").size(),
-					workload.baseUrl.find(".com") + jsonifier::string_view(".com").size() - jsonifier::string_view("https://").size());
-			} else if (workload.baseUrl.find(".org") != jsonifier::string_view::npos) {
-				baseUrlNew = workload.baseUrl.substr(workload.baseUrl.find("https://") + jsonifier::string_view("https://").size(),
-					workload.baseUrl.find(".org") + jsonifier::string_view(".org").size() - jsonifier::string_view("https://").size());
-			}
-			jsonifier::string returnString{};
-			if (workload.workloadClass == https_workload_class::Get || workload.workloadClass == https_workload_class::Delete) {
-				if (workload.workloadClass == https_workload_class::Get) {
-					returnString += "GET " + workload.baseUrl + workload.relativePath + " HTTP/1.1\r\n";
-				} else if (workload.workloadClass == https_workload_class::Delete) {
-					returnString += "DELETE " + workload.baseUrl + workload.relativePath + " HTTP/1.1\r\n";
-				}
-				for (auto& [key, value]: workload.headersToInsert) {
-					returnString += key + ": " + value + "\r\n";
-				}
-				returnString += "Pragma: no-cache\r\n";
-				returnString += "Connection: keep-alive\r\n";
-				returnString += "Host: " + baseUrlNew + "\r\n\r\n";
-			} else {
-				if (workload.workloadClass == https_workload_class::Patch) {
-					returnString += "PATCH " + workload.baseUrl + workload.relativePath + " HTTP/1.1\r\n";
-				} else if (workload.workloadClass == https_workload_class::Post) {
-					returnString += "POST " + workload.baseUrl + workload.relativePath + " HTTP/1.1\r\n";
-				} else if (workload.workloadClass == https_workload_class::Put) {
-					returnString = "PUT " + workload.baseUrl + workload.relativePath + " HTTP/1.1\r\n";
-				}
-				for (auto& [key, value]: workload.headersToInsert) {
-					returnString += key + ": " + value + "\r\n";
-				}
-				returnString += "Pragma: no-cache\r\n";
-				returnString += "Connection: keep-alive\r\n";
-				returnString += "Host: " + baseUrlNew + "\r\n";
-				returnString += "Content-Length: " + jsonifier::toString(workload.content.size()) + "\r\n\r\n";
-				returnString += workload.content + "\r\n\r\n";
+		static constexpr jsonifier::string_view requestLinePrefixes[]{ "GET ", "PUT ", "POST ", "PATCH ", "DELETE " };
+		static constexpr jsonifier::string_view requestLineSuffix{ " HTTP/1.1\r\n" };
+		static constexpr jsonifier::string_view requestFixedHeaders{ "Pragma: no-cache\r\nConnection: keep-alive\r\nHost: " };
+		static constexpr jsonifier::string_view contentLengthHeader{ "\r\nContent-Length: " };
+		static constexpr jsonifier::string_view headerTerminator{ "\r\n\r\n" };
+
+		jsonifier::string_view https_rnr_builder::buildRequest(const https_workload_data& workload, jsonifier::string_view precomputedHeaders) {
+			jsonifier::string_view host{};
+			jsonifier::string_view baseUrl{ workload.baseUrl };
+			auto schemeEnd = baseUrl.find("https://") + jsonifier::string_view("https://").size();
+			if (auto tld = baseUrl.find(".com"); tld != jsonifier::string_view::npos) {
+				host = baseUrl.substr(schemeEnd, tld + jsonifier::string_view(".com").size() - schemeEnd);
+			} else if (auto tld = baseUrl.find(".org"); tld != jsonifier::string_view::npos) {
+				host = baseUrl.substr(schemeEnd, tld + jsonifier::string_view(".org").size() - schemeEnd);
+			}
+			bool hasBody{ workload.workloadClass != https_workload_class::Get && workload.workloadClass != https_workload_class::Delete };
+			char contentLength[20]{};
+			jsonifier::string_view contentLengthView{};
+			if (hasBody) {
+				contentLengthView = jsonifier::string_view{ contentLength,
+					static_cast<uint64_t>(std::to_chars(contentLength, contentLength + std::size(contentLength), workload.content.size()).ptr - contentLength) };
+			}
+			auto requestLinePrefix = requestLinePrefixes[static_cast<uint64_t>(workload.workloadClass)];
+			uint64_t requestSize{ requestLinePrefix.size() + workload.baseUrl.size() + workload.relativePath.size() + requestLineSuffix.size() + precomputedHeaders.size() +
+				requestFixedHeaders.size() + host.size() + headerTerminator.size() };
+			for (auto& [key, value]: workload.headersToInsert) {
+				requestSize += key.size() + value.size() + 4;
 			}
-			return returnString;
+			if (hasBody) {
+				requestSize += contentLengthHeader.size() + contentLengthView.size() + workload.content.size();
+			}
+			requestBuffer.resize(requestSize);
+			char* writeHead{ requestBuffer.data() };
+			auto write = [&](jsonifier::string_view value) {
+				std::memcpy(writeHead, value.data(), value.size());
+				writeHead += value.size();
+			};
+			write(requestLinePrefix);
+			write(workload.baseUrl);
+			write(workload.relativePath);
+			write(requestLineSuffix);
+			write(precomputedHeaders);
+			for (auto& [key, value]: workload.headersToInsert) {
+				write(key);
+				write(": ");
+				write(value);
+				write("\r\n");
+			}
+			write(requestFixedHeaders);
+			write(host);
+			if (hasBody) {
+				write(contentLengthHeader);
+				write(contentLengthView);
+			}
+			write(headerTerminator);
+			// Nothing may follow the body, or a keep-alive server would read it as the start of the next request.
+			if (hasBody) {
+				write(workload.content);
+			}
+			return jsonifier::string_view{ requestBuffer.data(), requestSize };
 		}
 
 		bool https_rnr_builder::parseHeaders() {
 			auto connection{ static_cast<https_connection*>(this) };
-			jsonifier::string& stringViewNew = connection->inputBufferReal;
-			if (stringViewNew.find("\r\n\r\n") != jsonifier::string_view::npos) {
-				auto headers = tokenize(stringViewNew);
-				if (headers.size() && (headers.at(0).find("HTTP/1") != jsonifier::string_view::npos)) {
-					uint64_t parseCodeNew{};
-					try {
-						parseCodeNew = parseCode(headers.at(0));
-					} catch (const std::invalid_argument& error) {
-						message_printer::printError<print_message_type::https>(error.what());
-						connection->data.currentState = https_state::complete;
-					}
-					headers.erase(headers.begin());
-					if (headers.size() >= 3 && parseCodeNew) {
-						for (uint64_t x = 0; x < headers.size(); ++x) {
-							jsonifier::string_view::size_type sep = headers.at(x).find(": ");
-							if (sep != jsonifier::string_view::npos) {
-								jsonifier::string key		 = static_cast<jsonifier::string>(headers.at(x).substr(0, sep));
-								jsonifier::string_view value = headers.at(x).substr(sep + 2, headers.at(x).size());
-								for (auto& valueNew: key) {
-									valueNew = static_cast<char>(std::tolower(static_cast<int32_t>(valueNew)));
-								}
-								connection->data.responseHeaders.emplace(key, value);
-							}
-						}
-						connection->data.responseCode = parseCodeNew;
-						if (connection->data.responseCode == 302) {
-							connection->workload.baseUrl = connection->data.responseHeaders.at("location");
-							connection->disconnect();
-							return false;
-						}
-						if (connection->data.responseCode == 204) {
-							connection->data.currentState = https_state::complete;
-						} else if (connection->data.responseHeaders.contains("content-length")) {
-							connection->data.contentLength = jsonifier::strToUint64(connection->data.responseHeaders.at("content-length").data());
-							connection->data.currentState  = https_state::Collecting_Contents;
-						} else {
-							connection->data.isItChunked   = true;
-							connection->data.contentLength = std::numeric_limits<uint32_t>::max();
-							connection->data.currentState  = https_state::Collecting_Chunked_Contents;
-						}
-						connection->inputBufferReal.erase(connection->inputBufferReal.begin() + static_cast<int64_t>(stringViewNew.find("\r\n\r\n")) + 4);
+			auto& responseHeaders = connection->data.responseHeaders;
+			jsonifier::string_view headerBlock{ responseHeaders.headerBlock.data(), responseHeaders.headerBlock.size() };
+			auto headerEnd = headerBlock.find("\r\n\r\n", connection->data.headerScanOffset);
+			if (headerEnd == jsonifier::string_view::npos) {
+				connection->data.headerScanOffset = headerBlock.size() > 3 ? headerBlock.size() - 3 : 0;
+				return false;
+			}
+			auto statusLineEnd = headerBlock.find("\r\n");
+			auto parseCodeNew  = parseCode(headerBlock.substr(0, statusLineEnd));
+			if (headerBlock.substr(0, 5) != "HTTP/" || !parseCodeNew) {
+				message_printer::printError<print_message_type::https>("Failed to parse the status line of an https response.");
+				connection->data.currentState = https_state::complete;
+				return false;
+			}
+			for (uint64_t position = statusLineEnd + 2; position < headerEnd;) {
+				auto lineEnd   = headerBlock.find("\r\n", position);
+				auto separator = headerBlock.substr(position, lineEnd - position).find(':');
+				if (separator != jsonifier::string_view::npos) {
+					https_response_headers::header_offsets header{};
+					header.keyOffset = static_cast<uint32_t>(position);
+					header.keyLength = static_cast<uint32_t>(separator);
+					for (uint64_t x = position; x < position + separator; ++x) {
+						responseHeaders.headerBlock[x] = static_cast<char>(std::tolower(static_cast<uint8_t>(responseHeaders.headerBlock[x])));
 					}
+					uint64_t valueStart{ position + separator + 1 };
+					uint64_t valueEnd{ lineEnd };
+					while (valueStart < valueEnd && (headerBlock[valueStart] == ' ' || headerBlock[valueStart] == '\t')) {
+						++valueStart;
+					}
+					while (valueEnd > valueStart && (headerBlock[valueEnd - 1] == ' ' || headerBlock[valueEnd - 1] == '\t')) {
+						--valueEnd;
+					}
+					header.valueOffset = static_cast<uint32_t>(valueStart);
+					header.valueLength = static_cast<uint32_t>(valueEnd - valueStart);
+					responseHeaders.headers.emplace_back(header);
 				}
-				return true;
+				position = lineEnd + 2;
 			}
-			return false;
+			connection->data.responseData += headerBlock.substr(headerEnd + 4);
+			responseHeaders.headerBlock.resize(headerEnd + 2);
+			connection->data.responseCode = parseCodeNew;
+			if (connection->data.responseCode == 302) {
+				connection->workload.baseUrl = static_cast<jsonifier::string>(responseHeaders.at("location"));
+				connection->disconnect();
+				return false;
+			}
+			if (connection->data.responseCode == 204 || connection->data.responseCode == 304) {
+				connection->data.currentState = https_state::complete;
+			} else if (responseHeaders.contains("content-length") && !responseHeaders.contains("transfer-encoding")) {
+				connection->data.contentLength = jsonifier::strToUint64(responseHeaders.at("content-length").data());
+				connection->data.currentState  = https_state::Collecting_Contents;
+			} else {
+				connection->data.currentState = https_state::Collecting_Chunked_Contents;
+			}
+			return true;
 		}
 
 		bool https_rnr_builder::parseChunk() {
 			auto connection{ static_cast<https_connection*>(this) };
-			jsonifier::string_view stringViewNew01{ connection->inputBufferReal };
-			if (auto finalPosition = stringViewNew01.find("\r\n0\r\n\r\n"); finalPosition != jsonifier::string_view::npos) {
-				uint64_t pos{ 0 };
-				while (pos < stringViewNew01.size() || connection->data.responseData.size() < connection->data.contentLength) {
-					uint64_t lineEnd = stringViewNew01.find("\r\n", pos);
-					if (lineEnd == jsonifier::string_view::npos) {
+			auto& data = connection->data;
+			while (data.currentState != https_state::complete) {
+				jsonifier::string_view remaining{ data.responseData.data() + data.chunkReadOffset, data.responseData.size() - data.chunkReadOffset };
+				switch (data.chunkState) {
+					case https_chunk_state::Size_Line: {
+						auto lineEnd = remaining.find("\r\n");
+						if (lineEnd == jsonifier::string_view::npos) {
+							return false;
+						}
+						data.chunkRemaining = 0;
+						for (uint64_t x = 0; x < lineEnd && std::isxdigit(static_cast<uint8_t>(remaining[x])); ++x) {
+							auto digit			= static_cast<uint8_t>(std::tolower(static_cast<uint8_t>(remaining[x])));
+							data.chunkRemaining = data.chunkRemaining * 16 + (digit <= '9' ? digit - '0' : digit - 'a' + 10);
+						}
+						data.chunkReadOffset += lineEnd + 2;
+						data.chunkState = data.chunkRemaining > 0 ? https_chunk_state::Data : https_chunk_state::Trailers;
 						break;
 					}
-
-					jsonifier::string_view sizeLine{ stringViewNew01.data() + pos, lineEnd - pos };
-					uint64_t chunkSize = jsonifier::strToUint64<16>(static_cast<jsonifier::string>(sizeLine));
-					connection->data.contentLength += chunkSize;
-
-					if (chunkSize == 0) {
+					case https_chunk_state::Data: {
+						auto byteCount = std::min<uint64_t>(remaining.size(), data.chunkRemaining);
+						if (byteCount == 0) {
+							return false;
+						}
+						if (data.chunkWriteOffset != data.chunkReadOffset) {
+							std::memmove(data.responseData.data() + data.chunkWriteOffset, data.responseData.data() + data.chunkReadOffset, byteCount);
+						}
+						data.chunkWriteOffset += byteCount;
+						data.chunkReadOffset += byteCount;
+						data.chunkRemaining -= byteCount;
+						if (data.chunkRemaining == 0) {
+							data.chunkState = https_chunk_state::Data_Terminator;
+						}
+						break;
+					}
+					case https_chunk_state::Data_Terminator: {
+						if (remaining.size() < 2) {
+							return false;
+						}
+						data.chunkReadOffset += 2;
+						data.chunkState = https_chunk_state::Size_Line;
+						break;
+					}
+					case https_chunk_state::Trailers: {
+						auto lineEnd = remaining.find("\r\n");
+						if (lineEnd == jsonifier::string_view::npos) {
+							return false;
+						}
+						data.chunkReadOffset += lineEnd + 2;
+						if (lineEnd == 0) {
+							data.responseData.resize(data.chunkWriteOffset);
+							data.contentLength = data.chunkWriteOffset;
+							data.currentState  = https_state::complete;
+						}
 						break;
 					}
-
-					pos = lineEnd + 2;
-
-					jsonifier::string_view newString{ stringViewNew01.data() + pos, chunkSize };
-					connection->data.responseData += newString;
-					pos += chunkSize + 2;
 				}
-				connection->data.currentState = https_state::complete;
-				return true;
+				if (data.chunkReadOffset == data.responseData.size() && data.currentState != https_state::complete) {
+					data.responseData.resize(data.chunkWriteOffset);
+					data.chunkReadOffset = data.chunkWriteOffset;
+				}
 			}
-			return false;
+			return true;
 		}
 
 		bool https_rnr_builder::parseContents() {
 			auto connection{ static_cast<https_connection*>(this) };
-			if (connection->inputBufferReal.size() >= connection->data.contentLength || !connection->data.contentLength) {
-				connection->data.responseData += jsonifier::string_view{ connection->inputBufferReal.data(), connection->data.contentLength };
+			if (connection->data.responseData.size() >= connection->data.contentLength) {
+				connection->data.responseData.resize(connection->data.contentLength);
 				connection->data.currentState = https_state::complete;
 				return true;
 			} else {
@@ -354,47 +481,672 @@ namespace discord_core_api {
 			return *rateLimitQueue;
 		}
 
-		https_connection& https_connection_manager::getConnection(https_workload_type workloadType) {
+		bool https_connection_manager::canLease(uint64_t lane, https_workload_priority priority) const {
+			for (uint64_t x = lane + 1; x < httpsLaneCount; ++x) {
+				if (waitingRequestCounts[x] > 0) {
+					return false;
+				}
+			}
+			if (priority == https_workload_priority::Background && leasedConnectionCounts[lane] >= maxBackgroundConnectionCount) {
+				return false;
+			}
+			return idleConnections.size() > 0 || leasedConnectionCount < maxConnectionCount;
+		}
+
+		unique_ptr<https_connection> https_connection_manager::takeConnection(jsonifier::string_view baseUrl, uint64_t lane) {
+			unique_ptr<https_connection> returnValue{};
+			++leasedConnectionCounts[lane];
+			++leasedConnectionCount;
+			for (uint64_t x = idleConnections.size(); x > 0 && !returnValue; --x) {
+				if (idleConnections[x - 1]->currentBaseUrl == baseUrl) {
+					returnValue = std::move(idleConnections[x - 1]);
+					idleConnections.erase(idleConnections.begin() + static_cast<int64_t>(x - 1));
+				}
+			}
+			if (!returnValue && idleConnections.size() > 0) {
+				returnValue = std::move(idleConnections.back());
+				idleConnections.pop_back();
+			}
+			return returnValue;
+		}
+
+		void https_connection_manager::notifyWaiters() {
+			connectionReleased.notify_all();
 			std::unique_lock lock{ accessMutex };
-			if (!httpsConnections.contains(workloadType)) {
-				httpsConnections.emplace(workloadType, makeUnique<https_connection>());
+			if (ioReactor) {
+				ioReactor->wakeAll();
+			}
+		}
+
+		unique_ptr<https_connection> https_connection_manager::leaseConnection(jsonifier::string_view baseUrl, https_workload_priority priority) {
+			auto lane = static_cast<uint64_t>(priority);
+			unique_ptr<https_connection> returnValue{};
+			bool areLowerLanesWaiting{};
+			{
+				std::unique_lock lock{ accessMutex };
+				++waitingRequestCounts[lane];
+				connectionReleased.wait(lock, [&] {
+					return canLease(lane, priority);
+				});
+				--waitingRequestCounts[lane];
+				returnValue = takeConnection(baseUrl, lane);
+				for (uint64_t x = 0; x < lane; ++x) {
+					areLowerLanesWaiting = areLowerLanesWaiting || waitingRequestCounts[x] > 0;
+				}
+			}
+			if (areLowerLanesWaiting) {
+				notifyWaiters();
+			}
+			if (!returnValue) {
+				returnValue = makeUnique<https_connection>();
+			}
+			returnValue->currentReconnectTries = 0;
+			return returnValue;
+		}
+
+		unique_ptr<https_connection> https_connection_manager::tryLeaseConnection(jsonifier::string_view baseUrl, https_workload_priority priority, bool& isWaiting) {
+			auto lane = static_cast<uint64_t>(priority);
+			unique_ptr<https_connection> returnValue{};
+			bool areLowerLanesWaiting{};
+			{
+				std::unique_lock lock{ accessMutex };
+				if (!canLease(lane, priority)) {
+					if (!isWaiting) {
+						++waitingRequestCounts[lane];
+						isWaiting = true;
+					}
+					return returnValue;
+				}
+				if (isWaiting) {
+					--waitingRequestCounts[lane];
+					isWaiting = false;
+					for (uint64_t x = 0; x < lane; ++x) {
+						areLowerLanesWaiting = areLowerLanesWaiting || waitingRequestCounts[x] > 0;
+					}
+				}
+				returnValue = takeConnection(baseUrl, lane);
+			}
+			if (areLowerLanesWaiting) {
+				notifyWaiters();
+			}
+			if (!returnValue) {
+				returnValue = makeUnique<https_connection>();
+			}
+			returnValue->currentReconnectTries = 0;
+			return returnValue;
+		}
+
+		void https_connection_manager::cancelLease(https_workload_priority priority) {
+			{
+				std::unique_lock lock{ accessMutex };
+				--waitingRequestCounts[static_cast<uint64_t>(priority)];
+			}
+			notifyWaiters();
+		}
+
+		void https_connection_manager::releaseConnection(unique_ptr<https_connection>&& connection, https_workload_priority priority) {
+			{
+				std::unique_lock lock{ accessMutex };
+				--leasedConnectionCounts[static_cast<uint64_t>(priority)];
+				--leasedConnectionCount;
+				if (connection->areWeConnected()) {
+					idleConnections.emplace_back(std::move(connection));
+				}
 			}
-			httpsConnections.at(workloadType)->currentReconnectTries = 0;
-			return *httpsConnections.at(workloadType).get();
+			notifyWaiters();
 		}
 
-		https_connection_stack_holder::https_connection_stack_holder(https_connection_manager& connectionManager, https_workload_data&& workload) {
-			connection		   = &connectionManager.getConnection(workload.getWorkloadType());
-			rateLimitQueue = &connectionManager.getRateLimitQueue();
-			auto rateLimitData = connectionManager.getRateLimitQueue().getEndpointAccess(workload.getWorkloadType());
+		void https_connection_manager::recordLatency(https_workload_priority priority, nanoseconds latency) {
+			laneLatencies[static_cast<uint64_t>(priority)].record(latency);
+		}
+
+		https_connection_stack_holder::https_connection_stack_holder(https_connection_manager& connectionManagerNew, https_workload_data&& workload) {
+			connectionManager = &connectionManagerNew;
+			submissionTime	  = hrclock::now();
+			priority		  = workload.priority;
+			if (connectionManager->getRateLimitQueue().invalidRequests.shouldShed(priority)) {
+				throw dca_exception{ "Shed the request, as the invalid-request budget is nearly spent." };
+			}
+			majorParameter = rate_limit_queue::getMajorParameter(workload.relativePath);
+			workloadType   = workload.getWorkloadType();
+			rateLimitData  = connectionManager->getRateLimitQueue().getEndpointAccess(workloadType, majorParameter);
 			if (!rateLimitData) {
 				throw dca_exception{ "Failed to gain endpoint access." };
 			}
-			connection->resetValues(std::move(workload), rateLimitData);
-			if (!connection->areWeConnected()) {
-				*static_cast<tcp_connection<https_connection>*>(connection) = https_connection{ connection->workload.baseUrl, static_cast<uint16_t>(443) };
+			try {
+				connection = connectionManager->leaseConnection(workload.baseUrl, priority);
+				connection->resetValues(std::move(workload), rateLimitData);
+				if (!connection->areWeConnected()) {
+					*static_cast<tcp_connection<https_connection>*>(connection.get()) = https_connection{ connection->workload.baseUrl, static_cast<uint16_t>(443) };
+				}
+			} catch (...) {
+				if (connection) {
+					connectionManager->releaseConnection(std::move(connection), priority);
+				}
+				connectionManager->getRateLimitQueue().releaseEndPointAccess(workloadType, majorParameter, rateLimitData);
+				throw;
 			}
 		}
 
 		https_connection_stack_holder::~https_connection_stack_holder() {
-			rateLimitQueue->releaseEndPointAccess(connection->workload.getWorkloadType());
+			connectionManager->getRateLimitQueue().releaseEndPointAccess(workloadType, majorParameter, rateLimitData);
+			connectionManager->releaseConnection(std::move(connection), priority);
+			connectionManager->recordLatency(priority, hrclock::now() - submissionTime);
 		}
 
 		https_connection& https_connection_stack_holder::getConnection() {
 			return *connection;
 		}
 
+		https_async_request::https_async_request(https_connection_manager& connectionManagerNew, https_workload_data&& workloadNew) {
+			connectionManager = &connectionManagerNew;
+			priority		  = workloadNew.priority;
+			workload		  = std::move(workloadNew);
+		}
+
+		https_async_request::~https_async_request() {
+			if (rateLimitData) {
+				if (haveWeGainedAccess) {
+					connectionManager->getRateLimitQueue().releaseEndPointAccess(workloadType, majorParameter, rateLimitData);
+				} else {
+					rateLimitData->referenceCount.fetch_sub(1, std::memory_order_acq_rel);
+				}
+			}
+			if (isWaitingForConnection) {
+				connectionManager->cancelLease(priority);
+			}
+			if (connection) {
+				connectionManager->releaseConnection(std::move(connection), priority);
+			}
+			if (isSubmitted) {
+				connectionManager->recordLatency(priority, hrclock::now() - submissionTime);
+			}
+		}
+
+		https_io_reactor::https_io_reactor(https_client* clientNew) {
+			client = clientNew;
+			for (uint64_t x = 0; x < ioThreadCount; ++x) {
+				auto ioThread = makeUnique<io_thread>();
+#if defined(__linux__)
+				ioThread->epollFd = epoll_create1(EPOLL_CLOEXEC);
+				ioThread->wakeFd  = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+				epoll_event event{};
+				event.events   = EPOLLIN;
+				event.data.u64 = 0;
+				if (ioThread->epollFd == -1 || ioThread->wakeFd == -1 || epoll_ctl(ioThread->epollFd, EPOLL_CTL_ADD, ioThread->wakeFd, &event) == -1) {
+					message_printer::printError<print_message_type::https>(reportError("https_io_reactor::https_io_reactor()"));
+					if (ioThread->epollFd != -1) {
+						close(ioThread->epollFd);
+					}
+					if (ioThread->wakeFd != -1) {
+						close(ioThread->wakeFd);
+					}
+					continue;
+				}
+#endif
+				ioThread->thread = std::jthread([this, ioThreadRaw = ioThread.get()] {
+					run(*ioThreadRaw);
+				});
+				ioThreads.emplace_back(std::move(ioThread));
+			}
+		}
+
+		bool https_io_reactor::submit(https_async_request& request) {
+			if (ioThreads.size() == 0) {
+				return false;
+			}
+			auto& ioThread		= *ioThreads[nextThreadIndex.fetch_add(1, std::memory_order_relaxed) % ioThreads.size()];
+			request.isSubmitted = true;
+			{
+				std::unique_lock lock{ ioThread.accessMutex };
+				ioThread.pendingRequests.emplace_back(&request);
+			}
+#if defined(__linux__)
+			uint64_t value{ 1 };
+			[[maybe_unused]] auto result = write(ioThread.wakeFd, &value, sizeof(value));
+#else
+			ioThread.requestSubmitted.notify_one();
+#endif
+			return true;
+		}
+
+		void https_io_reactor::wakeAll() {
+			for (auto& value: ioThreads) {
+#if defined(__linux__)
+				uint64_t valueNew{ 1 };
+				[[maybe_unused]] auto result = write(value->wakeFd, &valueNew, sizeof(valueNew));
+#else
+				{
+					std::unique_lock lock{ value->accessMutex };
+					value->wasWoken = true;
+				}
+				value->requestSubmitted.notify_one();
+#endif
+			}
+		}
+
+		void https_io_reactor::run(io_thread& ioThread) {
+#if defined(__linux__)
+			static constexpr int32_t maxEventCount{ 64 };
+			std::array<epoll_event, maxEventCount> events{};
+			int32_t waitTimeInMs{ -1 };
+			while (!doWeQuit.load(std::memory_order_acquire)) {
+				auto eventCount = epoll_wait(ioThread.epollFd, events.data(), maxEventCount, waitTimeInMs);
+				if (eventCount == -1) {
+					if (errno != EINTR) {
+						message_printer::printError<print_message_type::https>(reportError("https_io_reactor::run()"));
+					}
+					eventCount = 0;
+				}
+				bool wasWoken{};
+				for (int32_t x = 0; x < eventCount; ++x) {
+					if (events[x].data.u64 == 0) {
+						uint64_t value{};
+						[[maybe_unused]] auto result = read(ioThread.wakeFd, &value, sizeof(value));
+						wasWoken					 = true;
+						continue;
+					}
+					if (auto iter = ioThread.liveRequests.find(events[x].data.u64); iter != ioThread.liveRequests.end()) {
+						serviceRequest(ioThread, *iter->second, events[x].events);
+					}
+				}
+				registerPendingRequests(ioThread);
+				if (wasWoken) {
+					retryParkedRequests(ioThread);
+				}
+				waitTimeInMs = fireTimers(ioThread);
+			}
+#else
+			while (!doWeQuit.load(std::memory_order_acquire)) {
+				auto waitTimeInMs = fireTimers(ioThread);
+				unordered_map<uint64_t, https_connection*> connections{};
+				for (auto& [key, value]: ioThread.liveRequests) {
+					if (value->watchedSocket != INVALID_SOCKET) {
+						connections.emplace(key, value->connection.get());
+					}
+				}
+				if (connections.size() == 0) {
+					std::unique_lock lock{ ioThread.accessMutex };
+					auto predicate = [&] {
+						return ioThread.pendingRequests.size() > 0 || ioThread.wasWoken || doWeQuit.load(std::memory_order_acquire);
+					};
+					if (waitTimeInMs == -1) {
+						ioThread.requestSubmitted.wait(lock, predicate);
+					} else {
+						ioThread.requestSubmitted.wait_for(lock, milliseconds{ waitTimeInMs }, predicate);
+					}
+				} else {
+					tcp_connection<https_connection>::processIO(connections);
+					for (auto& [key, value]: connections) {
+						if (auto iter = ioThread.liveRequests.find(key); iter != ioThread.liveRequests.end()) {
+							serviceRequest(ioThread, *iter->second, 0);
+						}
+					}
+				}
+				registerPendingRequests(ioThread);
+				bool wasWoken{};
+				{
+					std::unique_lock lock{ ioThread.accessMutex };
+					std::swap(wasWoken, ioThread.wasWoken);
+				}
+				if (wasWoken) {
+					retryParkedRequests(ioThread);
+				}
+			}
+#endif
+		}
+
+		void https_io_reactor::registerPendingRequests(io_thread& ioThread) {
+			std::vector<https_async_request*> pendingRequests{};
+			{
+				std::unique_lock lock{ ioThread.accessMutex };
+				std::swap(pendingRequests, ioThread.pendingRequests);
+			}
+			for (auto& value: pendingRequests) {
+				value->endpointDeadline = std::chrono::steady_clock::now() + milliseconds{ 25000 };
+				ioThread.liveRequests.emplace(reinterpret_cast<uint64_t>(value), value);
+				advanceRequest(ioThread, *value);
+			}
+		}
+
+		void https_io_reactor::retryParkedRequests(io_thread& ioThread) {
+			std::vector<uint64_t> parkedRequests{};
+			std::swap(parkedRequests, ioThread.parkedRequests);
+			for (auto& value: parkedRequests) {
+				if (auto iter = ioThread.liveRequests.find(value); iter != ioThread.liveRequests.end()) {
+					iter->second->isParked = false;
+					advanceRequest(ioThread, *iter->second);
+				}
+			}
+		}
+
+		int32_t https_io_reactor::fireTimers(io_thread& ioThread) {
+			while (ioThread.timers.size() > 0) {
+				auto timer		 = ioThread.timers.top();
+				auto currentTime = std::chrono::steady_clock::now();
+				if (timer.time > currentTime) {
+					return static_cast<int32_t>(std::chrono::ceil<milliseconds>(timer.time - currentTime).count());
+				}
+				ioThread.timers.pop();
+				if (auto iter = ioThread.liveRequests.find(timer.key); iter != ioThread.liveRequests.end() && iter->second->timerGeneration == timer.generation) {
+					advanceRequest(ioThread, *iter->second);
+				}
+			}
+			return -1;
+		}
+
+		void https_io_reactor::advanceRequest(io_thread& ioThread, https_async_request& request) {
+			while (true) {
+				switch (request.stage) {
+					case https_request_stage::Acquiring_Endpoint: {
+						if (!request.rateLimitData) {
+							request.rateLimitData = client->rateLimitQueue.acquireRateLimitData(request.workloadType, request.majorParameter);
+						}
+						auto timeRemaining = rate_limit_queue::tryGetEndpointAccess(request.rateLimitData);
+						if (timeRemaining.count() == 0) {
+							request.haveWeGainedAccess = true;
+							request.stage			   = https_request_stage::Leasing_Connection;
+							break;
+						}
+						auto currentTime = std::chrono::steady_clock::now();
+						if (currentTime >= request.endpointDeadline) {
+							failRequest(ioThread, request, "Failed to gain endpoint access.");
+							return;
+						}
+						if (timeRemaining.count() < 0) {
+							parkRequest(ioThread, request);
+							timeRemaining = milliseconds{ 50 };
+						}
+						scheduleTimer(ioThread, request, std::min<std::chrono::steady_clock::time_point>(currentTime + timeRemaining, request.endpointDeadline));
+						return;
+					}
+					case https_request_stage::Leasing_Connection: {
+						request.connection = client->connectionManager.tryLeaseConnection(request.workload.baseUrl, request.priority, request.isWaitingForConnection);
+						if (!request.connection) {
+							parkRequest(ioThread, request);
+							return;
+						}
+						request.connection->resetValues(std::move(request.workload), request.rateLimitData);
+						request.stage = https_request_stage::Waiting_On_Bucket;
+						break;
+					}
+					case https_request_stage::Waiting_On_Bucket: {
+						auto timeRemaining = client->getRateLimitDelay(*request.connection);
+						if (timeRemaining.count() > 0) {
+							message_printer::printSuccess<print_message_type::https>("we're waiting on rate-limit: " + jsonifier::toString(timeRemaining.count()));
+							scheduleTimer(ioThread, request, std::chrono::steady_clock::now() + timeRemaining);
+							return;
+						}
+						request.stage = https_request_stage::Waiting_On_Global_Limit;
+						break;
+					}
+					case https_request_stage::Waiting_On_Global_Limit: {
+						if (!request.hasGlobalToken && request.connection->workload.baseUrl == "https://discord.com/api/v10") {
+							request.hasGlobalToken = true;
+							auto readyTime		   = client->rateLimitQueue.globalRateLimiter.acquire();
+							if (readyTime > std::chrono::steady_clock::now()) {
+								scheduleTimer(ioThread, request, readyTime);
+								return;
+							}
+						}
+						request.hasGlobalToken = false;
+						request.stage		   = https_request_stage::Connecting;
+						break;
+					}
+					case https_request_stage::Connecting: {
+						auto& connection = *request.connection;
+						if (request.isConnecting) {
+							if (connection.areWeConnected() && connection.connectState != connect_state::Connected) {
+								connection.processConnect(false);
+							}
+							if (!connection.areWeConnected()) {
+								retryRequest(ioThread, request);
+								return;
+							}
+							if (connection.connectState != connect_state::Connected) {
+								if (!watchConnection(ioThread, request)) {
+									retryRequest(ioThread, request);
+									return;
+								}
+								scheduleTimer(ioThread, request, std::chrono::steady_clock::now() + (connection.connectDeadline - hrclock::now()));
+								return;
+							}
+							request.isConnecting = false;
+						} else {
+							if (connection.areWeConnected() && connection.connectState == connect_state::Connected) {
+								connection.processIO(0);
+							}
+							if (!connection.areWeConnected()) {
+								connection.currentBaseUrl									 = connection.workload.baseUrl;
+								*static_cast<tcp_connection<https_connection>*>(&connection) = https_connection{ connection.workload.baseUrl, static_cast<uint16_t>(443) };
+								if (connection.currentStatus != connection_status::NO_Error || !connection.areWeConnected()) {
+									retryRequest(ioThread, request);
+									return;
+								}
+								request.isConnecting = true;
+								break;
+							}
+						}
+						connection.data = https_response_data{};
+						connection.writeData(connection.buildRequest(connection.workload, client->getRequestHeaders(connection.workload)), true);
+						request.stage = https_request_stage::In_Flight;
+						if (!watchConnection(ioThread, request)) {
+							retryRequest(ioThread, request);
+						}
+						return;
+					}
+					case https_request_stage::In_Flight: {
+						auto& connection = *request.connection;
+						if (connection.data.currentState == https_state::complete) {
+							if (client->recordResponse(connection, connection.data)) {
+								unwatchConnection(ioThread, request);
+								connection.data = https_response_data{};
+								request.stage	= https_request_stage::Waiting_On_Bucket;
+								break;
+							}
+							completeRequest(ioThread, request);
+							return;
+						}
+						if (!connection.areWeConnected() || !watchConnection(ioThread, request)) {
+							retryRequest(ioThread, request);
+						}
+						return;
+					}
+					case https_request_stage::Complete: {
+						return;
+					}
+				}
+			}
+		}
+
+		void https_io_reactor::serviceRequest(io_thread& ioThread, https_async_request& request, [[maybe_unused]] uint32_t events) {
+			if (request.watchedSocket == INVALID_SOCKET) {
+				return;
+			}
+#if defined(__linux__)
+			auto& connection = *request.connection;
+			if (connection.connectState != connect_state::Connected) {
+				connection.processConnect(events != 0);
+			} else {
+				if (events & EPOLLOUT || (events & EPOLLIN && connection.writeWantRead)) {
+					if (!connection.processWriteData()) {
+						connection.currentStatus = connection_status::WRITE_Error;
+						connection.socket		 = INVALID_SOCKET;
+						connection.ssl			 = nullptr;
+					}
+				}
+				if (connection.areWeConnected() && (events & EPOLLIN || (events & EPOLLOUT && connection.readWantWrite))) {
+					if (!connection.processReadData()) {
+						connection.currentStatus = connection_status::READ_Error;
+						connection.socket		 = INVALID_SOCKET;
+						connection.ssl			 = nullptr;
+					}
+				}
+				if (connection.areWeConnected() && connection.data.currentState != https_state::complete && events & (EPOLLERR | EPOLLHUP)) {
+					connection.currentStatus = events & EPOLLERR ? connection_status::POLLERR_Error : connection_status::POLLHUP_Error;
+					connection.socket		 = INVALID_SOCKET;
+					connection.ssl			 = nullptr;
+				}
+			}
+#endif
+			advanceRequest(ioThread, request);
+		}
+
+		void https_io_reactor::scheduleTimer(io_thread& ioThread, https_async_request& request, std::chrono::steady_clock::time_point time) {
+			request.timerGeneration = ++ioThread.currentGeneration;
+			ioThread.timers.emplace(request_timer{ time, request.timerGeneration, reinterpret_cast<uint64_t>(&request) });
+		}
+
+		void https_io_reactor::parkRequest(io_thread& ioThread, https_async_request& request) {
+			if (!request.isParked) {
+				request.isParked = true;
+				ioThread.parkedRequests.emplace_back(reinterpret_cast<uint64_t>(&request));
+			}
+		}
+
+		bool https_io_reactor::watchConnection([[maybe_unused]] io_thread& ioThread, https_async_request& request) {
+			auto& connection = *request.connection;
+			auto socket		 = static_cast<SOCKET>(connection.socket);
+#if defined(__linux__)
+			uint32_t eventsNew{ EPOLLIN };
+			if (connection.connectState != connect_state::Connected) {
+				eventsNew = connection.getConnectEvents() == POLLOUT ? EPOLLOUT : EPOLLIN;
+			} else if (connection.writeWantWrite || connection.readWantWrite) {
+				eventsNew = EPOLLOUT;
+			} else if (!connection.writeWantRead && !connection.readWantRead && connection.hasPendingWrites()) {
+				eventsNew = EPOLLIN | EPOLLOUT;
+			}
+			if (request.watchedSocket == socket && request.events == eventsNew) {
+				return true;
+			}
+			epoll_event event{};
+			event.events   = eventsNew;
+			event.data.u64 = reinterpret_cast<uint64_t>(&request);
+			if (request.watchedSocket != socket || epoll_ctl(ioThread.epollFd, EPOLL_CTL_MOD, socket, &event) == -1) {
+				if (epoll_ctl(ioThread.epollFd, EPOLL_CTL_ADD, socket, &event) == -1) {
+					request.watchedSocket = INVALID_SOCKET;
+					return false;
+				}
+			}
+			request.events = eventsNew;
+#endif
+			request.watchedSocket = socket;
+			return true;
+		}
+
+		void https_io_reactor::unwatchConnection([[maybe_unused]] io_thread& ioThread, https_async_request& request) {
+#if defined(__linux__)
+			if (request.watchedSocket != INVALID_SOCKET && static_cast<SOCKET>(request.connection->socket) == request.watchedSocket) {
+				epoll_ctl(ioThread.epollFd, EPOLL_CTL_DEL, request.watchedSocket, nullptr);
+			}
+#endif
+			request.watchedSocket = INVALID_SOCKET;
+			request.events		  = 0;
+		}
+
+		void https_io_reactor::retryRequest(io_thread& ioThread, https_async_request& request) {
+			auto& connection = *request.connection;
+			unwatchConnection(ioThread, request);
+			request.isConnecting = false;
+			connection.disconnect();
+			if (connection.currentReconnectTries >= connection.maxReconnectTries) {
+				completeRequest(ioThread, request);
+				return;
+			}
+			++connection.currentReconnectTries;
+			request.stage = https_request_stage::Connecting;
+			scheduleTimer(ioThread, request, std::chrono::steady_clock::now() + 150ms);
+		}
+
+		void https_io_reactor::failRequest(io_thread& ioThread, https_async_request& request, jsonifier::string_view message) {
+			request.error = std::make_exception_ptr(dca_exception{ message });
+			completeRequest(ioThread, request);
+		}
+
+		void https_io_reactor::completeRequest(io_thread& ioThread, https_async_request& request) {
+			if (request.connection) {
+				unwatchConnection(ioThread, request);
+			}
+			request.stage = https_request_stage::Complete;
+			ioThread.liveRequests.erase(reinterpret_cast<uint64_t>(&request));
+			new_thread_awaiter_base::threadPool.submitTask(request.waiter);
+		}
+
+		https_io_reactor::~https_io_reactor() {
+			{
+				std::unique_lock lock{ client->connectionManager.accessMutex };
+				client->connectionManager.ioReactor = nullptr;
+			}
+			doWeQuit.store(true, std::memory_order_release);
+			for (auto& value: ioThreads) {
+#if defined(__linux__)
+				uint64_t valueNew{ 1 };
+				[[maybe_unused]] auto result = write(value->wakeFd, &valueNew, sizeof(valueNew));
+#else
+				{
+					std::unique_lock lock{ value->accessMutex };
+				}
+				value->requestSubmitted.notify_all();
+#endif
+				if (value->thread.joinable()) {
+					value->thread.join();
+				}
+#if defined(__linux__)
+				close(value->epollFd);
+				close(value->wakeFd);
+#endif
+			}
+		}
+
 		https_client::https_client(jsonifier::string_view botTokenNew) : https_client_core(botTokenNew), connectionManager(&rateLimitQueue) {
+			connectionManager.ioReactor = &ioReactor;
 			rateLimitQueue.initialize();
 		}
 
+		rate_limit_metrics https_client::getRateLimitMetrics() const {
+			return rateLimitQueue.getMetrics();
+		}
+
+		std::array<latency_histogram::snapshot, httpsLaneCount> https_client::getLaneLatencies() const {
+			std::array<latency_histogram::snapshot, httpsLaneCount> returnValue{};
+			for (uint64_t x = 0; x < httpsLaneCount; ++x) {
+				returnValue[x] = connectionManager.laneLatencies[x].getSnapshot();
+			}
+			return returnValue;
+		}
+
 		https_response_data https_client::httpsRequest(https_connection& connection) {
 			https_response_data resultData = executeByRateLimitData(connection);
 			return resultData;
 		}
 
 		https_response_data https_client::executeByRateLimitData(https_connection& connection) {
-			https_response_data returnData{};
+			waitOnRateLimits(connection);
+			https_response_data returnData = https_client::httpsRequestInternal(connection);
+			return processResponse(connection, std::move(returnData));
+		}
+
+		bool https_client::beginAsyncRequest(https_async_request& request, std::coroutine_handle<> waiter) {
+			if (rateLimitQueue.invalidRequests.shouldShed(request.priority)) {
+				request.error = std::make_exception_ptr(dca_exception{ "Shed the request, as the invalid-request budget is nearly spent." });
+				return false;
+			}
+			request.submissionTime = hrclock::now();
+			request.majorParameter = rate_limit_queue::getMajorParameter(request.workload.relativePath);
+			request.workloadType   = request.workload.getWorkloadType();
+			request.waiter		   = waiter;
+			return ioReactor.submit(request);
+		}
+
+		https_response_data https_client::completeAsyncRequest(https_async_request& request) {
+			auto& connection = *request.connection;
+			if (connection.data.currentState != https_state::complete) {
+				connection.disconnect();
+			}
+			return connection.finalizeReturnValues(*connection.currentRateLimitData);
+		}
+
+		milliseconds https_client::getRateLimitDelay(https_connection& connection) {
 			milliseconds timeRemaining{};
 			milliseconds currentTime = std::chrono::duration_cast<milliseconds>(sys_clock::now().time_since_epoch());
 			if (connection.workload.workloadType == https_workload_type::Delete_Message_Old) {
@@ -414,8 +1166,14 @@ namespace discord_core_api {
 				timeRemaining = targetTime - currentTime;
 				connection.currentRateLimitData->doWeWait.store(false, std::memory_order_release);
 			}
+			return timeRemaining;
+		}
+
+		void https_client::waitOnRateLimits(https_connection& connection) {
+			milliseconds timeRemaining = getRateLimitDelay(connection);
 			if (timeRemaining.count() > 0) {
 				message_printer::printSuccess<print_message_type::https>("we're waiting on rate-limit: " + jsonifier::toString(timeRemaining.count()));
+				milliseconds currentTime = std::chrono::duration_cast<milliseconds>(sys_clock::now().time_since_epoch());
 				milliseconds targetTime{ currentTime + timeRemaining };
 				while (targetTime > currentTime && targetTime.count() > 0 && currentTime.count() > 0 && timeRemaining.count() > 0) {
 					currentTime	  = std::chrono::duration_cast<milliseconds>(sys_clock::now().time_since_epoch());
@@ -427,7 +1185,17 @@ namespace discord_core_api {
 					}
 				}
 			}
-			returnData = https_client::httpsRequestInternal(connection);
+			if (connection.workload.baseUrl == "https://discord.com/api/v10") {
+				std::this_thread::sleep_until(rateLimitQueue.globalRateLimiter.acquire());
+			}
+		}
+
+		bool https_client::recordResponse(https_connection& connection, https_response_data& returnData) {
+			if (returnData.responseCode == 401 || returnData.responseCode == 403 ||
+				(returnData.responseCode == 429 && !(returnData.responseHeaders.contains("x-ratelimit-scope") &&
+					returnData.responseHeaders.at("x-ratelimit-scope") == "shared"))) {
+				rateLimitQueue.invalidRequests.record();
+			}
 			connection.currentRateLimitData->sampledTimeInMs.store(std::chrono::duration_cast<std::chrono::duration<int64_t, std::milli>>(sys_clock::now().time_since_epoch()),
 				std::memory_order_release);
 
@@ -435,14 +1203,26 @@ namespace discord_core_api {
 				message_printer::printSuccess<print_message_type::https>(
 					connection.workload.callStack + " success: " + static_cast<jsonifier::string>(returnData.responseCode) + ": " + returnData.responseData);
 			} else if (returnData.responseCode == 429) {
-				if (connection.data.responseHeaders.contains("x-ratelimit-retry-after")) {
-					connection.currentRateLimitData->sRemain.store(seconds{ jsonifier::strToInt64(connection.data.responseHeaders.at("x-ratelimit-retry-after").data()) / 1000LL },
+				if (returnData.responseHeaders.contains("x-ratelimit-retry-after")) {
+					connection.currentRateLimitData->sRemain.store(seconds{ jsonifier::strToInt64(returnData.responseHeaders.at("x-ratelimit-retry-after").data()) / 1000LL },
 						std::memory_order_release);
 				}
+				if (returnData.responseHeaders.contains("x-ratelimit-global") ||
+					(returnData.responseHeaders.contains("x-ratelimit-scope") && returnData.responseHeaders.at("x-ratelimit-scope") == "global")) {
+					rateLimitQueue.globalRateLimiter.penalize(
+						std::max(std::chrono::duration_cast<milliseconds>(connection.currentRateLimitData->sRemain.load(std::memory_order_acquire)), milliseconds{ 1000 }));
+				}
 				connection.currentRateLimitData->doWeWait.store(true, std::memory_order_release);
 				connection.currentRateLimitData->sampledTimeInMs.store(std::chrono::duration_cast<milliseconds>(sys_clock::now().time_since_epoch()), std::memory_order_release);
 				message_printer::printError<print_message_type::https>(connection.workload.callStack + "::httpsRequest(), we've hit rate limit! time remaining: " +
 					jsonifier::toString(connection.currentRateLimitData->sRemain.load(std::memory_order_acquire).count()));
+				return true;
+			}
+			return false;
+		}
+
+		https_response_data https_client::processResponse(https_connection& connection, https_response_data&& returnData) {
+			if (recordResponse(connection, returnData)) {
 				connection.resetValues(std::move(connection.workload), connection.currentRateLimitData);
 				returnData = executeByRateLimitData(connection);
 			}
@@ -450,53 +1230,60 @@ namespace discord_core_api {
 		}
 
 		https_client_core::https_client_core(jsonifier::string_view botTokenNew) {
-			botToken = botTokenNew;
+			discordRequestHeaders	= "Authorization: Bot " + static_cast<jsonifier::string>(botTokenNew) + "\r\nUser-Agent: DiscordCoreAPI (https://discordcoreapi.com/1.0)\r\n";
+			jsonRequestHeaders		= discordRequestHeaders + "Content-Type: application/json\r\n";
+			multipartRequestHeaders = discordRequestHeaders + "Content-Type: multipart/form-data; boundary=boundary25\r\n";
 		}
 
 		https_response_data https_client_core::httpsRequestInternal(https_connection& connection) {
-			if (connection.workload.baseUrl == "https://discord.com/api/v10") {
-				connection.workload.headersToInsert.emplace("Authorization", "Bot " + botToken);
-				connection.workload.headersToInsert.emplace("User-Agent", "DiscordCoreAPI (https://discordcoreapi.com/1.0)");
-				if (connection.workload.payloadType == payload_type::Application_Json) {
-					connection.workload.headersToInsert.emplace("Content-Type", "application/json");
-				} else if (connection.workload.payloadType == payload_type::Multipart_Form) {
-					connection.workload.headersToInsert.emplace("Content-Type", "multipart/form-data; boundary=boundary25");
-				}
-			}
 			if (connection.currentReconnectTries >= connection.maxReconnectTries) {
 				connection.disconnect();
 				return https_response_data{};
 			}
+			if (!sendRequest(connection)) {
+				++connection.currentReconnectTries;
+				connection.disconnect();
+				return httpsRequestInternal(connection);
+			}
+			auto result = getResponse(connection);
+			if (static_cast<int64_t>(result.responseCode) == -1 || !connection.areWeConnected()) {
+				++connection.currentReconnectTries;
+				connection.disconnect();
+				return httpsRequestInternal(connection);
+			} else {
+				return result;
+			}
+		}
+
+		jsonifier::string_view https_client_core::getRequestHeaders(const https_workload_data& workload) {
+			if (workload.baseUrl == "https://discord.com/api/v10") {
+				if (workload.payloadType == payload_type::Application_Json) {
+					return jsonRequestHeaders;
+				} else if (workload.payloadType == payload_type::Multipart_Form) {
+					return multipartRequestHeaders;
+				} else {
+					return discordRequestHeaders;
+				}
+			}
+			return {};
+		}
+
+		bool https_client_core::sendRequest(https_connection& connection) {
+			if (connection.areWeConnected() && connection.connectState == connect_state::Connected) {
+				connection.processIO(0);
+			}
 			if (!connection.areWeConnected()) {
 				connection.currentBaseUrl									 = connection.workload.baseUrl;
 				*static_cast<tcp_connection<https_connection>*>(&connection) = https_connection{ connection.workload.baseUrl, static_cast<uint16_t>(443) };
 				if (connection.currentStatus != connection_status::NO_Error || !connection.areWeConnected()) {
-					++connection.currentReconnectTries;
-					connection.disconnect();
-					return httpsRequestInternal(connection);
+					return false;
 				}
 			}
-			auto request = connection.buildRequest(connection.workload);
-			if (connection.areWeConnected()) {
-				connection.writeData(static_cast<jsonifier::string_view>(request), true);
-				if (connection.currentStatus != connection_status::NO_Error || !connection.areWeConnected()) {
-					++connection.currentReconnectTries;
-					connection.disconnect();
-					return httpsRequestInternal(connection);
-				}
-				auto result = getResponse(connection);
-				if (static_cast<int64_t>(result.responseCode) == -1 || !connection.areWeConnected()) {
-					++connection.currentReconnectTries;
-					connection.disconnect();
-					return httpsRequestInternal(connection);
-				} else {
-					return result;
-				}
-			} else {
-				++connection.currentReconnectTries;
-				connection.disconnect();
-				return httpsRequestInternal(connection);
+			if (!connection.finishConnecting()) {
+				return false;
 			}
+			connection.writeData(connection.buildRequest(connection.workload, getRequestHeaders(connection.workload)), true);
+			return connection.currentStatus == connection_status::NO_Error && connection.areWeConnected();
 		}
 
 		https_response_data https_client_core::recoverFromError(https_connection& connection) {
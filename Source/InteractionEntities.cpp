@@ -383,7 +383,7 @@ namespace discord_core_api {
 		}
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "interactions::createInteractionResponseAsync()";
-		interactions::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await interactions::httpsClient->submitWorkloadAsync(std::move(workload));
 		get_interaction_response_data dataPackage01{};
 		dataPackage01.applicationId	   = dataPackage.interactionPackage.applicationId;
 		dataPackage01.interactionToken = dataPackage.interactionPackage.interactionToken;
@@ -412,7 +412,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/webhooks/" + dataPackage.applicationId + "/" + dataPackage.interactionToken + "/messages/@original";
 		workload.callStack	   = "interactions::getInteractionResponseAsync()";
 		message_data returnData{};
-		interactions::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await interactions::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -429,7 +429,7 @@ namespace discord_core_api {
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "interactions::editInteractionResponseAsync()";
 		message_data returnData{};
-		interactions::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await interactions::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -440,7 +440,7 @@ namespace discord_core_api {
 		workload.workloadClass = discord_core_internal::https_workload_class::Delete;
 		workload.relativePath  = "/webhooks/" + dataPackage.interactionPackage.applicationId + "/" + dataPackage.interactionPackage.interactionToken + "/messages/@original";
 		workload.callStack	   = "interactions::deleteInteractionResponseAsync()";
-		interactions::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await interactions::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -457,7 +457,7 @@ namespace discord_core_api {
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "interactions::createFollowUpMessageAsync()";
 		message_data returnData{};
-		interactions::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await interactions::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -468,7 +468,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/webhooks/" + dataPackage.applicationId + "/" + dataPackage.interactionToken + "/messages/" + dataPackage.messageId;
 		workload.callStack	   = "interactions::getFollowUpMessageAsync()";
 		message_data returnData{};
-		interactions::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await interactions::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -486,7 +486,7 @@ namespace discord_core_api {
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "interactions::editFollowUpMessageAsync()";
 		message_data returnData{};
-		interactions::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await interactions::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -498,7 +498,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/webhooks/" + dataPackage.interactionPackage.applicationId + "/" + dataPackage.interactionPackage.interactionToken + "/messages/" +
 			dataPackage.messagePackage.messageId;
 		workload.callStack = "interactions::deleteFollowUpMessageAsync()";
-		interactions::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await interactions::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -886,9 +886,9 @@ namespace discord_core_api {
 		modal_collector::modalInteractionBuffersMap.erase(channelId.operator jsonifier::string());
 	}
 
-	unordered_map<jsonifier::string, unbounded_message_block<interaction_data>*> select_menu_collector::selectMenuInteractionBuffersMap{};
-	unordered_map<jsonifier::string, unbounded_message_block<interaction_data>*> button_collector::buttonInteractionBuffersMap{};
-	unordered_map<jsonifier::string, unbounded_message_block<interaction_data>*> modal_collector::modalInteractionBuffersMap{};
+	unordered_map<jsonifier::string, collector_message_block<interaction_data, 32>*> select_menu_collector::selectMenuInteractionBuffersMap{};
+	unordered_map<jsonifier::string, collector_message_block<interaction_data, 32>*> button_collector::buttonInteractionBuffersMap{};
+	unordered_map<jsonifier::string, collector_message_block<interaction_data, 32>*> modal_collector::modalInteractionBuffersMap{};
 	discord_core_internal::trigger_event<void, interaction_data> select_menu_collector::selectMenuInteractionEventsMap{};
 	discord_core_internal::trigger_event<void, interaction_data> button_collector::buttonInteractionEventsMap{};
 	discord_core_internal::trigger_event<void, interaction_data> modal_collector::modalInteractionEventsMap{};
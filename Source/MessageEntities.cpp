@@ -65,11 +65,10 @@ namespace jsonifier {
 
 namespace discord_core_api {
 
-	template<> unordered_map<jsonifier::string, unbounded_message_block<message_data>*> object_collector<message_data>::objectsBuffersMap{};
+	template<> unordered_map<jsonifier::string, object_collector<message_data>*> object_collector<message_data>::objectCollectorsMap{};
 
 	template<> object_collector<message_data>::object_collector() {
-		collectorId										 = jsonifier::toString(std::chrono::duration_cast<milliseconds>(sys_clock::now().time_since_epoch()).count());
-		object_collector::objectsBuffersMap[collectorId] = &objectsBuffer;
+		collectorId = jsonifier::toString(std::chrono::duration_cast<milliseconds>(sys_clock::now().time_since_epoch()).count());
 	};
 
 	template<> void object_collector<message_data>::run(std::coroutine_handle<
@@ -78,9 +77,8 @@ namespace discord_core_api {
 		int64_t elapsedTime{};
 		while (elapsedTime < msToCollectFor && !coroHandle.promise().stopRequested()) {
 			message_data message{};
-			waitForTimeToPass<message_data>(objectsBuffer, message, static_cast<uint64_t>(msToCollectFor - static_cast<uint64_t>(elapsedTime)));
-			if (filteringFunction(message)) {
-				objectReturnData.objects.emplace_back(message);
+			if (!waitForTimeToPass<message_data>(objectsBuffer, message, static_cast<uint64_t>(msToCollectFor - static_cast<uint64_t>(elapsedTime)))) {
+				objectReturnData.objects.emplace_back(std::move(message));
 			}
 			if (static_cast<int32_t>(objectReturnData.objects.size()) >= quantityOfObjectsToCollect) {
 				break;
@@ -96,14 +94,16 @@ namespace discord_core_api {
 		quantityOfObjectsToCollect = quantityToCollect;
 		filteringFunction		   = filteringFunctionNew;
 		msToCollectFor			   = msToCollectForNew;
+		// the filter runs as objects are delivered, so the collector is only registered once it has one.
+		object_collector::objectCollectorsMap[collectorId] = this;
 
 		run(coroHandle);
 		co_return objectReturnData;
 	}
 
 	template<> object_collector<message_data>::~object_collector() {
-		if (object_collector::objectsBuffersMap.contains(collectorId)) {
-			object_collector::objectsBuffersMap.erase(collectorId);
+		if (object_collector::objectCollectorsMap.contains(collectorId)) {
+			object_collector::objectCollectorsMap.erase(collectorId);
 		}
 	};
 
@@ -213,7 +213,7 @@ namespace discord_core_api {
 		}
 		workload.callStack = "messages::getMessagesAsync()";
 		jsonifier::vector<message_data> returnData{};
-		messages::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await messages::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		std::cout << "CURRENT RESULTS: " << returnData.at(0).timeStamp << std::endl;
 		co_return returnData;
 	}
@@ -225,7 +225,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/channels/" + dataPackage.channelId + "/messages/" + dataPackage.id;
 		workload.callStack	   = "messages::getMessageAsync()";
 		message_data returnData{};
-		messages::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await messages::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -242,7 +242,7 @@ namespace discord_core_api {
 		}
 		workload.callStack = "messages::createMessageAsync()";
 		message_data returnData{};
-		messages::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await messages::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -253,7 +253,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/channels/" + dataPackage.channelId + "/messages/" + dataPackage.messageId + "/crosspost";
 		workload.callStack	   = "messages::crosspostMessageAsync()";
 		message_data returnData{};
-		messages::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await messages::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -270,7 +270,7 @@ namespace discord_core_api {
 		}
 		workload.callStack = "messages::editMessageAsync()";
 		message_data returnData{};
-		messages::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await messages::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -292,7 +292,7 @@ namespace discord_core_api {
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
-		messages::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await messages::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -305,7 +305,7 @@ namespace discord_core_api {
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
-		messages::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await messages::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -316,7 +316,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/channels/" + dataPackage.channelId + "/pins";
 		workload.callStack	   = "messages::getPinnedMessagesAsync()";
 		jsonifier::vector<message_data> returnData{};
-		messages::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await messages::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -329,7 +329,7 @@ namespace discord_core_api {
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
-		messages::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await messages::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -342,7 +342,7 @@ namespace discord_core_api {
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
-		messages::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await messages::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -52,11 +52,10 @@ namespace jsonifier {
 
 namespace discord_core_api {
 
-	template<> unordered_map<jsonifier::string, unbounded_message_block<reaction_data>*> object_collector<reaction_data>::objectsBuffersMap{};
+	template<> unordered_map<jsonifier::string, object_collector<reaction_data>*> object_collector<reaction_data>::objectCollectorsMap{};
 
 	template<> object_collector<reaction_data>::object_collector() {
-		collectorId										 = jsonifier::toString(std::chrono::duration_cast<milliseconds>(sys_clock::now().time_since_epoch()).count());
-		object_collector::objectsBuffersMap[collectorId] = &objectsBuffer;
+		collectorId = jsonifier::toString(std::chrono::duration_cast<milliseconds>(sys_clock::now().time_since_epoch()).count());
 	};
 
 	template<> void object_collector<reaction_data>::run(
@@ -66,9 +65,8 @@ namespace discord_core_api {
 		int64_t elapsedTime{};
 		while (elapsedTime < msToCollectFor && !coroHandle.promise().stopRequested()) {
 			reaction_data message{};
-			waitForTimeToPass<reaction_data>(objectsBuffer, message, static_cast<uint64_t>(msToCollectFor - static_cast<uint64_t>(elapsedTime)));
-			if (filteringFunction(message)) {
-				objectReturnData.objects.emplace_back(message);
+			if (!waitForTimeToPass<reaction_data>(objectsBuffer, message, static_cast<uint64_t>(msToCollectFor - static_cast<uint64_t>(elapsedTime)))) {
+				objectReturnData.objects.emplace_back(std::move(message));
 			}
 			if (static_cast<int32_t>(objectReturnData.objects.size()) >= quantityOfObjectsToCollect) {
 				break;
@@ -84,14 +82,16 @@ namespace discord_core_api {
 		quantityOfObjectsToCollect = quantityToCollect;
 		filteringFunction		   = filteringFunctionNew;
 		msToCollectFor			   = msToCollectForNew;
+		// the filter runs as objects are delivered, so the collector is only registered once it has one.
+		object_collector::objectCollectorsMap[collectorId] = this;
 
 		run(coroHandle);
 		co_return std::move(objectReturnData);
 	}
 
 	template<> object_collector<reaction_data>::~object_collector() {
-		if (object_collector::objectsBuffersMap.contains(collectorId)) {
-			object_collector::objectsBuffersMap.erase(collectorId);
+		if (object_collector::objectCollectorsMap.contains(collectorId)) {
+			object_collector::objectCollectorsMap.erase(collectorId);
 		}
 	};
 
@@ -112,7 +112,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/channels/" + dataPackage.channelId + "/messages/" + dataPackage.messageId + "/reactions/" + urlEncode(emoji) + "/@me";
 		workload.callStack	   = "reactions::createReactionAsync()";
 		reaction_data returnData{};
-		reactions::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await reactions::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -128,7 +128,7 @@ namespace discord_core_api {
 		workload.workloadClass = discord_core_internal::https_workload_class::Delete;
 		workload.relativePath  = "/channels/" + dataPackage.channelId + "/messages/" + dataPackage.messageId + "/reactions/" + urlEncode(emoji) + "/@me";
 		workload.callStack	   = "reactions::deleteOwnReactionAsync()";
-		reactions::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await reactions::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -145,7 +145,7 @@ namespace discord_core_api {
 		workload.workloadClass = discord_core_internal::https_workload_class::Delete;
 		workload.relativePath  = "/channels/" + dataPackage.channelId + "/messages/" + dataPackage.messageId + "/reactions/" + urlEncode(emoji) + "/" + dataPackage.userId;
 		workload.callStack	   = "reactions::deleteUserReactionAsync()";
-		reactions::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await reactions::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -164,7 +164,7 @@ namespace discord_core_api {
 		}
 		workload.callStack = "reactions::getReactionsAsync()";
 		jsonifier::vector<user_data> returnData{};
-		reactions::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await reactions::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -175,7 +175,7 @@ namespace discord_core_api {
 		workload.workloadClass = discord_core_internal::https_workload_class::Delete;
 		workload.relativePath  = "/channels/" + dataPackage.channelId + "/messages/" + dataPackage.messageId + "/reactions";
 		workload.callStack	   = "reactions::deleteAllReactionsAsync()";
-		reactions::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await reactions::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -191,7 +191,7 @@ namespace discord_core_api {
 		workload.workloadClass = discord_core_internal::https_workload_class::Delete;
 		workload.relativePath  = "/channels/" + dataPackage.channelId + "/messages/" + dataPackage.messageId + "/reactions/" + urlEncode(emoji);
 		workload.callStack	   = "reactions::deleteReactionsByEmojiAsync()";
-		reactions::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await reactions::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -202,7 +202,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/guilds/" + dataPackage.guildId + "/emojis";
 		workload.callStack	   = "reactions::getEmojiListAsync()";
 		jsonifier::vector<emoji_data> returnData{};
-		reactions::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await reactions::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -213,7 +213,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/guilds/" + dataPackage.guildId + "/emojis/" + dataPackage.emojiId;
 		workload.callStack	   = "reactions::getGuildEmojiAsync()";
 		emoji_data returnData{};
-		reactions::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await reactions::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -246,7 +246,7 @@ namespace discord_core_api {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
 		emoji_data returnData{};
-		reactions::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await reactions::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -261,7 +261,7 @@ namespace discord_core_api {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
 		emoji_data returnData{};
-		reactions::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await reactions::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -274,7 +274,7 @@ namespace discord_core_api {
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
-		reactions::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await reactions::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -118,7 +118,7 @@ namespace discord_core_api {
 		return *this;
 	}
 
-	role_cache_data::operator role_data() {
+	role_cache_data::operator role_data() const {
 		role_data returnData{};
 		returnData.mentionable	= getFlagValue<role_flags>(role_flags::mentionable);
 		returnData.managed		= getFlagValue<role_flags>(role_flags::managed);
@@ -144,6 +144,7 @@ namespace discord_core_api {
 	void roles::initialize(discord_core_internal::https_client* client, config_manager* configManagerNew) {
 		roles::doWeCacheRolesBool = configManagerNew->doWeCacheRoles();
 		roles::httpsClient		  = client;
+		roles::cache.setSnapshotReads(configManagerNew->doWeUseSnapshotReads());
 	}
 
 	co_routine<void> roles::addGuildMemberRoleAsync(add_guild_member_role_data dataPackage) {
@@ -155,7 +156,7 @@ namespace discord_core_api {
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
-		roles::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await roles::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -168,7 +169,7 @@ namespace discord_core_api {
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
-		roles::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await roles::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -182,7 +183,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/guilds/" + dataPackage.guildId + "/roles";
 		workload.callStack	   = "roles::getGuildRolesAsync()";
 		jsonifier::vector<role_data> returnData{};
-		roles::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await roles::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -197,7 +198,7 @@ namespace discord_core_api {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
 		role_data returnData{};
-		roles::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await roles::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		modify_guild_role_positions_data newDataPackage{};
 		newDataPackage.guildId	   = dataPackage.guildId;
 		newDataPackage.newPosition = dataPackage.position;
@@ -247,7 +248,7 @@ namespace discord_core_api {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
 		jsonifier::vector<role_data> returnData{};
-		roles::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await roles::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -262,10 +263,10 @@ namespace discord_core_api {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
 		role_data data{ dataPackage.roleId };
-		if (cache.contains(data.id)) {
-			data = cache[data.id];
-		}
-		roles::httpsClient->submitWorkloadAndGetResult(std::move(workload), data);
+		cache.visit(data.id, [&](const role_cache_data& value) {
+			data = value;
+		});
+		co_await roles::httpsClient->submitWorkloadAsync(std::move(workload), data);
 		if (doWeCacheRolesBool) {
 			insertRole(static_cast<role_cache_data>(data));
 		}
@@ -281,7 +282,7 @@ namespace discord_core_api {
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
-		roles::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await roles::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -306,9 +307,9 @@ namespace discord_core_api {
 			throw dca_exception{ "roles::getRoleAsync() error: sorry, but you forgot to set the guildId!" };
 		}
 		role_data data{ dataPackage.roleId };
-		if (cache.contains(data.id)) {
-			data = cache[data.id];
-		}
+		cache.visit(data.id, [&](const role_cache_data& value) {
+			data = value;
+		});
 		for (auto& value: roles) {
 			if (value.id == dataPackage.roleId) {
 				data = std::move(value);
@@ -321,13 +322,20 @@ namespace discord_core_api {
 	}
 
 	role_cache_data roles::getCachedRole(const get_role_data dataPackage) {
-		if (cache.contains(dataPackage.roleId)) {
-			return cache[dataPackage.roleId];
+		role_cache_data returnValue{};
+		if (cache.visit(dataPackage.roleId, [&](const role_cache_data& value) {
+				returnValue = value;
+			})) {
+			return returnValue;
 		} else {
 			return getRoleAsync({ .guildId = dataPackage.guildId, .roleId = dataPackage.roleId }).get();
 		}
 	}
 
+	cache_snapshot<role_cache_data> roles::getCachedRoleSnapshot(const get_role_data dataPackage) {
+		return cache.find(dataPackage.roleId);
+	}
+
 	void roles::removeRole(const role_cache_data& roleId) {
 		cache.erase(roleId);
 	};
@@ -337,6 +345,6 @@ namespace discord_core_api {
 	}
 
 	discord_core_internal::https_client* roles::httpsClient{};
-	object_cache<role_cache_data> roles::cache{};
+	entity_cache<role_cache_data> roles::cache{};
 	bool roles::doWeCacheRolesBool{};
 };
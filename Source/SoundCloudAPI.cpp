@@ -440,11 +440,11 @@ namespace discord_core_api {
 					auto headersNew								= submitWorkloadAndGetResult(std::move(dataPackage02));
 					uint64_t valueBitRate{};
 					uint64_t valueLength{};
-					if (headersNew.responseHeaders.find("x-amz-meta-bitrate") != headersNew.responseHeaders.end()) {
-						valueBitRate = jsonifier::strToUint64(headersNew.responseHeaders.find("x-amz-meta-bitrate")->second.data());
+					if (headersNew.responseHeaders.contains("x-amz-meta-bitrate")) {
+						valueBitRate = jsonifier::strToUint64(headersNew.responseHeaders.at("x-amz-meta-bitrate").data());
 					}
-					if (headersNew.responseHeaders.find("x-amz-meta-duration") != headersNew.responseHeaders.end()) {
-						valueLength = jsonifier::strToUint64(headersNew.responseHeaders.find("x-amz-meta-duration")->second.data());
+					if (headersNew.responseHeaders.contains("x-amz-meta-duration")) {
+						valueLength = jsonifier::strToUint64(headersNew.responseHeaders.at("x-amz-meta-duration").data());
 					}
 					download_url downloadUrlNew{};
 					downloadUrlNew.contentSize = static_cast<uint64_t>(((valueBitRate * valueLength) / 8) - 193);
@@ -65,7 +65,7 @@ namespace discord_core_api {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
 		stage_instance_data returnData{};
-		stage_instances::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await stage_instances::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -76,7 +76,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/stage-instances/" + dataPackage.channelId;
 		workload.callStack	   = "stage_instances::getStageInstanceAsync()";
 		stage_instance_data returnData{};
-		stage_instances::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await stage_instances::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -91,7 +91,7 @@ namespace discord_core_api {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
 		stage_instance_data returnData{};
-		stage_instances::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await stage_instances::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -104,7 +104,7 @@ namespace discord_core_api {
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
-		stage_instances::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await stage_instances::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 	discord_core_internal::https_client* stage_instances::httpsClient{};
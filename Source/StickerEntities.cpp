@@ -61,7 +61,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/stickers/" + dataPackage.stickerId;
 		workload.callStack	   = "stickers::getStickerAsync()";
 		sticker_data returnData{};
-		stickers::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await stickers::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -72,7 +72,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/sticker-packs";
 		workload.callStack	   = "stickers::getNitroStickerPacksAsync()";
 		jsonifier::vector<sticker_pack_data> returnData{};
-		stickers::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await stickers::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -83,7 +83,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/guilds/" + dataPackage.guildId + "/stickers";
 		workload.callStack	   = "stickers::getGuildStickersAsync()";
 		jsonifier::vector<sticker_data> returnData{};
-		stickers::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await stickers::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -98,7 +98,7 @@ namespace discord_core_api {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
 		sticker_data returnData{};
-		stickers::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await stickers::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -113,7 +113,7 @@ namespace discord_core_api {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
 		sticker_data returnData{};
-		stickers::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await stickers::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -126,7 +126,7 @@ namespace discord_core_api {
 		if (dataPackage.reason != "") {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
-		stickers::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await stickers::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
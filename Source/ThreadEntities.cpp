@@ -80,7 +80,7 @@ namespace discord_core_api {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
 		thread_data returnData{};
-		threads::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await threads::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -95,7 +95,7 @@ namespace discord_core_api {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
 		thread_data returnData{};
-		threads::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await threads::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -110,7 +110,7 @@ namespace discord_core_api {
 			workload.headersToInsert["x-audit-log-reason"] = dataPackage.reason;
 		}
 		thread_data returnData{};
-		threads::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await threads::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -120,7 +120,7 @@ namespace discord_core_api {
 		workload.workloadClass = discord_core_internal::https_workload_class::Put;
 		workload.relativePath  = "/channels/" + dataPackage.channelId + "/thread-members/@me";
 		workload.callStack	   = "threads::joinThreadAsync()";
-		threads::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await threads::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -130,7 +130,7 @@ namespace discord_core_api {
 		workload.workloadClass = discord_core_internal::https_workload_class::Put;
 		workload.relativePath  = "/channels/" + dataPackage.channelId + "/thread-members/" + dataPackage.userId;
 		workload.callStack	   = "threads::addThreadMemberAsync()";
-		threads::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await threads::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -140,7 +140,7 @@ namespace discord_core_api {
 		workload.workloadClass = discord_core_internal::https_workload_class::Delete;
 		workload.relativePath  = "/channels/" + dataPackage.channelId + "/thread-members/@me";
 		workload.callStack	   = "threads::leaveThreadAsync()";
-		threads::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await threads::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -150,7 +150,7 @@ namespace discord_core_api {
 		workload.workloadClass = discord_core_internal::https_workload_class::Delete;
 		workload.relativePath  = "/channels/" + dataPackage.channelId + "/thread-members/" + dataPackage.userId;
 		workload.callStack	   = "threads::removeThreadMemberAsync()";
-		threads::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await threads::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -161,7 +161,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/channels/" + dataPackage.channelId + "/thread-members/" + dataPackage.userId;
 		workload.callStack	   = "threads::getThreadMemberAsync()";
 		thread_member_data returnData{};
-		threads::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await threads::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -172,7 +172,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/channels/" + dataPackage.channelId + "/thread-members";
 		workload.callStack	   = "threads::getThreadMembersAsync()";
 		jsonifier::vector<thread_member_data> returnData{};
-		threads::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await threads::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -183,7 +183,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/channels/" + dataPackage.channelId + "/threads/active";
 		workload.callStack	   = "threads::getActiveThreadsAsync()";
 		active_threads_data returnData{};
-		threads::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await threads::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -202,7 +202,7 @@ namespace discord_core_api {
 		}
 		workload.callStack = "threads::getPublicArchivedThreadsAsync()";
 		archived_threads_data returnData{};
-		threads::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await threads::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -221,7 +221,7 @@ namespace discord_core_api {
 		}
 		workload.callStack = "threads::getPrivateArchivedThreadsAsync()";
 		archived_threads_data returnData{};
-		threads::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await threads::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -240,7 +240,7 @@ namespace discord_core_api {
 		}
 		workload.callStack = "threads::getJoinedPrivateArchivedThreadsAsync()";
 		archived_threads_data returnData{};
-		threads::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await threads::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -251,7 +251,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/guilds/" + dataPackage.guildId + "/threads/active";
 		workload.callStack	   = "threads::listActiveThreadsAsync()";
 		active_threads_data returnData{};
-		threads::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await threads::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
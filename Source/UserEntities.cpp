@@ -278,7 +278,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/channels/" + dataPackage.channelId + "/recipients/" + dataPackage.userId;
 		parser.serializeJson(dataPackage, workload.content);
 		workload.callStack = "users::addRecipientToGroupDMAsync()";
-		users::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await users::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -288,7 +288,7 @@ namespace discord_core_api {
 		workload.workloadClass = discord_core_internal::https_workload_class::Delete;
 		workload.relativePath  = "/channels/" + dataPackage.channelId + "/recipients/" + dataPackage.userId;
 		workload.callStack	   = "users::removeRecipientToGroupDMAsync()";
-		users::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await users::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -298,7 +298,7 @@ namespace discord_core_api {
 		workload.workloadClass = discord_core_internal::https_workload_class::Patch;
 		workload.relativePath  = "/guilds/" + dataPackage.guildId + "/voice-states/@me";
 		workload.callStack	   = "users::modifyCurrentUserVoiceStateAsync()";
-		users::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await users::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -308,7 +308,7 @@ namespace discord_core_api {
 		workload.workloadClass = discord_core_internal::https_workload_class::Patch;
 		workload.relativePath  = "/guilds/" + dataPackage.guildId + "/voice-states/" + dataPackage.userId;
 		workload.callStack	   = "users::modifyUserVoiceStateAsync()";
-		users::httpsClient->submitWorkloadAndGetResult(std::move(workload));
+		co_await users::httpsClient->submitWorkloadAsync(std::move(workload));
 		co_return;
 	}
 
@@ -319,15 +319,19 @@ namespace discord_core_api {
 		workload.relativePath  = "/users/@me";
 		workload.callStack	   = "users::getCurrentUserAsync()";
 		user_data returnData{};
-		users::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await users::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		auto newId = returnData.id;
 		insertUser(static_cast<user_cache_data>(returnData));
 		co_return cache[newId];
 	}
 
 	user_cache_data users::getCachedUser(const get_user_data dataPackage) {
-		if (cache.contains(dataPackage.userId)) {
-			return cache[dataPackage.userId];
+		user_cache_data cachedUser{};
+		auto isCached = cache.visit(dataPackage.userId, [&](const user_cache_data& value) {
+			cachedUser = value;
+		});
+		if (isCached) {
+			return cachedUser;
 		} else {
 			return getUserAsync({ .userId = dataPackage.userId }).get();
 		}
@@ -340,10 +344,14 @@ namespace discord_core_api {
 		workload.relativePath  = "/users/" + dataPackage.userId;
 		workload.callStack	   = "users::getUserAsync()";
 		user_data data{ dataPackage.userId };
-		if (cache.contains(data.id)) {
-			data = cache[data.id];
+		user_cache_data cachedUser{};
+		auto isCached = cache.visit(data.id, [&](const user_cache_data& value) {
+			cachedUser = value;
+		});
+		if (isCached) {
+			data = cachedUser;
 		}
-		users::httpsClient->submitWorkloadAndGetResult(std::move(workload), data);
+		co_await users::httpsClient->submitWorkloadAsync(std::move(workload), data);
 		if (doWeCacheUsersBool) {
 			insertUser(static_cast<user_cache_data>(data));
 		}
@@ -358,7 +366,7 @@ namespace discord_core_api {
 		workload.callStack	   = "users::modifyCurrentUserAsync()";
 		parser.serializeJson(dataPackage, workload.content);
 		user_data returnData{};
-		users::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await users::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -369,7 +377,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/users/@me/connections";
 		workload.callStack	   = "users::getUserConnectionsAsync()";
 		jsonifier::vector<connection_data> returnData{};
-		users::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await users::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -380,7 +388,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/oauth2/applications/@me";
 		workload.callStack	   = "users::getApplicationDataAsync()";
 		application_data returnData{};
-		users::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await users::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
@@ -391,7 +399,7 @@ namespace discord_core_api {
 		workload.relativePath  = "/oauth2/@me";
 		workload.callStack	   = "users::getCurrentUserAuthorizationInfoAsync()";
 		authorization_info_data returnData{};
-		users::httpsClient->submitWorkloadAndGetResult(std::move(workload), returnData);
+		co_await users::httpsClient->submitWorkloadAsync(std::move(workload), returnData);
 		co_return returnData;
 	}
 
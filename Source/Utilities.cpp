@@ -128,6 +128,14 @@ namespace discord_core_api {
 		return config.cacheOptions.cacheRoles;
 	}
 
+	bool config_manager::doWeUseSnapshotReads() const {
+		return config.cacheOptions.snapshotReads;
+	}
+
+	bool config_manager::doWeUseColumnarGuildMembers() const {
+		return config.cacheOptions.columnarGuildMembers;
+	}
+
 	update_presence_data config_manager::getPresenceData() const {
 		return config.presenceData;
 	}
@@ -172,6 +180,18 @@ namespace discord_core_api {
 		config.connectionPort = connectionPortNew;
 	}
 
+	milliseconds config_manager::getConnectTimeout() const {
+		return config.connectionOptions.connectTimeout;
+	}
+
+	milliseconds config_manager::getHandshakeTimeout() const {
+		return config.connectionOptions.handshakeTimeout;
+	}
+
+	tcp_write_policy config_manager::getWritePolicy() const {
+		return config.connectionOptions.writePolicy;
+	}
+
 	jsonifier::vector<repeated_function_data> config_manager::getFunctionsToExecute() const {
 		return config.functionsToExecute;
 	}
@@ -180,6 +200,10 @@ namespace discord_core_api {
 		return config.textFormat;
 	}
 
+	bool config_manager::doWeUseZlibStream() const {
+		return config.useZlibStream;
+	}
+
 	gateway_intents config_manager::getGatewayIntents() {
 		return config.intents;
 	}
@@ -308,15 +332,11 @@ namespace discord_core_api {
 				break;
 			}
 		}
-		jsonifier::vector<role_data> guildMemberRoles{};
-		for (auto& value: guildMember.roles) {
-			guildMemberRoles.emplace_back(roles::getCachedRole({ .guildId = guildMember.guildId, .roleId = value }));
-		}
 		uint64_t allow{};
 		uint64_t deny{};
-		for (auto& value: guildMemberRoles) {
+		for (auto& value: guildMember.roles) {
 			for (uint64_t x = 0; x < channel.permissionOverwrites.size(); ++x) {
-				if (value.id == channel.permissionOverwrites.at(x).id) {
+				if (value == channel.permissionOverwrites.at(x).id) {
 					allow |= channel.permissionOverwrites.at(x).allow;
 					deny |= channel.permissionOverwrites.at(x).deny;
 				}
@@ -335,47 +355,7 @@ namespace discord_core_api {
 	}
 
 	template<> jsonifier::string permissions_base<permissions>::computeBasePermissions(const guild_member_data& guildMember) {
-		const guild_cache_data guild = guilds::getCachedGuild({ .guildId = guildMember.guildId });
-		if (guild.ownerId == guildMember.user.id) {
-			return getAllPermissions();
-		}
-		jsonifier::vector<role_data> guildRoles{};
-		if (roles::doWeCacheRoles()) {
-			for (auto& value: guild.roles) {
-				guildRoles.emplace_back(roles::getCachedRole({ .roleId = value }));
-			}
-		} else {
-			guildRoles = roles::getGuildRolesAsync({ .guildId = guildMember.guildId }).get();
-		}
-		role_data roleEveryone{};
-		for (auto& value: guildRoles) {
-			if (value.id == guild.id) {
-				roleEveryone = value;
-			}
-		}
-		uint64_t permissions{};
-		if (roleEveryone.permissions.operator std::basic_string_view<char, std::char_traits<char>>() != "0") {
-			permissions = roleEveryone.permissions;
-		}
-		get_guild_member_roles_data getRolesData{};
-		getRolesData.guildMember = guildMember;
-		getRolesData.guildId	 = guildMember.guildId;
-		jsonifier::vector<role_data> guildMemberRoles{};
-		if (roles::doWeCacheRoles()) {
-			for (auto& value: guildMember.roles) {
-				guildMemberRoles.emplace_back(roles::getCachedRole({ .roleId = value }));
-			}
-		} else {
-			guildMemberRoles = roles::getGuildMemberRolesAsync({ .guildMember = guildMember, .guildId = guildMember.guildId }).get();
-		}
-		for (auto& value: guildMemberRoles) {
-			permissions |= value.permissions.operator uint64_t();
-		}
-		if (permissions & static_cast<uint64_t>(permission::administrator)) {
-			return getAllPermissions();
-		}
-
-		return jsonifier::toString(permissions);
+		return jsonifier::toString(permission_engine::computeBasePermissions(guildMember.guildId, guildMember.user.id, guildMember.roles));
 	}
 
 	template<> jsonifier::string permissions_base<permissions_parse>::computeOverwrites(jsonifier::string_view basePermissions, const guild_member_data& guildMember,
@@ -459,6 +439,328 @@ namespace discord_core_api {
 		return jsonifier::toString(permissions);
 	}
 
+	std::array<permission_engine::engine_shard, permission_engine::shardCount> permission_engine::shards{};
+
+	uint64_t permission_engine::computePermissions(snowflake guildId, snowflake userId, snowflake channelId) {
+		uint64_t returnValue{};
+		if (tryComputePermissions(guildId, userId, channelId, returnValue)) {
+			return returnValue;
+		}
+		populate(guildId, userId, channelId);
+		tryComputePermissions(guildId, userId, channelId, returnValue);
+		return returnValue;
+	}
+
+	uint64_t permission_engine::computeBasePermissions(snowflake guildId, snowflake userId) {
+		return computePermissions(guildId, userId, 0);
+	}
+
+	uint64_t permission_engine::computeBasePermissions(snowflake guildId, snowflake userId, const jsonifier::vector<snowflake>& roles) {
+		auto& shard = getShard(guildId);
+		{
+			std::shared_lock lock{ shard.engineMutex };
+			if (auto guildIter = shard.guilds.find(guildId); guildIter != shard.guilds.end()) {
+				return computeBasePermissions(guildIter->second, userId, roles);
+			}
+		}
+		populate(guildId, 0, 0);
+		std::shared_lock lock{ shard.engineMutex };
+		if (auto guildIter = shard.guilds.find(guildId); guildIter != shard.guilds.end()) {
+			return computeBasePermissions(guildIter->second, userId, roles);
+		}
+		return 0;
+	}
+
+	void permission_engine::seedGuild(snowflake guildId, snowflake ownerId, const jsonifier::vector<role_data>& roles, const jsonifier::vector<channel_data>& channels) {
+		guild_entry newGuild{};
+		newGuild.id		 = guildId;
+		newGuild.ownerId = ownerId;
+		for (auto& value: roles) {
+			newGuild.rolePermissions.emplace(value.id, value.permissions.operator uint64_t());
+		}
+		for (auto& value: channels) {
+			newGuild.channels.emplace(value.id, collectOverwrites(guildId, value.permissionOverwrites));
+		}
+		auto& shard = getShard(guildId);
+		std::unique_lock lock{ shard.engineMutex };
+		if (auto guildIter = shard.guilds.find(guildId); guildIter != shard.guilds.end()) {
+			for (auto& [userId, member]: guildIter->second.members) {
+				member.basePermissions = computeBasePermissions(newGuild, userId, member.roles);
+				newGuild.members.emplace(userId, std::move(member));
+			}
+			guildIter->second = std::move(newGuild);
+		} else {
+			shard.guilds.emplace(guildId, std::move(newGuild));
+		}
+	}
+
+	void permission_engine::updateGuildOwner(snowflake guildId, snowflake ownerId) {
+		auto& shard = getShard(guildId);
+		std::unique_lock lock{ shard.engineMutex };
+		auto guildIter = shard.guilds.find(guildId);
+		if (guildIter == shard.guilds.end() || guildIter->second.ownerId == ownerId) {
+			return;
+		}
+		auto& guild	  = guildIter->second;
+		auto oldOwner = guild.ownerId;
+		guild.ownerId = ownerId;
+		for (auto value: { oldOwner, ownerId }) {
+			if (auto memberIter = guild.members.find(value); memberIter != guild.members.end()) {
+				memberIter->second.basePermissions = computeBasePermissions(guild, value, memberIter->second.roles);
+			}
+		}
+	}
+
+	void permission_engine::removeGuild(snowflake guildId) {
+		auto& shard = getShard(guildId);
+		std::unique_lock lock{ shard.engineMutex };
+		shard.guilds.erase(guildId);
+	}
+
+	void permission_engine::updateRole(snowflake guildId, snowflake roleId, uint64_t permissions) {
+		auto& shard = getShard(guildId);
+		std::unique_lock lock{ shard.engineMutex };
+		auto guildIter = shard.guilds.find(guildId);
+		if (guildIter == shard.guilds.end()) {
+			return;
+		}
+		auto& guild = guildIter->second;
+		if (auto roleIter = guild.rolePermissions.find(roleId); roleIter != guild.rolePermissions.end()) {
+			if (roleIter->second == permissions) {
+				return;
+			}
+			roleIter->second = permissions;
+		} else {
+			guild.rolePermissions.emplace(roleId, permissions);
+		}
+		refreshMembers(guild, roleId);
+	}
+
+	void permission_engine::removeRole(snowflake guildId, snowflake roleId) {
+		auto& shard = getShard(guildId);
+		std::unique_lock lock{ shard.engineMutex };
+		auto guildIter = shard.guilds.find(guildId);
+		if (guildIter == shard.guilds.end()) {
+			return;
+		}
+		auto& guild = guildIter->second;
+		guild.rolePermissions.erase(roleId);
+		refreshMembers(guild, roleId);
+	}
+
+	void permission_engine::updateMember(snowflake guildId, snowflake userId, const jsonifier::vector<snowflake>& roles) {
+		auto& shard = getShard(guildId);
+		std::unique_lock lock{ shard.engineMutex };
+		auto guildIter = shard.guilds.find(guildId);
+		if (guildIter == shard.guilds.end()) {
+			return;
+		}
+		auto& guild = guildIter->second;
+		member_entry newMember{};
+		newMember.roles			  = roles;
+		newMember.basePermissions = computeBasePermissions(guild, userId, roles);
+		if (auto memberIter = guild.members.find(userId); memberIter != guild.members.end()) {
+			memberIter->second = std::move(newMember);
+		} else {
+			guild.members.emplace(userId, std::move(newMember));
+		}
+	}
+
+	void permission_engine::removeMember(snowflake guildId, snowflake userId) {
+		auto& shard = getShard(guildId);
+		std::unique_lock lock{ shard.engineMutex };
+		if (auto guildIter = shard.guilds.find(guildId); guildIter != shard.guilds.end()) {
+			guildIter->second.members.erase(userId);
+		}
+	}
+
+	void permission_engine::updateChannel(const channel_data& channel) {
+		auto newChannel = collectOverwrites(channel.guildId, channel.permissionOverwrites);
+		auto& shard		= getShard(channel.guildId);
+		std::unique_lock lock{ shard.engineMutex };
+		auto guildIter = shard.guilds.find(channel.guildId);
+		if (guildIter == shard.guilds.end()) {
+			return;
+		}
+		auto& guild = guildIter->second;
+		if (auto channelIter = guild.channels.find(channel.id); channelIter != guild.channels.end()) {
+			channelIter->second = std::move(newChannel);
+		} else {
+			guild.channels.emplace(channel.id, std::move(newChannel));
+		}
+	}
+
+	void permission_engine::removeChannel(snowflake guildId, snowflake channelId) {
+		auto& shard = getShard(guildId);
+		std::unique_lock lock{ shard.engineMutex };
+		if (auto guildIter = shard.guilds.find(guildId); guildIter != shard.guilds.end()) {
+			guildIter->second.channels.erase(channelId);
+		}
+	}
+
+	permission_engine::engine_shard& permission_engine::getShard(snowflake guildId) {
+		return shards[key_accessor<snowflake>::getHashKey(guildId) >> (64 - std::countr_zero(shardCount))];
+	}
+
+	bool permission_engine::tryComputePermissions(snowflake guildId, snowflake userId, snowflake channelId, uint64_t& permissionsNew) {
+		auto& shard = getShard(guildId);
+		std::shared_lock lock{ shard.engineMutex };
+		auto guildIter = shard.guilds.find(guildId);
+		if (guildIter == shard.guilds.end()) {
+			return false;
+		}
+		auto& guild		= guildIter->second;
+		auto memberIter = guild.members.find(userId);
+		if (memberIter == guild.members.end()) {
+			return false;
+		}
+		auto& member   = memberIter->second;
+		permissionsNew = member.basePermissions;
+		if (channelId == 0 || (permissionsNew & static_cast<uint64_t>(permission::administrator))) {
+			return true;
+		}
+		auto channelIter = guild.channels.find(channelId);
+		if (channelIter == guild.channels.end()) {
+			return false;
+		}
+		auto& channel = channelIter->second;
+		permissionsNew &= ~channel.everyoneDeny;
+		permissionsNew |= channel.everyoneAllow;
+		uint64_t allow{};
+		uint64_t deny{};
+		for (auto& value: channel.roleOverwrites) {
+			for (auto& role: member.roles) {
+				if (value.id == role) {
+					allow |= value.allow;
+					deny |= value.deny;
+					break;
+				}
+			}
+		}
+		permissionsNew &= ~deny;
+		permissionsNew |= allow;
+		for (auto& value: channel.memberOverwrites) {
+			if (value.id == userId) {
+				permissionsNew &= ~value.deny;
+				permissionsNew |= value.allow;
+				break;
+			}
+		}
+		return true;
+	}
+
+	uint64_t permission_engine::computeBasePermissions(const guild_entry& guild, snowflake userId, const jsonifier::vector<snowflake>& roles) {
+		if (guild.ownerId == userId) {
+			return allPermissions;
+		}
+		uint64_t returnValue{};
+		if (auto roleIter = guild.rolePermissions.find(guild.id); roleIter != guild.rolePermissions.end()) {
+			returnValue = roleIter->second;
+		}
+		for (auto& value: roles) {
+			if (auto roleIter = guild.rolePermissions.find(value); roleIter != guild.rolePermissions.end()) {
+				returnValue |= roleIter->second;
+			}
+		}
+		if (returnValue & static_cast<uint64_t>(permission::administrator)) {
+			return allPermissions;
+		}
+		return returnValue;
+	}
+
+	void permission_engine::refreshMembers(guild_entry& guild, snowflake roleId) {
+		for (auto& [userId, member]: guild.members) {
+			if (roleId == guild.id || std::find(member.roles.begin(), member.roles.end(), roleId) != member.roles.end()) {
+				member.basePermissions = computeBasePermissions(guild, userId, member.roles);
+			}
+		}
+	}
+
+	void permission_engine::populate(snowflake guildId, snowflake userId, snowflake channelId) {
+		auto& shard = getShard(guildId);
+		bool haveChannel{ channelId == 0 };
+		bool haveMember{ userId == 0 };
+		bool haveGuild{};
+		{
+			std::shared_lock lock{ shard.engineMutex };
+			if (auto guildIter = shard.guilds.find(guildId); guildIter != shard.guilds.end()) {
+				haveChannel = haveChannel || guildIter->second.channels.contains(channelId);
+				haveMember	= haveMember || guildIter->second.members.contains(userId);
+				haveGuild	= true;
+			}
+		}
+		guild_entry newGuild{};
+		if (!haveGuild) {
+			jsonifier::vector<snowflake> roleIds{};
+			newGuild.id = guildId;
+			if (!guilds::withCachedGuild({ .guildId = guildId }, [&](const guild_cache_data& guild) {
+					newGuild.ownerId = guild.ownerId;
+					roleIds			 = guild.roles;
+				})) {
+				guild_cache_data guild = guilds::getCachedGuild({ .guildId = guildId });
+				newGuild.ownerId	   = guild.ownerId;
+				roleIds				   = std::move(guild.roles);
+			}
+			if (roles::doWeCacheRoles()) {
+				for (auto& value: roleIds) {
+					roles::withCachedRole({ .roleId = value }, [&](const role_cache_data& role) {
+						newGuild.rolePermissions.emplace(role.id, role.permissionsVal.operator uint64_t());
+					});
+				}
+			} else {
+				for (auto& value: roles::getGuildRolesAsync({ .guildId = guildId }).get()) {
+					newGuild.rolePermissions.emplace(value.id, value.permissions.operator uint64_t());
+				}
+			}
+		}
+		jsonifier::vector<snowflake> memberRoles{};
+		if (!haveMember) {
+			memberRoles = guild_members::getCachedGuildMember({ .guildMemberId = userId, .guildId = guildId }).roles;
+		}
+		channel_entry newChannel{};
+		if (!haveChannel) {
+			if (!channels::withCachedChannel({ .channelId = channelId }, [&](const channel_cache_data& channel) {
+					newChannel = collectOverwrites(guildId, channel.permissionOverwrites);
+				})) {
+				newChannel = collectOverwrites(guildId, channels::getCachedChannel({ .channelId = channelId }).permissionOverwrites);
+			}
+		}
+		std::unique_lock lock{ shard.engineMutex };
+		auto guildIter = shard.guilds.find(guildId);
+		if (guildIter == shard.guilds.end()) {
+			if (haveGuild) {
+				return;
+			}
+			guildIter = shard.guilds.emplace(guildId, std::move(newGuild));
+		}
+		auto& guild = guildIter->second;
+		if (!haveMember && !guild.members.contains(userId)) {
+			member_entry newMember{};
+			newMember.basePermissions = computeBasePermissions(guild, userId, memberRoles);
+			newMember.roles			  = std::move(memberRoles);
+			guild.members.emplace(userId, std::move(newMember));
+		}
+		if (!haveChannel && !guild.channels.contains(channelId)) {
+			guild.channels.emplace(channelId, std::move(newChannel));
+		}
+	}
+
+	permission_engine::channel_entry permission_engine::collectOverwrites(snowflake guildId, const jsonifier::vector<over_write_data>& overwrites) {
+		channel_entry returnValue{};
+		for (auto& value: overwrites) {
+			overwrite_entry newOverwrite{ .id = value.id, .allow = value.allow.operator uint64_t(), .deny = value.deny.operator uint64_t() };
+			if (value.id == guildId) {
+				returnValue.everyoneAllow = newOverwrite.allow;
+				returnValue.everyoneDeny  = newOverwrite.deny;
+			} else if (value.type == permission_overwrites_type::user_data) {
+				returnValue.memberOverwrites.emplace_back(newOverwrite);
+			} else {
+				returnValue.roleOverwrites.emplace_back(newOverwrite);
+			}
+		}
+		return returnValue;
+	}
+
 	jsonifier::string constructMultiPartData(jsonifier::string_view data, const jsonifier::vector<file>& files) {
 		static constexpr jsonifier::string_view boundary{ "boundary25" };
 		static constexpr jsonifier::string_view partStart("--boundary25\r\nContent-type: application/octet-stream\r\nContent-disposition: form-data; ");
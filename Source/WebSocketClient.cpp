@@ -38,142 +38,51 @@
 #include <random>
 #include <stack>
 
+#if defined(__linux__)
+	#include <sys/eventfd.h>
+	#include <sys/epoll.h>
+#endif
+
 namespace discord_core_api {
 
 	extern voice_connections_map voiceConnectionMap;
 
 	namespace discord_core_internal {
 
-		event_converter::event_converter(const jsonifier::string& newEvent) {
-			eventValue = newEvent;
-		}
-
-		event_converter::operator uint64_t() {
-			if (eventValue == "READY") {
-				return 1;
-			} else if (eventValue == "RESUMED") {
-				return 2;
-			} else if (eventValue == "APPLICATION_COMMAND_PERMISSIONS_UPDATE") {
-				return 3;
-			} else if (eventValue == "AUTO_MODERATION_RULE_CREATE") {
-				return 4;
-			} else if (eventValue == "AUTO_MODERATION_RULE_UPDATE") {
-				return 5;
-			} else if (eventValue == "AUTO_MODERATION_RULE_DELETE") {
-				return 6;
-			} else if (eventValue == "AUTO_MODERATION_ACTION_EXECUTION") {
-				return 7;
-			} else if (eventValue == "CHANNEL_CREATE") {
-				return 8;
-			} else if (eventValue == "CHANNEL_UPDATE") {
-				return 9;
-			} else if (eventValue == "CHANNEL_DELETE") {
-				return 10;
-			} else if (eventValue == "CHANNEL_PINS_UPDATE") {
-				return 11;
-			} else if (eventValue == "THREAD_CREATE") {
-				return 12;
-			} else if (eventValue == "THREAD_UPDATE") {
-				return 13;
-			} else if (eventValue == "THREAD_DELETE") {
-				return 14;
-			} else if (eventValue == "THREAD_LIST_SYNC") {
-				return 15;
-			} else if (eventValue == "THREAD_MEMBER_UPDATE") {
-				return 16;
-			} else if (eventValue == "THREAD_MEMBERS_UPDATE") {
-				return 17;
-			} else if (eventValue == "GUILD_CREATE") {
-				return 18;
-			} else if (eventValue == "GUILD_UPDATE") {
-				return 19;
-			} else if (eventValue == "GUILD_DELETE") {
-				return 20;
-			} else if (eventValue == "GUILD_BAN_ADD") {
-				return 21;
-			} else if (eventValue == "GUILD_BAN_REMOVE") {
-				return 22;
-			} else if (eventValue == "GUILD_EMOJIS_UPDATE") {
-				return 23;
-			} else if (eventValue == "GUILD_STICKERS_UPDATE") {
-				return 24;
-			} else if (eventValue == "GUILD_INTEGRATIONS_UPDATE") {
-				return 25;
-			} else if (eventValue == "GUILD_MEMBER_ADD") {
-				return 26;
-			} else if (eventValue == "GUILD_MEMBER_REMOVE") {
-				return 27;
-			} else if (eventValue == "GUILD_MEMBER_UPDATE") {
-				return 28;
-			} else if (eventValue == "GUILD_MEMBERS_CHUNK") {
-				return 29;
-			} else if (eventValue == "GUILD_ROLE_CREATE") {
-				return 30;
-			} else if (eventValue == "GUILD_ROLE_UPDATE") {
-				return 31;
-			} else if (eventValue == "GUILD_ROLE_DELETE") {
-				return 32;
-			} else if (eventValue == "GUILD_SCHEDULED_EVENT_CREATE") {
-				return 33;
-			} else if (eventValue == "GUILD_SCHEDULED_EVENT_UPDATE") {
-				return 34;
-			} else if (eventValue == "GUILD_SCHEDULED_EVENT_DELETE") {
-				return 35;
-			} else if (eventValue == "GUILD_SCHEDULED_EVENT_USER_ADD") {
-				return 36;
-			} else if (eventValue == "GUILD_SCHEDULED_EVENT_USER_REMOVE") {
-				return 37;
-			} else if (eventValue == "INTEGRATION_CREATE") {
-				return 38;
-			} else if (eventValue == "INTEGRATION_UPDATE") {
-				return 39;
-			} else if (eventValue == "INTEGRATION_DELETE") {
-				return 40;
-			} else if (eventValue == "INTERACTION_CREATE") {
-				return 41;
-			} else if (eventValue == "INVITE_CREATE") {
-				return 42;
-			} else if (eventValue == "INVITE_DELETE") {
-				return 43;
-			} else if (eventValue == "MESSAGE_CREATE") {
-				return 44;
-			} else if (eventValue == "MESSAGE_UPDATE") {
-				return 45;
-			} else if (eventValue == "MESSAGE_DELETE") {
-				return 46;
-			} else if (eventValue == "MESSAGE_DELETE_BULK") {
-				return 47;
-			} else if (eventValue == "MESSAGE_REACTION_ADD") {
-				return 48;
-			} else if (eventValue == "MESSAGE_REACTION_REMOVE") {
-				return 49;
-			} else if (eventValue == "MESSAGE_REACTION_REMOVE_ALL") {
-				return 50;
-			} else if (eventValue == "MESSAGE_REACTION_REMOVE_EMOJI") {
-				return 51;
-			} else if (eventValue == "PRESENCE_UPDATE") {
-				return 52;
-			} else if (eventValue == "STAGE_INSTANCE_CREATE") {
-				return 53;
-			} else if (eventValue == "STAGE_INSTANCE_UPDATE") {
-				return 54;
-			} else if (eventValue == "STAGE_INSTANCE_DELETE") {
-				return 55;
-			} else if (eventValue == "TYPING_START") {
-				return 56;
-			} else if (eventValue == "USER_UPDATE") {
-				return 57;
-			} else if (eventValue == "VOICE_STATE_UPDATE") {
-				return 58;
-			} else if (eventValue == "VOICE_SERVER_UPDATE") {
-				return 59;
-			} else if (eventValue == "WEBHOOKS_UPDATE") {
-				return 60;
-			} else {
-				return 0;
+		/// @brief Parses a dispatch event and hands it to its event_manager event, for the dispatch switch generated from DCA_GATEWAY_EVENTS.
+		/// @tparam data_type the type of the event's data.
+		/// @tparam alwaysParse whether to parse the event even if nothing listens for it, for events whose parsing updates the caches.
+		/// @param event the event_manager event to fire.
+		/// @param dataNew the event's payload.
+		/// @param args any further arguments to the data_type's constructor.
+		template<typename data_type, bool alwaysParse, typename event_type, typename... arg_types>
+		DCA_INLINE void dispatchGatewayEvent(event_type& event, jsonifier::string_view_base<uint8_t> dataNew, arg_types... args) {
+			if (alwaysParse || event.functions.size() > 0) {
+				unique_ptr<data_type> dataPackage{ makeUnique<data_type>(parser, dataNew, args...) };
+				if (event.functions.size() > 0) {
+					event(*dataPackage);
+				}
 			}
 		}
 
+#define DCA_GATEWAY_DISPATCH_session(enumerator, data_type, event)
+#define DCA_GATEWAY_DISPATCH_listened(enumerator, data_type, event) \
+	case gateway_event_type::enumerator: { \
+		dispatchGatewayEvent<data_type, false>(discord_core_client::getInstance()->eventManager.event, dataNew); \
+		break; \
+	}
+#define DCA_GATEWAY_DISPATCH_always(enumerator, data_type, event) \
+	case gateway_event_type::enumerator: { \
+		dispatchGatewayEvent<data_type, true>(discord_core_client::getInstance()->eventManager.event, dataNew); \
+		break; \
+	}
+#define DCA_GATEWAY_DISPATCH_always_with_shard(enumerator, data_type, event) \
+	case gateway_event_type::enumerator: { \
+		dispatchGatewayEvent<data_type, true>(discord_core_client::getInstance()->eventManager.event, dataNew, this); \
+		break; \
+	}
+#define DCA_GATEWAY_EVENT_DISPATCH(enumerator, name, data_type, event, policy) DCA_GATEWAY_DISPATCH_##policy(enumerator, data_type, event)
+
 		websocket_core::websocket_core(config_manager* configManagerNew, websocket_type typeOfWebSocketNew) {
 			configManager = configManagerNew;
 			wsType		  = typeOfWebSocketNew;
@@ -184,7 +93,6 @@ namespace discord_core_api {
 			currentState.store(other.currentState.load(std::memory_order_acquire), std::memory_order_release);
 			heartBeatStopWatch		   = std::move(other.heartBeatStopWatch);
 			haveWeReceivedHeartbeatAck = other.haveWeReceivedHeartbeatAck;
-			currentMessage			   = std::move(other.currentMessage);
 			tcpConnection			   = std::move(other.tcpConnection);
 			currentReconnectTries	   = other.currentReconnectTries;
 			lastNumberReceived		   = other.lastNumberReceived;
@@ -235,22 +143,21 @@ namespace discord_core_api {
 			std::unique_lock lock{ accessMutex };
 			if (areWeConnected()) {
 				tcpConnection.writeData(static_cast<jsonifier::string_view_base<uint8_t>>(dataToSend), priority);
-				if (tcpConnection.currentStatus != connection_status::NO_Error) {
-					onClosed();
-					return false;
-				}
+				lock.unlock();
+				onMessageQueued();
 			}
 			return true;
 		}
 
+		void websocket_core::onMessageQueued() {
+		}
+
 		void websocket_core::parseConnectionHeaders() {
 			if (areWeConnected() && currentState.load(std::memory_order_acquire) == websocket_state::upgrading) {
-				jsonifier::string_base<uint8_t> newString{};
-				newString.resize(4);
-				std::memcpy(newString.data(), "\r\n\r\n", 4);
-				auto theFindValue = currentMessage.find(newString);
+				auto currentMessage = tcpConnection.peekInputBuffer();
+				auto theFindValue	= jsonifier::string_view{ reinterpret_cast<const char*>(currentMessage.data()), currentMessage.size() }.find("\r\n\r\n");
 				if (theFindValue != jsonifier::string::npos) {
-					currentMessage.clear();
+					tcpConnection.consumeInputBuffer(theFindValue + 4);
 					currentState.store(websocket_state::Collecting_Hello, std::memory_order_release);
 					return;
 				}
@@ -281,10 +188,11 @@ namespace discord_core_api {
 		}
 
 		bool websocket_core::parseMessage() {
+			auto currentMessage = tcpConnection.peekInputBuffer();
 			if (currentMessage.size() < 4) {
 				return false;
 			} else {
-				websocket_op_code opcode = static_cast<websocket_op_code>(currentMessage.at(0) & ~webSocketMaskBit);
+				websocket_op_code opcode = static_cast<websocket_op_code>(currentMessage[0] & ~webSocketMaskBit);
 				switch (opcode) {
 					case websocket_op_code::Op_Continuation:
 						[[fallthrough]];
@@ -295,7 +203,7 @@ namespace discord_core_api {
 					case websocket_op_code::Op_Ping:
 						[[fallthrough]];
 					case websocket_op_code::Op_Pong: {
-						uint8_t length00	   = currentMessage.at(1);
+						uint8_t length00	   = currentMessage[1];
 						uint32_t messageOffset = 2;
 
 						if (length00 & webSocketMaskBit) {
@@ -309,8 +217,8 @@ namespace discord_core_api {
 								return false;
 							}
 
-							uint8_t length01 = static_cast<uint8_t>(currentMessage.at(2));
-							uint8_t length02 = static_cast<uint8_t>(currentMessage.at(3));
+							uint8_t length01 = static_cast<uint8_t>(currentMessage[2]);
+							uint8_t length02 = static_cast<uint8_t>(currentMessage[3]);
 							lengthFinal		 = static_cast<uint64_t>((length01 << 8ULL) | length02);
 
 							messageOffset += 2;
@@ -320,7 +228,7 @@ namespace discord_core_api {
 							}
 							lengthFinal = 0;
 							for (uint64_t x = 2, shift = 56; x < 10; ++x, shift -= 8) {
-								uint8_t length03 = static_cast<uint8_t>(currentMessage.at(x));
+								uint8_t length03 = static_cast<uint8_t>(currentMessage[x]);
 								lengthFinal |= static_cast<uint64_t>(length03 & 0xff) << shift;
 							}
 							messageOffset += 8;
@@ -334,14 +242,14 @@ namespace discord_core_api {
 							return false;
 						} else {
 							onMessageReceived({ currentMessage.data() + messageOffset, lengthFinal });
-							currentMessage.erase(messageOffset + lengthFinal);
+							tcpConnection.consumeInputBuffer(messageOffset + lengthFinal);
 						}
 						return true;
 					} break;
 					case websocket_op_code::Op_Close: {
-						uint16_t closeValue = static_cast<uint16_t>(currentMessage.at(2) & 0xff);
+						uint16_t closeValue = static_cast<uint16_t>(currentMessage[2] & 0xff);
 						closeValue <<= 8;
-						closeValue |= currentMessage.at(3) & 0xff;
+						closeValue |= currentMessage[3] & 0xff;
 						jsonifier::string closeString{};
 						if (wsType == websocket_type::voice) {
 							voice_websocket_close voiceClose{ closeValue };
@@ -368,15 +276,10 @@ namespace discord_core_api {
 		}
 
 		void websocket_tcpconnection::handleBuffer() {
-			auto inputBufferNew = getInputBuffer();
-			auto oldSize		= ptr->currentMessage.size();
-			if (ptr->currentMessage.size() < oldSize + inputBufferNew.size()) {
-				ptr->currentMessage.resize(oldSize + inputBufferNew.size());
-			}
-			std::memcpy(ptr->currentMessage.data() + oldSize, inputBufferNew.data(), inputBufferNew.size());
 			if (ptr->currentState.load(std::memory_order_acquire) == websocket_state::upgrading) {
 				ptr->parseConnectionHeaders();
-			} else {
+			}
+			if (ptr->currentState.load(std::memory_order_acquire) != websocket_state::upgrading) {
 				while (ptr->parseMessage()) {
 				};
 			}
@@ -394,6 +297,9 @@ namespace discord_core_api {
 				} else {
 					dataOpCode = websocket_op_code::Op_Text;
 				}
+				if (discord_core_client::getInstance()->configManager.doWeUseZlibStream()) {
+					zlibDecompressor = makeUnique<zlib_decompressor_wrapper>();
+				}
 			}
 		}
 
@@ -460,490 +366,87 @@ namespace discord_core_api {
 
 		bool websocket_client::onMessageReceived(jsonifier::string_view_base<uint8_t> dataNew) {
 			try {
-				std::string newString{};
-				newString.resize(dataNew.size());
-				std::memcpy(newString.data(), dataNew.data(), dataNew.size());
-				if (areWeConnected() && currentMessage.size() > 0 && dataNew.size() > 0) {
+				if (areWeConnected() && dataNew.size() > 0) {
+					if (zlibDecompressor) {
+						try {
+							if (!zlibDecompressor->decompressData(dataNew, dataNew)) {
+								return true;
+							}
+						} catch (const dca_exception& error) {
+							message_printer::printError<print_message_type::websocket>(error.what());
+							tcpConnection.getInputBuffer();
+							onClosed();
+							return false;
+						}
+					}
 					websocket_message message{};
 					if (configManager->getTextFormat() == text_format::etf) {
 						try {
-							dataNew = etfParser.parseEtfToJson(dataNew);
-							parser.parseJson<jsonifier::parse_options{ .partialRead = true }>(message, dataNew);
-							for (auto& valueNew: parser.getErrors()) {
-								message_printer::printError<print_message_type::websocket>(valueNew.reportError() + ", for data:" + dataNew);
+							auto envelope = etfParser.parseEtfEnvelope(dataNew);
+							message.op	  = envelope.op;
+							if (envelope.haveS) {
+								message.s = envelope.s;
+							}
+							if (envelope.haveT) {
+								message.t = jsonifier::string{ envelope.t };
 							}
+							dataNew = etfParser.parseEtfDataTerm(dataNew, envelope);
 						} catch (const dca_exception& error) {
 							message_printer::printError<print_message_type::websocket>(error.what());
 							tcpConnection.getInputBuffer();
-							currentMessage.clear();
 							return false;
 						}
 					} else {
-						parser.parseJson<jsonifier::parse_options{ .partialRead = true }>(message, dataNew);
-						if (auto result = parser.getErrors(); result.size() > 0) {
-							for (auto& valueNew: result) {
-								message_printer::printError<print_message_type::websocket>(valueNew.reportError() + ", for data:" + dataNew);
-							}
+						try {
+							dataNew = json_envelope_parser::parseJsonEnvelope(dataNew, message);
+						} catch (const dca_exception& error) {
+							message_printer::printError<print_message_type::websocket>(error.what());
+							tcpConnection.getInputBuffer();
+							return false;
 						}
 					}
 
 					if (message.s.has_value()) {
 						if (message.s.value() != 0) {
-							std::cout << "CURRENT TYPE: " << message.s.value() << std::endl;
 							lastNumberReceived = static_cast<uint32_t>(message.s.value());
 						}
 					}
 
-					std::cout << "CURRENT TYPE: " << message.op << std::endl;
-
 					message_printer::printSuccess<print_message_type::websocket>("Message received from websocket [" + jsonifier::toString(shard.at(0)) + "," +
-						jsonifier::toString(shard.at(1)) + jsonifier::string("]: ") + jsonifier::string{ dataNew });
+						jsonifier::toString(shard.at(1)) + jsonifier::string("]: ") +
+						(configManager->getTextFormat() == text_format::etf ? "etf payload of " + jsonifier::toString(dataNew.size()) + " bytes" : jsonifier::string{ dataNew }));
 					switch (static_cast<websocket_op_codes>(message.op)) {
 						case websocket_op_codes::dispatch: {
 							if (message.t.has_value()) {
 								if (message.t.value() != "") {
-									std::cout << "CURRENT TYPE: " << message.t.value() << std::endl;
-									switch (event_converter{ message.t.value() }) {
-										case 1: {
-											websocket_message_data<ready_data> data{};
+									switch (static_cast<gateway_event_type>(event_converter{ message.t.value() })) {
+										case gateway_event_type::Ready: {
+											ready_data data{};
 											if (dataOpCode == websocket_op_code::Op_Text) {
-												data.d.jsonifierExcludedKeys.emplace("shard");
+												data.jsonifierExcludedKeys.emplace("shard");
 											}
 											currentState.store(websocket_state::authenticated, std::memory_order_release);
-											parser.parseJson<jsonifier::parse_options{ .partialRead = true }>(data, dataNew);
-											if (auto result = parser.getErrors(); result.size() > 0) {
-												for (auto& valueNew: result) {
-													message_printer::printError<print_message_type::websocket>(valueNew.reportError());
-												}
-											}
-											sessionId = data.d.sessionId;
-											if (data.d.resumeGatewayUrl.find("wss://") != jsonifier::string::npos) {
-												resumeUrl = data.d.resumeGatewayUrl.substr(data.d.resumeGatewayUrl.find("wss://") + jsonifier::string{ "wss://" }.size());
+											parseGatewayData(parser, data, dataNew);
+											sessionId = data.sessionId;
+											if (data.resumeGatewayUrl.find("wss://") != jsonifier::string::npos) {
+												resumeUrl = data.resumeGatewayUrl.substr(data.resumeGatewayUrl.find("wss://") + jsonifier::string{ "wss://" }.size());
 											}
-											discord_core_client::getInstance()->currentUser = bot_user{ data.d.user,
+											discord_core_client::getInstance()->currentUser = bot_user{ data.user,
 												discord_core_client::getInstance()
 													->baseSocketAgentsMap[static_cast<uint64_t>(floor(static_cast<uint64_t>(shard.at(0)) %
 														static_cast<uint64_t>(discord_core_client::getInstance()->baseSocketAgentsMap.size())))]
 													.get() };
-											users::insertUser(static_cast<user_cache_data>(std::move(data.d.user)));
+											users::insertUser(static_cast<user_cache_data>(std::move(data.user)));
 											currentReconnectTries = 0;
 											break;
 										}
-										case 2: {
+										case gateway_event_type::Resumed: {
 											currentState.store(websocket_state::authenticated, std::memory_order_release);
 											currentReconnectTries = 0;
 											break;
 										}
-										case 3: {
-											if (discord_core_client::getInstance()->eventManager.onApplicationCommandPermissionsUpdateEvent.functions.size() > 0) {
-												unique_ptr<on_application_command_permissions_update_data> dataPackage{ makeUnique<on_application_command_permissions_update_data>(
-													parser, dataNew) };
-												discord_core_client::getInstance()->eventManager.onApplicationCommandPermissionsUpdateEvent(*dataPackage);
-											}
-											break;
-										}
-										case 4: {
-											if (discord_core_client::getInstance()->eventManager.onAutoModerationRuleCreationEvent.functions.size() > 0) {
-												unique_ptr<on_auto_moderation_rule_creation_data> dataPackage{ makeUnique<on_auto_moderation_rule_creation_data>(parser, dataNew) };
-												discord_core_client::getInstance()->eventManager.onAutoModerationRuleCreationEvent(*dataPackage);
-											}
-											break;
-										}
-										case 5: {
-											if (discord_core_client::getInstance()->eventManager.onAutoModerationRuleUpdateEvent.functions.size() > 0) {
-												unique_ptr<on_auto_moderation_rule_update_data> dataPackage{ makeUnique<on_auto_moderation_rule_update_data>(parser, dataNew) };
-												discord_core_client::getInstance()->eventManager.onAutoModerationRuleUpdateEvent(*dataPackage);
-											}
-											break;
-										}
-										case 6: {
-											if (discord_core_client::getInstance()->eventManager.onAutoModerationRuleDeletionEvent.functions.size() > 0) {
-												unique_ptr<on_auto_moderation_rule_deletion_data> dataPackage{ makeUnique<on_auto_moderation_rule_deletion_data>(parser, dataNew) };
-												discord_core_client::getInstance()->eventManager.onAutoModerationRuleDeletionEvent(*dataPackage);
-											}
-											break;
-										}
-										case 7: {
-											if (discord_core_client::getInstance()->eventManager.onAutoModerationActionExecutionEvent.functions.size() > 0) {
-												unique_ptr<on_auto_moderation_action_execution_data> dataPackage{ makeUnique<on_auto_moderation_action_execution_data>(parser,
-													dataNew) };
-												discord_core_client::getInstance()->eventManager.onAutoModerationActionExecutionEvent(*dataPackage);
-											}
-											break;
-										}
-										case 8: {
-											unique_ptr<on_channel_creation_data> dataPackage{ makeUnique<on_channel_creation_data>(parser, dataNew) };
-											if (discord_core_client::getInstance()->eventManager.onChannelCreationEvent.functions.size() > 0) {
-												discord_core_client::getInstance()->eventManager.onChannelCreationEvent(*dataPackage);
-											}
-											break;
-										}
-										case 9: {
-											unique_ptr<on_channel_update_data> dataPackage{ makeUnique<on_channel_update_data>(parser, dataNew) };
-											if (discord_core_client::getInstance()->eventManager.onChannelUpdateEvent.functions.size() > 0) {
-												discord_core_client::getInstance()->eventManager.onChannelUpdateEvent(*dataPackage);
-											}
-											break;
-										}
-										case 10: {
-											unique_ptr<on_channel_deletion_data> dataPackage{ makeUnique<on_channel_deletion_data>(parser, dataNew) };
-											if (discord_core_client::getInstance()->eventManager.onChannelDeletionEvent.functions.size() > 0) {
-												discord_core_client::getInstance()->eventManager.onChannelDeletionEvent(*dataPackage);
-											}
-											break;
-										}
-										case 11: {
-											if (discord_core_client::getInstance()->eventManager.onChannelPinsUpdateEvent.functions.size() > 0) {
-												unique_ptr<on_channel_pins_update_data> dataPackage{ makeUnique<on_channel_pins_update_data>(parser, dataNew) };
-												discord_core_client::getInstance()->eventManager.onChannelPinsUpdateEvent(*dataPackage);
-											}
-											break;
-										}
-										case 12: {
-											if (discord_core_client::getInstance()->eventManager.onThreadCreationEvent.functions.size() > 0) {
-												unique_ptr<on_thread_creation_data> dataPackage{ makeUnique<on_thread_creation_data>(parser, dataNew) };
-												discord_core_client::getInstance()->eventManager.onThreadCreationEvent(*dataPackage);
-											}
-											break;
-										}
-										case 13: {
-											if (discord_core_client::getInstance()->eventManager.onThreadUpdateEvent.functions.size() > 0) {
-												unique_ptr<on_thread_update_data> dataPackage{ makeUnique<on_thread_update_data>(parser, dataNew) };
-												discord_core_client::getInstance()->eventManager.onThreadUpdateEvent(*dataPackage);
-											}
-											break;
-										}
-										case 14: {
-											if (discord_core_client::getInstance()->eventManager.onThreadDeletionEvent.functions.size() > 0) {
-												unique_ptr<on_thread_deletion_data> dataPackage{ makeUnique<on_thread_deletion_data>(parser, dataNew) };
-												discord_core_client::getInstance()->eventManager.onThreadDeletionEvent(*dataPackage);
-											}
-											break;
-										}
-										case 15: {
-											if (discord_core_client::getInstance()->eventManager.onThreadListSyncEvent.functions.size() > 0) {
-												unique_ptr<on_thread_list_sync_data> dataPackage{ makeUnique<on_thread_list_sync_data>(parser, dataNew) };
-												discord_core_client::getInstance()->eventManager.onThreadListSyncEvent(*dataPackage);
-											}
-											break;
-										}
-										case 16: {
-											if (discord_core_client::getInstance()->eventManager.onThreadMemberUpdateEvent.functions.size() > 0) {
-												unique_ptr<on_thread_member_update_data> dataPackage{ makeUnique<on_thread_member_update_data>(parser, dataNew) };
-												discord_core_client::getInstance()->eventManager.onThreadMemberUpdateEvent(*dataPackage);
-											}
-											break;
-										}
-										case 17: {
-											if (discord_core_client::getInstance()->eventManager.onThreadMembersUpdateEvent.functions.size() > 0) {
-												unique_ptr<on_thread_members_update_data> dataPackage{ makeUnique<on_thread_members_update_data>(parser, dataNew) };
-												discord_core_client::getInstance()->eventManager.onThreadMembersUpdateEvent(*dataPackage);
-											}
-											break;
-										}
-										case 18: {
-											unique_ptr<on_guild_creation_data> dataPackage{ makeUnique<on_guild_creation_data>(parser, dataNew) };
-											if (discord_core_client::getInstance()->eventManager.onGuildCreationEvent.functions.size() > 0) {
-												discord_core_client::getInstance()->eventManager.onGuildCreationEvent(*dataPackage);
-											}
-											break;
-										}
-										case 19: {
-											unique_ptr<on_guild_update_data> dataPackage{ makeUnique<on_guild_update_data>(parser, dataNew) };
-											if (discord_core_client::getInstance()->eventManager.onGuildUpdateEvent.functions.size() > 0) {
-												discord_core_client::getInstance()->eventManager.onGuildUpdateEvent(*dataPackage);
-											}
-											break;
-										}
-										case 20: {
-											unique_ptr<on_guild_deletion_data> dataPackage{ makeUnique<on_guild_deletion_data>(parser, dataNew) };
-											if (discord_core_client::getInstance()->eventManager.onGuildDeletionEvent.functions.size() > 0) {
-												discord_core_client::getInstance()->eventManager.onGuildDeletionEvent(*dataPackage);
-											}
-											break;
-										}
-										case 21: {
-											if (discord_core_client::getInstance()->eventManager.onGuildBanAddEvent.functions.size() > 0) {
-												unique_ptr<on_guild_ban_add_data> dataPackage{ makeUnique<on_guild_ban_add_data>(parser, dataNew) };
-												discord_core_client::getInstance()->eventManager.onGuildBanAddEvent(*dataPackage);
-											}
-											break;
-										}
-										case 22: {
-											if (discord_core_client::getInstance()->eventManager.onGuildBanRemoveEvent.functions.size() > 0) {
-												unique_ptr<on_guild_ban_remove_data> dataPackage{ makeUnique<on_guild_ban_remove_data>(parser, dataNew) };
-												discord_core_client::getInstance()->eventManager.onGuildBanRemoveEvent(*dataPackage);
-											}
-											break;
-										}
-										case 23: {
-											if (discord_core_client::getInstance()->eventManager.onGuildEmojisUpdateEvent.functions.size() > 0) {
-												unique_ptr<on_guild_emojis_update_data> dataPackage{ makeUnique<on_guild_emojis_update_data>(parser, dataNew) };
-												discord_core_client::getInstance()->eventManager.onGuildEmojisUpdateEvent(*dataPackage);
-											}
-											break;
-										}
-										case 24: {
-											if (discord_core_client::getInstance()->eventManager.onGuildStickersUpdateEvent.functions.size() > 0) {
-												unique_ptr<on_guild_stickers_update_data> dataPackage{ makeUnique<on_guild_stickers_update_data>(parser, dataNew) };
-												discord_core_client::getInstance()->eventManager.onGuildStickersUpdateEvent(*dataPackage);
-											}
-											break;
-										}
-										case 25: {
-											if (discord_core_client::getInstance()->eventManager.onGuildIntegrationsUpdateEvent.functions.size() > 0) {
-												unique_ptr<on_guild_integrations_update_data> dataPackage{ makeUnique<on_guild_integrations_update_data>(parser, dataNew) };
-												discord_core_client::getInstance()->eventManager.onGuildIntegrationsUpdateEvent(*dataPackage);
-											}
-											break;
-										}
-										case 26: {
-											unique_ptr<on_guild_member_add_data> dataPackage{ makeUnique<on_guild_member_add_data>(parser, dataNew) };
-											if (discord_core_client::getInstance()->eventManager.onGuildMemberAddEvent.functions.size() > 0) {
-												discord_core_client::getInstance()->eventManager.onGuildMemberAddEvent(*dataPackage);
-											}
-											break;
-										}
-										case 27: {
-											unique_ptr<on_guild_member_remove_data> dataPackage{ makeUnique<on_guild_member_remove_data>(parser, dataNew) };
-											if (discord_core_client::getInstance()->eventManager.onGuildMemberRemoveEvent.functions.size() > 0) {
-												discord_core_client::getInstance()->eventManager.onGuildMemberRemoveEvent(*dataPackage);
-											}
-											break;
-										}
-										case 28: {
-											unique_ptr<on_guild_member_update_data> dataPackage{ makeUnique<on_guild_member_update_data>(parser, dataNew) };
-											if (discord_core_client::getInstance()->eventManager.onGuildMemberUpdateEvent.functions.size() > 0) {
-												discord_core_client::getInstance()->eventManager.onGuildMemberUpdateEvent(*dataPackage);
-											}
-											break;
-										}
-										case 29: {
-											if (discord_core_client::getInstance()->eventManager.onGuildMembersChunkEvent.functions.size() > 0) {
-												unique_ptr<on_guild_members_chunk_data> dataPackage{ makeUnique<on_guild_members_chunk_data>(parser, dataNew) };
-												discord_core_client::getInstance()->eventManager.onGuildMembersChunkEvent(*dataPackage);
-											}
-											break;
-										}
-										case 30: {
-											unique_ptr<on_role_creation_data> dataPackage{ makeUnique<on_role_creation_data>(parser, dataNew) };
-											if (discord_core_client::getInstance()->eventManager.onRoleCreationEvent.functions.size() > 0) {
-												discord_core_client::getInstance()->eventManager.onRoleCreationEvent(*dataPackage);
-											}
-											break;
-										}
-										case 31: {
-											unique_ptr<on_role_update_data> dataPackage{ makeUnique<on_role_update_data>(parser, dataNew) };
-											if (discord_core_client::getInstance()->eventManager.onRoleUpdateEvent.functions.size() > 0) {
-												discord_core_client::getInstance()->eventManager.onRoleUpdateEvent(*dataPackage);
-											}
-											break;
-										}
-										case 32: {
-											unique_ptr<on_role_deletion_data> dataPackage{ makeUnique<on_role_deletion_data>(parser, dataNew) };
-											if (discord_core_client::getInstance()->eventManager.onRoleDeletionEvent.functions.size() > 0) {
-												discord_core_client::getInstance()->eventManager.onRoleDeletionEvent(*dataPackage);
-											}
-											break;
-										}
-										case 33: {
-											if (discord_core_client::getInstance()->eventManager.onGuildScheduledEventCreationEvent.functions.size() > 0) {
-												unique_ptr<on_guild_scheduled_event_creation_data> dataPackage{ makeUnique<on_guild_scheduled_event_creation_data>(parser,
-													dataNew) };
-												discord_core_client::getInstance()->eventManager.onGuildScheduledEventCreationEvent(*dataPackage);
-											}
-											break;
-										}
-										case 34: {
-											if (discord_core_client::getInstance()->eventManager.onGuildScheduledEventUpdateEvent.functions.size() > 0) {
-												unique_ptr<on_guild_scheduled_event_update_data> dataPackage{ makeUnique<on_guild_scheduled_event_update_data>(parser, dataNew) };
-												discord_core_client::getInstance()->eventManager.onGuildScheduledEventUpdateEvent(*dataPackage);
-											}
-											break;
-										}
-										case 35: {
-											if (discord_core_client::getInstance()->eventManager.onGuildScheduledEventDeletionEvent.functions.size() > 0) {
-												unique_ptr<on_guild_scheduled_event_deletion_data> dataPackage{ makeUnique<on_guild_scheduled_event_deletion_data>(parser,
-													dataNew) };
-												discord_core_client::getInstance()->eventManager.onGuildScheduledEventDeletionEvent(*dataPackage);
-											}
-											break;
-										}
-										case 36: {
-											if (discord_core_client::getInstance()->eventManager.onGuildScheduledEventUserAddEvent.functions.size() > 0) {
-												unique_ptr<on_guild_scheduled_event_user_add_data> dataPackage{ makeUnique<on_guild_scheduled_event_user_add_data>(parser,
-													dataNew) };
-												discord_core_client::getInstance()->eventManager.onGuildScheduledEventUserAddEvent(*dataPackage);
-											}
-											break;
-										}
-										case 37: {
-											if (discord_core_client::getInstance()->eventManager.onGuildScheduledEventUserRemoveEvent.functions.size() > 0) {
-												unique_ptr<on_guild_scheduled_event_user_remove_data> dataPackage{ makeUnique<on_guild_scheduled_event_user_remove_data>(parser,
-													dataNew) };
-												discord_core_client::getInstance()->eventManager.onGuildScheduledEventUserRemoveEvent(*dataPackage);
-											}
-											break;
-										}
-										case 38: {
-											if (discord_core_client::getInstance()->eventManager.onIntegrationCreationEvent.functions.size() > 0) {
-												unique_ptr<on_integration_creation_data> dataPackage{ makeUnique<on_integration_creation_data>(parser, dataNew) };
-												discord_core_client::getInstance()->eventManager.onIntegrationCreationEvent(*dataPackage);
-											}
-											break;
-										}
-										case 39: {
-											if (discord_core_client::getInstance()->eventManager.onIntegrationUpdateEvent.functions.size() > 0) {
-												unique_ptr<on_integration_update_data> dataPackage{ makeUnique<on_integration_update_data>(parser, dataNew) };
-												discord_core_client::getInstance()->eventManager.onIntegrationUpdateEvent(*dataPackage);
-											}
-											break;
-										}
-										case 40: {
-											if (discord_core_client::getInstance()->eventManager.onIntegrationDeletionEvent.functions.size() > 0) {
-												unique_ptr<on_integration_deletion_data> dataPackage{ makeUnique<on_integration_deletion_data>(parser, dataNew) };
-												discord_core_client::getInstance()->eventManager.onIntegrationDeletionEvent(*dataPackage);
-											}
-											break;
-										}
-										case 41: {
-											unique_ptr<on_interaction_creation_data> dataPackage{ makeUnique<on_interaction_creation_data>(parser, dataNew) };
-											if (discord_core_client::getInstance()->eventManager.onInteractionCreationEvent.functions.size() > 0) {
-												discord_core_client::getInstance()->eventManager.onInteractionCreationEvent(*dataPackage);
-											}
-											break;
-										}
-										case 42: {
-											if (discord_core_client::getInstance()->eventManager.onInviteCreationEvent.functions.size() > 0) {
-												unique_ptr<on_invite_creation_data> dataPackage{ makeUnique<on_invite_creation_data>(parser, dataNew) };
-												discord_core_client::getInstance()->eventManager.onInviteCreationEvent(*dataPackage);
-											}
-											break;
-										}
-										case 43: {
-											if (discord_core_client::getInstance()->eventManager.onInviteDeletionEvent.functions.size() > 0) {
-												unique_ptr<on_invite_deletion_data> dataPackage{ makeUnique<on_invite_deletion_data>(parser, dataNew) };
-												discord_core_client::getInstance()->eventManager.onInviteDeletionEvent(*dataPackage);
-											}
-											break;
-										}
-										case 44: {
-											unique_ptr<on_message_creation_data> dataPackage{ makeUnique<on_message_creation_data>(parser, dataNew) };
-											if (discord_core_client::getInstance()->eventManager.onMessageCreationEvent.functions.size() > 0) {
-												discord_core_client::getInstance()->eventManager.onMessageCreationEvent(*dataPackage);
-											}
-											break;
-										}
-										case 45: {
-											unique_ptr<on_message_update_data> dataPackage{ makeUnique<on_message_update_data>(parser, dataNew) };
-											if (discord_core_client::getInstance()->eventManager.onMessageUpdateEvent.functions.size() > 0) {
-												discord_core_client::getInstance()->eventManager.onMessageUpdateEvent(*dataPackage);
-											}
-											break;
-										}
-										case 46: {
-											if (discord_core_client::getInstance()->eventManager.onMessageDeletionEvent.functions.size() > 0) {
-												unique_ptr<on_message_deletion_data> dataPackage{ makeUnique<on_message_deletion_data>(parser, dataNew) };
-												discord_core_client::getInstance()->eventManager.onMessageDeletionEvent(*dataPackage);
-											}
-											break;
-										}
-										case 47: {
-											if (discord_core_client::getInstance()->eventManager.onMessageDeleteBulkEvent.functions.size() > 0) {
-												unique_ptr<on_message_delete_bulk_data> dataPackage{ makeUnique<on_message_delete_bulk_data>(parser, dataNew) };
-												discord_core_client::getInstance()->eventManager.onMessageDeleteBulkEvent(*dataPackage);
-											}
-											break;
-										}
-										case 48: {
-											if (discord_core_client::getInstance()->eventManager.onReactionAddEvent.functions.size() > 0) {
-												unique_ptr<on_reaction_add_data> dataPackage{ makeUnique<on_reaction_add_data>(parser, dataNew) };
-												discord_core_client::getInstance()->eventManager.onReactionAddEvent(*dataPackage);
-											}
-											break;
-										}
-										case 49: {
-											if (discord_core_client::getInstance()->eventManager.onReactionRemoveEvent.functions.size() > 0) {
-												unique_ptr<on_reaction_remove_data> dataPackage{ makeUnique<on_reaction_remove_data>(parser, dataNew) };
-												discord_core_client::getInstance()->eventManager.onReactionRemoveEvent(*dataPackage);
-											}
-											break;
-										}
-										case 50: {
-											if (discord_core_client::getInstance()->eventManager.onReactionRemoveAllEvent.functions.size() > 0) {
-												unique_ptr<on_reaction_remove_all_data> dataPackage{ makeUnique<on_reaction_remove_all_data>(parser, dataNew) };
-												discord_core_client::getInstance()->eventManager.onReactionRemoveAllEvent(*dataPackage);
-											}
-											break;
-										}
-										case 51: {
-											if (discord_core_client::getInstance()->eventManager.onReactionRemoveEmojiEvent.functions.size() > 0) {
-												unique_ptr<on_reaction_remove_emoji_data> dataPackage{ makeUnique<on_reaction_remove_emoji_data>(parser, dataNew) };
-												discord_core_client::getInstance()->eventManager.onReactionRemoveEmojiEvent(*dataPackage);
-											}
-											break;
-										}
-										case 52: {
-											unique_ptr<on_presence_update_data> dataPackage{ makeUnique<on_presence_update_data>(parser, dataNew) };
-											if (discord_core_client::getInstance()->eventManager.onPresenceUpdateEvent.functions.size() > 0) {
-												discord_core_client::getInstance()->eventManager.onPresenceUpdateEvent(*dataPackage);
-											}
-											break;
-										}
-										case 53: {
-											if (discord_core_client::getInstance()->eventManager.onStageInstanceCreationEvent.functions.size() > 0) {
-												unique_ptr<on_stage_instance_creation_data> dataPackage{ makeUnique<on_stage_instance_creation_data>(parser, dataNew) };
-												discord_core_client::getInstance()->eventManager.onStageInstanceCreationEvent(*dataPackage);
-											}
-											break;
-										}
-										case 54: {
-											if (discord_core_client::getInstance()->eventManager.onStageInstanceUpdateEvent.functions.size() > 0) {
-												unique_ptr<on_stage_instance_update_data> dataPackage{ makeUnique<on_stage_instance_update_data>(parser, dataNew) };
-												discord_core_client::getInstance()->eventManager.onStageInstanceUpdateEvent(*dataPackage);
-											}
-											break;
-										}
-										case 55: {
-											if (discord_core_client::getInstance()->eventManager.onStageInstanceDeletionEvent.functions.size() > 0) {
-												unique_ptr<on_stage_instance_deletion_data> dataPackage{ makeUnique<on_stage_instance_deletion_data>(parser, dataNew) };
-												discord_core_client::getInstance()->eventManager.onStageInstanceDeletionEvent(*dataPackage);
-											}
-											break;
-										}
-										case 56: {
-											if (discord_core_client::getInstance()->eventManager.onTypingStartEvent.functions.size() > 0) {
-												unique_ptr<on_typing_start_data> dataPackage{ makeUnique<on_typing_start_data>(parser, dataNew) };
-												discord_core_client::getInstance()->eventManager.onTypingStartEvent(*dataPackage);
-											}
-											break;
-										}
-										case 57: {
-											if (discord_core_client::getInstance()->eventManager.onUserUpdateEvent.functions.size() > 0) {
-												unique_ptr<on_user_update_data> dataPackage{ makeUnique<on_user_update_data>(parser, dataNew) };
-												discord_core_client::getInstance()->eventManager.onUserUpdateEvent(*dataPackage);
-											}
-											break;
-										}
-										case 58: {
-											unique_ptr<on_voice_state_update_data> dataPackage{ makeUnique<on_voice_state_update_data>(parser, dataNew, this) };
-											if (discord_core_client::getInstance()->eventManager.onVoiceStateUpdateEvent.functions.size() > 0) {
-												discord_core_client::getInstance()->eventManager.onVoiceStateUpdateEvent(*dataPackage);
-											}
-											break;
-										}
-										case 59: {
-											unique_ptr<on_voice_server_update_data> dataPackage{ makeUnique<on_voice_server_update_data>(parser, dataNew, this) };
-											if (discord_core_client::getInstance()->eventManager.onVoiceServerUpdateEvent.functions.size() > 0) {
-												discord_core_client::getInstance()->eventManager.onVoiceServerUpdateEvent(*dataPackage);
-											}
-											break;
-										}
-										case 60: {
-											if (discord_core_client::getInstance()->eventManager.onWebhookUpdateEvent.functions.size() > 0) {
-												unique_ptr<on_webhook_update_data> dataPackage{ makeUnique<on_webhook_update_data>(parser, dataNew) };
-												discord_core_client::getInstance()->eventManager.onWebhookUpdateEvent(*dataPackage);
-											}
+										DCA_GATEWAY_EVENTS(DCA_GATEWAY_EVENT_DISPATCH)
+										case gateway_event_type::Unknown: {
 											break;
 										}
 									}
@@ -965,13 +468,8 @@ namespace discord_core_api {
 							return true;
 						}
 						case websocket_op_codes::Invalid_Session: {
-							websocket_message_data<bool> data{};
-							parser.parseJson<jsonifier::parse_options{ .partialRead = true }>(data, dataNew);
-							if (auto result = parser.getErrors(); result.size() > 0) {
-								for (auto& valueNew: result) {
-									message_printer::printError<print_message_type::websocket>(valueNew.reportError());
-								}
-							}
+							bool data{};
+							parseGatewayData(parser, data, dataNew);
 							message_printer::printError<print_message_type::websocket>(
 								"Shard [" + jsonifier::toString(shard.at(0)) + "," + jsonifier::toString(shard.at(1)) + "]" + " reconnecting (type 9)!");
 							std::mt19937_64 randomEngine{ static_cast<uint64_t>(sys_clock::now().time_since_epoch().count()) };
@@ -980,7 +478,7 @@ namespace discord_core_api {
 							if (numOfMsToWait <= 5000 && numOfMsToWait > 0) {
 								std::this_thread::sleep_for(milliseconds{ numOfMsToWait });
 							}
-							if (data.d == true) {
+							if (data == true) {
 								areWeResuming = true;
 							} else {
 								areWeResuming = false;
@@ -989,16 +487,11 @@ namespace discord_core_api {
 							return true;
 						}
 						case websocket_op_codes::hello: {
-							websocket_message_data<hello_data> data{};
-							parser.parseJson<jsonifier::parse_options{ .partialRead = true }>(data, dataNew);
-							if (auto result = parser.getErrors(); result.size() > 0) {
-								for (auto& valueNew: result) {
-									message_printer::printError<print_message_type::websocket>(valueNew.reportError());
-								}
-							}
-							if (data.d.heartbeatInterval != 0) {
+							hello_data data{};
+							parseGatewayData(parser, data, dataNew);
+							if (data.heartbeatInterval != 0) {
 								areWeHeartBeating  = true;
-								heartBeatStopWatch = stop_watch<milliseconds>{ milliseconds{ data.d.heartbeatInterval } };
+								heartBeatStopWatch = stop_watch<milliseconds>{ milliseconds{ data.heartbeatInterval } };
 								heartBeatStopWatch.reset();
 								haveWeReceivedHeartbeatAck = true;
 							}
@@ -1086,6 +579,7 @@ namespace discord_core_api {
 				jsonifier::string dataNew{ "\x03\xE8" };
 				createHeader(dataNew, websocket_op_code::Op_Close);
 				tcpConnection.writeData(static_cast<jsonifier::string_view>(dataNew), true);
+				tcpConnection.processWriteData();
 				tcpConnection.disconnect();
 				currentState.store(websocket_state::disconnected, std::memory_order_release);
 				areWeHeartBeating = false;
@@ -1104,6 +598,15 @@ namespace discord_core_api {
 					doWeQuit->store(true, std::memory_order_release);
 				}
 			}
+			if (agent) {
+				agent->onShardClosed(shard.at(0));
+			}
+		}
+
+		void websocket_client::onMessageQueued() {
+			if (agent) {
+				agent->wake();
+			}
 		}
 
 		websocket_client::~websocket_client() {
@@ -1111,12 +614,46 @@ namespace discord_core_api {
 		}
 
 		base_socket_agent::base_socket_agent(std::atomic_bool* doWeQuitNew) {
-			doWeQuit   = doWeQuitNew;
+			doWeQuit = doWeQuitNew;
+#if defined(__linux__)
+			epollFd = epoll_create1(EPOLL_CLOEXEC);
+			wakeFd	= eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+			epoll_event event{};
+			event.events   = EPOLLIN;
+			event.data.u64 = wakeKey;
+			if (epollFd == -1 || wakeFd == -1 || epoll_ctl(epollFd, EPOLL_CTL_ADD, wakeFd, &event) == -1) {
+				message_printer::printError<print_message_type::websocket>(reportError("base_socket_agent::base_socket_agent()"));
+				if (epollFd != -1) {
+					close(epollFd);
+					epollFd = -1;
+				}
+				if (wakeFd != -1) {
+					close(wakeFd);
+					wakeFd = -1;
+				}
+			}
+#endif
 			taskThread = std::jthread([this](std::stop_token token) {
 				run(token);
 			});
 		}
 
+		void base_socket_agent::wake() {
+#if defined(__linux__)
+			if (wakeFd != -1) {
+				uint64_t value{ 1 };
+				[[maybe_unused]] auto result = write(wakeFd, &value, sizeof(value));
+			}
+#endif
+		}
+
+		void base_socket_agent::onShardClosed([[maybe_unused]] uint64_t key) {
+#if defined(__linux__)
+			closedShards.send(key);
+#endif
+			wake();
+		}
+
 		void base_socket_agent::connect(websocket_client& value) {
 			jsonifier::string connectionUrl{ value.areWeResuming ? value.resumeUrl : discord_core_client::getInstance()->configManager.getConnectionAddress() };
 			message_printer::printSuccess<print_message_type::general>("Connecting shard " + jsonifier::toString(value.shard.at(0) + 1) + " of " +
@@ -1125,14 +662,36 @@ namespace discord_core_api {
 				jsonifier::string{ " shards total across all processes)" });
 			jsonifier::string relativePath{ "/?v=10&encoding=" +
 				jsonifier::string{ discord_core_client::getInstance()->configManager.getTextFormat() == text_format::etf ? "etf" : "json" } };
+			if (discord_core_client::getInstance()->configManager.doWeUseZlibStream()) {
+				relativePath += "&compress=zlib-stream";
+			}
 
-			value = websocket_client{ value.shard.at(0), doWeQuit };
+			{
+				// senders queue their writes under the shard's access mutex, so the old connection's queue cannot be swapped out from under them.
+				std::unique_lock lock{ value.accessMutex };
+				value		= websocket_client{ value.shard.at(0), doWeQuit };
+				value.agent = this;
+			}
 			value.connect(connectionUrl, relativePath, discord_core_client::getInstance()->configManager.getConnectionPort());
 			if (value.tcpConnection.currentStatus != connection_status::NO_Error) {
 				value.onClosed();
 			}
 			value.tcpConnection.processIO(0);
 			discord_core_client::getInstance()->connectionStopWatch01.reset();
+#if defined(__linux__)
+			if (epollFd != -1) {
+				auto key = value.shard.at(0);
+				if (value.areWeConnected()) {
+					epoll_event event{};
+					event.events   = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+					event.data.u64 = key;
+					if (epoll_ctl(epollFd, EPOLL_CTL_ADD, static_cast<SOCKET>(value.tcpConnection.socket), &event) == -1 && errno != EEXIST) {
+						message_printer::printError<print_message_type::websocket>(reportError("base_socket_agent::connect()::epoll_ctl()"));
+					}
+				}
+				timers.schedule(key, timer_wheel::tickInterval);
+			}
+#endif
 		}
 
 		void base_socket_agent::run(std::stop_token token) {
@@ -1140,6 +699,29 @@ namespace discord_core_api {
 			while (!discord_core_client::getInstance()->areWeReadyToConnect.load(std::memory_order_acquire)) {
 				std::this_thread::sleep_for(1ms);
 			}
+#if defined(__linux__)
+			if (epollFd != -1) {
+				std::stop_callback wakeOnStop(token, [this] {
+					wake();
+				});
+				for (auto& [key, value]: shardMap) {
+					while (key != discord_core_client::getInstance()->currentlyConnectingShard.load(std::memory_order_acquire) ||
+						!discord_core_client::getInstance()->connectionStopWatch01.hasTimeElapsed()) {
+						processEvents(1ms);
+					}
+					connect(value);
+					discord_core_client::getInstance()->currentlyConnectingShard.fetch_add(1, std::memory_order_release);
+				}
+				while (!token.stop_requested() && !doWeQuit->load(std::memory_order_acquire)) {
+					try {
+						processEvents(1000ms);
+					} catch (const dca_exception& error) {
+						message_printer::printError<print_message_type::websocket>(error.what());
+					}
+				}
+				return;
+			}
+#endif
 			for (auto& [key, value]: shardMap) {
 				while (key != discord_core_client::getInstance()->currentlyConnectingShard.load(std::memory_order_acquire) ||
 					!discord_core_client::getInstance()->connectionStopWatch01.hasTimeElapsed()) {
@@ -1193,7 +775,106 @@ namespace discord_core_api {
 			}
 		}
 
+#if defined(__linux__)
+		void base_socket_agent::processEvents(milliseconds maximumWait) {
+			static constexpr int32_t maxEventCount{ 64 };
+			std::array<epoll_event, maxEventCount> events{};
+			auto waitTime	= pendingPasses.size() > 0 ? milliseconds{} : timers.getTimeUntilNextTimer(maximumWait);
+			auto eventCount = epoll_wait(epollFd, events.data(), maxEventCount, static_cast<int32_t>(waitTime.count()));
+			if (eventCount == -1) {
+				if (errno != EINTR) {
+					message_printer::printError<print_message_type::websocket>(reportError("base_socket_agent::processEvents()"));
+				}
+				eventCount = 0;
+			}
+			unordered_map<uint64_t, uint32_t> passes{};
+			std::swap(passes, pendingPasses);
+			for (int32_t x = 0; x < eventCount; ++x) {
+				if (events[x].data.u64 == wakeKey) {
+					uint64_t value{};
+					[[maybe_unused]] auto result = read(wakeFd, &value, sizeof(value));
+					for (auto& [key, valueNew]: shardMap) {
+						if (valueNew.tcpConnection.connectState == connect_state::Connected && valueNew.tcpConnection.hasPendingWrites()) {
+							passes[key] |= EPOLLOUT;
+						}
+					}
+					uint64_t key{};
+					while (closedShards.tryReceive(key)) {
+						timers.schedule(key, milliseconds{});
+					}
+					continue;
+				}
+				passes[events[x].data.u64] |= events[x].events;
+			}
+			for (auto& [key, value]: passes) {
+				if (auto iter = shardMap.find(key); iter != shardMap.end()) {
+					if (auto eventsNew = serviceConnection(iter->second, value); eventsNew != 0) {
+						pendingPasses.emplace(key, eventsNew);
+					} else if (!iter->second.areWeConnected()) {
+						timers.schedule(key, milliseconds{});
+					}
+				}
+			}
+			timers.advance([this](uint64_t key) {
+				onTimer(key);
+			});
+		}
+
+		uint32_t base_socket_agent::serviceConnection(websocket_client& value, uint32_t events) {
+			return value.tcpConnection.processEvents(events);
+		}
+
+		void base_socket_agent::onTimer(uint64_t key) {
+			auto iter = shardMap.find(key);
+			if (iter == shardMap.end()) {
+				return;
+			}
+			auto& value = iter->second;
+			if (!value.areWeConnected()) {
+				message_printer::printError<print_message_type::websocket>("Connection lost for websocket [" + jsonifier::toString(value.shard.at(0)) + "," +
+					jsonifier::toString(discord_core_client::getInstance()->configManager.getTotalShardCount()) + "]... reconnecting.");
+				if (discord_core_client::getInstance()->connectionStopWatch01.hasTimeElapsed()) {
+					connect(value);
+				} else {
+					timers.schedule(key, 1000ms);
+				}
+				return;
+			}
+			if (value.tcpConnection.connectState != connect_state::Connected) {
+				if (!value.tcpConnection.processConnect(false)) {
+					timers.schedule(key, 1000ms);
+				} else {
+					timers.schedule(key, timer_wheel::tickInterval);
+				}
+				return;
+			}
+			if (value.checkForAndSendHeartBeat()) {
+				on_gateway_ping_data dataNew{};
+				dataNew.timeUntilNextPing = static_cast<int32_t>(value.heartBeatStopWatch.getTotalWaitTime().count());
+				discord_core_client::getInstance()->eventManager.onGatewayPingEvent(dataNew);
+			}
+			if (!value.areWeConnected()) {
+				timers.schedule(key, milliseconds{});
+				return;
+			}
+			auto timeUntilHeartBeat = value.heartBeatStopWatch.getTotalWaitTime() - value.heartBeatStopWatch.totalTimeElapsed();
+			timers.schedule(key, timeUntilHeartBeat > timer_wheel::tickInterval ? timeUntilHeartBeat : timer_wheel::tickInterval);
+		}
+#endif
+
 		base_socket_agent::~base_socket_agent() {
+			taskThread.request_stop();
+			if (taskThread.joinable()) {
+				taskThread.join();
+			}
+#if defined(__linux__)
+			if (epollFd != -1) {
+				close(epollFd);
+			}
+			if (wakeFd != -1) {
+				close(wakeFd);
+			}
+#endif
 		}
 	}// namespace discord_core_internal
 }// namespace discord_core_api
@@ -0,0 +1,76 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// EnvelopeParser.cpp - Benchmark of single-pass gateway payload parsing against the previous double parse.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file EnvelopeParser.cpp
+
+#include "../Common/TestUtilities.hpp"
+#include "../Common/Payloads.hpp"
+
+using namespace discord_core_api;
+using namespace discord_core_api::discord_core_internal;
+using namespace discord_core_test;
+
+void benchmarkGuildCreate(uint64_t memberCount) {
+	auto frame = generateGuildCreateFrame(memberCount, 50, 50);
+	jsonifier::string_view_base<uint8_t> view{ reinterpret_cast<const uint8_t*>(frame.data()), frame.size() };
+	jsonifier::jsonifier_core<false> parser{};
+	uint64_t iterations{ std::max<uint64_t>(10, 200'000'000 / frame.size()) };
+
+	websocket_message message{};
+	guild_data value{};
+	parser.parseJson<jsonifier::parse_options{ .partialRead = true }>(value, json_envelope_parser::parseJsonEnvelope(view, message));
+	check(parser.getErrors().size() == 0 && value.members.size() == memberCount, "the generated GUILD_CREATE payload parses cleanly");
+
+	auto doubleParse = measureNsPerIteration(iterations, [&] {
+		websocket_message messageNew{};
+		parser.parseJson<jsonifier::parse_options{ .partialRead = true }>(messageNew, view);
+		websocket_message_data<guild_data> dataNew{};
+		parser.parseJson<jsonifier::parse_options{ .partialRead = true }>(dataNew, view);
+		consume(dataNew.d.members.size() + static_cast<uint64_t>(messageNew.op));
+	});
+	auto singlePass = measureNsPerIteration(iterations, [&] {
+		websocket_message messageNew{};
+		auto data = json_envelope_parser::parseJsonEnvelope(view, messageNew);
+		guild_data valueNew{};
+		parser.parseJson<jsonifier::parse_options{ .partialRead = true }>(valueNew, data);
+		consume(valueNew.members.size() + static_cast<uint64_t>(messageNew.op));
+	});
+	auto toMegabytesPerSecond = [&](double nanoseconds) {
+		return static_cast<double>(frame.size()) / nanoseconds * 1000.0;
+	};
+	std::string name{ "GUILD_CREATE, " + std::to_string(memberCount) + " members, " + std::to_string(frame.size()) + " bytes" };
+	printResult(name + ", double parse", toMegabytesPerSecond(doubleParse), "MB/s");
+	printResult(name + ", single pass", toMegabytesPerSecond(singlePass), "MB/s");
+}
+
+int32_t main() {
+	for (uint64_t memberCount: { 10ull, 100ull, 1000ull, 10000ull }) {
+		benchmarkGuildCreate(memberCount);
+	}
+	return test_state::getInstance().finish("EnvelopeParserBenchmark");
+}
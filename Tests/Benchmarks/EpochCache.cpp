@@ -0,0 +1,124 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// EpochCache.cpp - Benchmark of epoch_cache reads against the locked object_cache.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file EpochCache.cpp
+
+#include "../Common/TestUtilities.hpp"
+
+using namespace discord_core_api;
+using namespace discord_core_test;
+
+/// @brief A cached object with a heap-allocated field, so that copying it costs about what copying a real entity does.
+struct cached_object {
+	snowflake id{};
+	uint64_t value{};
+	std::string name{};
+};
+
+/// @brief A cheap per-thread random number generator, so that the generator does not dominate the measurement.
+struct xorshift_engine {
+	uint64_t state{};
+
+	uint64_t operator()() {
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+		return state;
+	}
+};
+
+constexpr uint64_t keyCount{ 100000 };
+constexpr uint64_t totalOperations{ 4000000 };
+
+template<typename cache_type> void populate(cache_type& cache) {
+	for (uint64_t x = 1; x <= keyCount; ++x) {
+		cache.emplace(cached_object{ x, x, "a cached object with a long name " + std::to_string(x) });
+	}
+	check(cache.count() == keyCount, "the cache is populated before the mix");
+}
+
+/// @brief Runs a read-heavy mix against a cache, where one operation in a hundred is a modify.
+/// @return millions of operations per second, across every thread.
+template<typename cache_type, typename read_function> double runReadHeavyMix(cache_type& cache, uint64_t threadCount, read_function&& readFunction) {
+	uint64_t operationsPerThread{ totalOperations / threadCount };
+	auto seconds = runOnThreads(threadCount, [&](uint64_t index) {
+		xorshift_engine randomEngine{ 0x9E3779B97F4A7C15ull * (index + 1) };
+		uint64_t total{};
+		for (uint64_t x = 0; x < operationsPerThread; ++x) {
+			uint64_t random{ randomEngine() };
+			snowflake key{ random % keyCount + 1 };
+			if ((random >> 32) % 100 == 0) {
+				cache.modify(key, [](cached_object& value) {
+					++value.value;
+				});
+			} else {
+				total += readFunction(cache, key);
+			}
+		}
+		consume(total);
+	});
+	return static_cast<double>(threadCount * operationsPerThread) / seconds / 1000000.0;
+}
+
+void benchmarkVisit(uint64_t threadCount) {
+	auto visit = [](auto& cache, snowflake key) {
+		uint64_t returnValue{};
+		cache.visit(key, [&](const cached_object& value) {
+			returnValue = value.value + value.name.size();
+		});
+		return returnValue;
+	};
+	object_cache<cached_object> objectCache{};
+	populate(objectCache);
+	printResult("object_cache visit, " + std::to_string(threadCount) + " thread(s)", runReadHeavyMix(objectCache, threadCount, visit), "Mops/s");
+	epoch_cache<cached_object> epochCache{};
+	populate(epochCache);
+	printResult("epoch_cache visit, " + std::to_string(threadCount) + " thread(s)", runReadHeavyMix(epochCache, threadCount, visit), "Mops/s");
+}
+
+void benchmarkFind(uint64_t threadCount) {
+	auto find = [](auto& cache, snowflake key) {
+		auto snapshot = cache.find(key);
+		return snapshot ? snapshot->value + snapshot->name.size() : 0;
+	};
+	for (bool snapshotReads: { false, true }) {
+		entity_cache<cached_object> cache{};
+		cache.setSnapshotReads(snapshotReads);
+		populate(cache);
+		printResult(std::string{ snapshotReads ? "entity_cache find, pinned snapshots, " : "entity_cache find, copies, " } + std::to_string(threadCount) + " thread(s)",
+			runReadHeavyMix(cache, threadCount, find), "Mops/s");
+	}
+}
+
+int32_t main() {
+	for (uint64_t threadCount: { 1ull, 8ull, 32ull }) {
+		benchmarkVisit(threadCount);
+		benchmarkFind(threadCount);
+	}
+	return test_state::getInstance().finish("EpochCacheBenchmark");
+}
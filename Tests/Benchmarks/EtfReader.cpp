@@ -0,0 +1,75 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// EtfReader.cpp - Benchmark of reading etf gateway payloads directly against transcoding them to json first.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file EtfReader.cpp
+
+#include "../Common/TestUtilities.hpp"
+#include "../Common/Payloads.hpp"
+
+using namespace discord_core_api;
+using namespace discord_core_api::discord_core_internal;
+using namespace discord_core_test;
+
+void benchmarkGuildCreate(uint64_t memberCount) {
+	auto frame = generateGuildCreateEtfFrame(memberCount, 50, 50);
+	auto view  = toView(frame);
+	jsonifier::jsonifier_core<false> parser{};
+	etf_parser etfParserNew{};
+	uint64_t iterations{ std::max<uint64_t>(10, 200'000'000 / frame.size()) };
+
+	auto envelope = etfParserNew.parseEtfEnvelope(view);
+	guild_data value{};
+	parseGatewayData(parser, value, etfParserNew.parseEtfDataTerm(view, envelope));
+	check(value.members.size() == memberCount, "the generated etf GUILD_CREATE payload is read directly");
+
+	auto viaJson = measureNsPerIteration(iterations, [&] {
+		auto envelopeNew = etfParserNew.parseEtfEnvelope(view);
+		guild_data valueNew{};
+		parser.parseJson<jsonifier::parse_options{ .partialRead = true }>(valueNew, etfParserNew.parseEtfDataToJson(view, envelopeNew));
+		consume(valueNew.members.size() + static_cast<uint64_t>(envelopeNew.op));
+	});
+	auto direct = measureNsPerIteration(iterations, [&] {
+		auto envelopeNew = etfParserNew.parseEtfEnvelope(view);
+		guild_data valueNew{};
+		parseGatewayData(parser, valueNew, etfParserNew.parseEtfDataTerm(view, envelopeNew));
+		consume(valueNew.members.size() + static_cast<uint64_t>(envelopeNew.op));
+	});
+	auto toMegabytesPerSecond = [&](double nanoseconds) {
+		return static_cast<double>(frame.size()) / nanoseconds * 1000.0;
+	};
+	std::string name{ "etf GUILD_CREATE, " + std::to_string(memberCount) + " members, " + std::to_string(frame.size()) + " bytes" };
+	printResult(name + ", etf to json to struct", toMegabytesPerSecond(viaJson), "MB/s");
+	printResult(name + ", etf direct", toMegabytesPerSecond(direct), "MB/s");
+}
+
+int32_t main() {
+	for (uint64_t memberCount: { 10ull, 100ull, 1000ull, 10000ull }) {
+		benchmarkGuildCreate(memberCount);
+	}
+	return test_state::getInstance().finish("EtfReaderBenchmark");
+}
@@ -0,0 +1,107 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// GatewayEvents.cpp - Benchmark of dispatch event lookup, perfect hash vs compare chain.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file GatewayEvents.cpp
+
+#include "../Common/TestUtilities.hpp"
+#include <random>
+
+using namespace discord_core_api;
+using namespace discord_core_api::discord_core_internal;
+using namespace discord_core_test;
+
+/// @brief The lookup that event_converter used to make: one string comparison per event, in declaration order.
+gateway_event_type compareChain(jsonifier::string_view name) {
+	for (uint64_t x = 1; x < gatewayEventNames.size(); ++x) {
+		if (gatewayEventNames[x] == name) {
+			return static_cast<gateway_event_type>(x);
+		}
+	}
+	return gateway_event_type::Unknown;
+}
+
+template<typename function_type> void benchmarkLookups(std::string_view name, const std::vector<std::string>& names, function_type&& function) {
+	constexpr uint64_t iterations{ 2'000'000 };
+	uint64_t index{};
+	uint64_t total{};
+	auto nanoseconds = measureNsPerIteration(iterations, [&] {
+		const auto& value = names[index++ & (names.size() - 1)];
+		total += static_cast<uint64_t>(function(jsonifier::string_view{ value.data(), value.size() }));
+	});
+	consume(total);
+	printResult(name, nanoseconds, "ns/lookup");
+}
+
+void benchmarkMix(std::string_view mixName, const std::vector<std::string>& names) {
+	bool allMatched{ true };
+	for (auto& value: names) {
+		jsonifier::string_view name{ value.data(), value.size() };
+		allMatched = allMatched && static_cast<gateway_event_type>(event_converter{ name }) == compareChain(name);
+	}
+	check(allMatched, "the perfect hash and the compare chain agree");
+	benchmarkLookups(std::string{ mixName } + ", perfect hash", names, [](jsonifier::string_view name) {
+		return static_cast<gateway_event_type>(event_converter{ name });
+	});
+	benchmarkLookups(std::string{ mixName } + ", compare chain", names, [](jsonifier::string_view name) {
+		return compareChain(name);
+	});
+}
+
+int32_t main() {
+	std::mt19937_64 randomEngine{ 1 };
+	constexpr uint64_t sampleCount{ 4096 };
+
+	// Every event name, equally often.
+	std::vector<std::string> uniformNames{};
+	std::uniform_int_distribution<uint64_t> uniformDistribution{ 1, gatewayEventNames.size() - 1 };
+	for (uint64_t x = 0; x < sampleCount; ++x) {
+		auto index = uniformDistribution(randomEngine);
+		uniformNames.emplace_back(gatewayEventNames[index].data(), gatewayEventNames[index].size());
+	}
+	benchmarkMix("all events, uniform", uniformNames);
+
+	// A busy bot's traffic, which is dominated by a handful of events that sit late in the compare chain.
+	std::vector<std::string> trafficNames{};
+	std::discrete_distribution<uint64_t> trafficDistribution{ 30, 25, 15, 10, 8, 5, 4, 3 };
+	std::array<gateway_event_type, 8> trafficEvents{ gateway_event_type::Presence_Update, gateway_event_type::Message_Create, gateway_event_type::Typing_Start,
+		gateway_event_type::Guild_Member_Update, gateway_event_type::Message_Reaction_Add, gateway_event_type::Voice_State_Update, gateway_event_type::Message_Update,
+		gateway_event_type::Interaction_Create };
+	for (uint64_t x = 0; x < sampleCount; ++x) {
+		auto name = gatewayEventNames[static_cast<uint64_t>(trafficEvents[trafficDistribution(randomEngine)])];
+		trafficNames.emplace_back(name.data(), name.size());
+	}
+	benchmarkMix("gateway traffic mix", trafficNames);
+
+	// Names that the library does not recognize, which the compare chain has to test against every event.
+	std::vector<std::string> unknownNames{};
+	for (uint64_t x = 0; x < sampleCount; ++x) {
+		unknownNames.emplace_back(x % 2 == 0 ? "ENTITLEMENT_CREATE" : "MESSAGE_POLL_VOTE_ADD");
+	}
+	benchmarkMix("unrecognized events", unknownNames);
+	return test_state::getInstance().finish("GatewayEventsBenchmark");
+}
@@ -0,0 +1,114 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// GuildMemberStore.cpp - Benchmark of the columnar guild_member_store against object_cache.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file GuildMemberStore.cpp
+
+#include "../Common/TestUtilities.hpp"
+
+using namespace discord_core_api;
+using namespace discord_core_test;
+
+/// @brief Builds a guild_member shaped like a typical one: a few roles, and a nick for about half of them.
+guild_member_cache_data makeMember(uint64_t guildId, uint64_t userId) {
+	guild_member_cache_data returnValue{};
+	returnValue.guildId		   = guildId;
+	returnValue.user.id		   = 100000000000000000ull + userId;
+	returnValue.permissionsVal = uint64_t{ 104324673 };
+	returnValue.joinedAt	   = uint64_t{ 1600000000000 + userId };
+	for (uint64_t x = 0; x < userId % 5; ++x) {
+		returnValue.roles.emplace_back(200000000000000000ull + x);
+	}
+	if (userId % 2 == 0) {
+		returnValue.nick = "member nickname " + jsonifier::toString(userId);
+	}
+	return returnValue;
+}
+
+/// @brief Estimates the heap memory held by an object_cache of guild_members, counted the same way that guild_member_store::getMemoryUsage counts its own.
+uint64_t estimateObjectCacheMemory(object_cache<guild_member_cache_data>& cache) {
+	uint64_t returnValue{};
+	for (auto& value: cache) {
+		auto memberStart = reinterpret_cast<const char*>(value.get());
+		returnValue		 += sizeof(unique_ptr<guild_member_cache_data>) + sizeof(guild_member_cache_data);
+		returnValue		 += value->roles.capacity() * sizeof(snowflake);
+		// Only count the nick if it lives outside of the object, rather than in its small-string buffer.
+		if (value->nick.data() < memberStart || value->nick.data() >= memberStart + sizeof(guild_member_cache_data)) {
+			returnValue += value->nick.capacity() + 1;
+		}
+	}
+	return returnValue;
+}
+
+void benchmarkLayout(uint64_t guildCount, uint64_t membersPerGuild) {
+	std::string name{ std::to_string(guildCount) + " guild(s) of " + std::to_string(membersPerGuild) + " members" };
+	object_cache<guild_member_cache_data> cache{};
+	guild_member_store store{};
+	for (uint64_t guildId = 1; guildId <= guildCount; ++guildId) {
+		for (uint64_t userId = 1; userId <= membersPerGuild; ++userId) {
+			auto member = makeMember(guildId, userId);
+			store.emplace(member);
+			cache.emplace(std::move(member));
+		}
+	}
+	check(store.count() == cache.count(), "both caches hold every member");
+	printResult(name + ", object_cache memory", static_cast<double>(estimateObjectCacheMemory(cache)) / static_cast<double>(cache.count()), "bytes/member");
+	printResult(name + ", guild_member_store memory", static_cast<double>(store.getMemoryUsage()) / static_cast<double>(store.count()), "bytes/member");
+
+	constexpr uint64_t iterations{ 1000000 };
+	uint64_t index{};
+	auto nextKey = [&] {
+		guild_member_cache_data key{};
+		uint64_t member{ (index++ * 7919) % (guildCount * membersPerGuild) };
+		key.guildId = member / membersPerGuild + 1;
+		key.user.id = 100000000000000000ull + member % membersPerGuild + 1;
+		return two_id_key{ key };
+	};
+	// Both lookups produce a full copy of the member, as guild_members::getCachedGuildMember does.
+	auto objectCacheLookup = measureNsPerIteration(iterations, [&] {
+		guild_member_cache_data found{};
+		cache.visit(nextKey(), [&](const guild_member_cache_data& value) {
+			found = value;
+		});
+		consume(found.roles.size());
+	});
+	index			 = 0;
+	auto storeLookup = measureNsPerIteration(iterations, [&] {
+		guild_member_cache_data found{};
+		store.find(nextKey(), found);
+		consume(found.roles.size());
+	});
+	printResult(name + ", object_cache lookup", objectCacheLookup, "ns/lookup");
+	printResult(name + ", guild_member_store lookup", storeLookup, "ns/lookup");
+}
+
+int32_t main() {
+	benchmarkLayout(1, 100000);
+	benchmarkLayout(100, 1000);
+	benchmarkLayout(10000, 10);
+	return test_state::getInstance().finish("GuildMemberStoreBenchmark");
+}
@@ -0,0 +1,171 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// HttpsClient.cpp - Benchmark of https request throughput over pooled keep-alive connections, against a local tls server.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file HttpsClient.cpp
+
+#include "../Common/LocalServer.hpp"
+
+using namespace discord_core_api;
+using namespace discord_core_api::discord_core_internal;
+using namespace discord_core_test;
+
+/// @brief Exposes the connection pool, and the blocking request path without the global rate limiter, of https_client, so that they can be driven
+/// against the local server.
+class benchmark_client : public https_client {
+  public:
+	benchmark_client() : https_client{ "benchmark" } {
+	}
+
+	https_connection_manager& getConnectionManager() {
+		return connectionManager;
+	}
+
+	https_response_data request(https_connection& connection) {
+		return httpsRequestInternal(connection);
+	}
+};
+
+static constexpr std::string_view responseBody{
+	R"({"id":"1100000000000000002","channel_id":"1100000000000000001","author":{"id":"1100000000000000003","username":"benchmark","discriminator":"0","avatar":null},)"
+	R"("content":"a message of a typical length, which stands in for the response to a typical rest request","timestamp":"2026-10-18T00:00:00.000000+00:00",)"
+	R"("edited_timestamp":null,"tts":false,"mention_everyone":false,"mentions":[],"mention_roles":[],"attachments":[],"embeds":[],"pinned":false,"type":0})"
+};
+
+static const jsonifier::string baseUrl{ "https://127.0.0.1" };
+
+/// @brief The remaining quota the server reports for the bucket, which bounds how many of its requests may be in flight at once.
+static std::atomic<uint64_t> bucketSize{ 50 };
+
+/// @brief Answers each request on a connection with the same response, for as long as the connection is kept alive.
+void serveRequests(SSL* ssl) {
+	std::string buffer{};
+	std::string request{};
+	while (readHttpRequest(ssl, buffer, request) &&
+		writeAll(ssl, generateHttpResponse("HTTP/1.1 200 OK", "x-ratelimit-remaining: " + std::to_string(bucketSize.load()) + "\r\n", responseBody))) {
+	}
+}
+
+https_workload_data generateWorkload() {
+	https_workload_data workload{ https_workload_type::Get_Message };
+	workload.workloadClass = https_workload_class::Get;
+	workload.relativePath  = "/channels/1100000000000000001/messages/1100000000000000002";
+	workload.baseUrl	   = baseUrl;
+	return workload;
+}
+
+bool isExpectedResponse(https_response_data response) {
+	return static_cast<uint32_t>(response.responseCode) == 200 && response.responseData.size() == responseBody.size();
+}
+
+/// @brief Makes a request on a connection of its own, which it opens - and completes a handshake on - first if it isn't already connected.
+bool makeRequest(benchmark_client& client, https_connection& connection, rate_limit_data& rateLimitData, uint16_t port) {
+	connection.resetValues(generateWorkload(), &rateLimitData);
+	if (!connection.areWeConnected()) {
+		connectLocally(connection, port);
+	}
+	return isExpectedResponse(client.request(connection));
+}
+
+/// @brief Fills the connection pool with keep-alive connections to the local server, as the https client's would be to discord's.
+/// @details the client only ever connects to port 443, so a request which leased an unconnected connection would fail.
+void fillConnectionPool(benchmark_client& client, https_connection_manager& connectionManager, uint16_t port) {
+	rate_limit_data rateLimitData{};
+	std::vector<unique_ptr<https_connection>> connections{};
+	for (uint64_t x = 0; x < https_connection_manager::maxConnectionCount; ++x) {
+		connections.emplace_back(connectionManager.leaseConnection(baseUrl, https_workload_priority::Normal));
+		check(makeRequest(client, *connections.back(), rateLimitData, port), "a pooled connection connects to the local server");
+	}
+	for (auto& value: connections) {
+		connectionManager.releaseConnection(std::move(value), https_workload_priority::Normal);
+	}
+}
+
+/// @brief Measures how many requests per second a number of threads complete while sharing one rate-limit bucket, leasing keep-alive connections
+/// from the pool, and checks that no more of them are in flight at once than the bucket's remaining quota allows.
+void benchmarkPooledRequests(uint16_t port, uint64_t threadCount, uint64_t totalRequests, uint64_t bucketSizeNew) {
+	benchmark_client client{};
+	auto& connectionManager = client.getConnectionManager();
+	bucketSize.store(bucketSizeNew);
+	fillConnectionPool(client, connectionManager, port);
+	std::atomic<uint64_t> succeeded{};
+	std::atomic<uint64_t> inFlightCount{};
+	std::atomic<uint64_t> maxInFlightCount{};
+	uint64_t requestsPerThread{ totalRequests / threadCount };
+	auto seconds = runOnThreads(threadCount, [&](uint64_t) {
+		for (uint64_t x = 0; x < requestsPerThread; ++x) {
+			// the stack holder waits on the shared bucket, and holds its in-flight slot, for as long as it lives.
+			https_connection_stack_holder stackHolder{ connectionManager, generateWorkload() };
+			auto currentCount = inFlightCount.fetch_add(1, std::memory_order_acq_rel) + 1;
+			auto maxCount	  = maxInFlightCount.load(std::memory_order_acquire);
+			while (currentCount > maxCount && !maxInFlightCount.compare_exchange_weak(maxCount, currentCount, std::memory_order_acq_rel)) {
+			}
+			auto isExpected = isExpectedResponse(client.request(stackHolder.getConnection()));
+			inFlightCount.fetch_sub(1, std::memory_order_acq_rel);
+			succeeded.fetch_add(isExpected, std::memory_order_relaxed);
+		}
+	});
+	auto name = std::to_string(threadCount) + " thread(s), pooled keep-alive connections, a bucket of " + std::to_string(bucketSizeNew);
+	check(succeeded.load() == requestsPerThread * threadCount, "every request succeeds");
+	check(maxInFlightCount.load() <= bucketSizeNew, "no more requests are in flight at once than the bucket's remaining quota: " + name);
+	printResult(name + ", throughput", static_cast<double>(requestsPerThread * threadCount) / seconds, "requests/s");
+	printResult(name + ", most in flight", static_cast<double>(maxInFlightCount.load()), "requests");
+}
+
+/// @brief Measures how many requests per second a number of threads complete while sharing one rate-limit bucket, opening a connection - and
+/// completing a handshake - for every request.
+void benchmarkUnpooledRequests(uint16_t port, uint64_t threadCount, uint64_t totalRequests) {
+	benchmark_client client{};
+	rate_limit_data rateLimitData{};
+	bucketSize.store(50);
+	std::atomic<uint64_t> succeeded{};
+	uint64_t requestsPerThread{ totalRequests / threadCount };
+	auto fullHandshakes	   = ssl_context_holder::fullHandshakeCount.load();
+	auto resumedHandshakes = ssl_context_holder::resumedSessionCount.load();
+	auto seconds		   = runOnThreads(threadCount, [&](uint64_t) {
+		  for (uint64_t x = 0; x < requestsPerThread; ++x) {
+			  https_connection connection{};
+			  succeeded.fetch_add(makeRequest(client, connection, rateLimitData, port), std::memory_order_relaxed);
+		  }
+	});
+	check(succeeded.load() == requestsPerThread * threadCount, "every request succeeds");
+	auto name = std::to_string(threadCount) + " thread(s), a connection per request";
+	printResult(name + ", throughput", static_cast<double>(requestsPerThread * threadCount) / seconds, "requests/s");
+	printResult(name + ", full", static_cast<double>(ssl_context_holder::fullHandshakeCount.load() - fullHandshakes), "handshakes");
+	printResult(name + ", resumed", static_cast<double>(ssl_context_holder::resumedSessionCount.load() - resumedHandshakes), "handshakes");
+}
+
+int32_t main() {
+	check(ssl_context_holder::initialize(), "the client tls context is created");
+	local_tls_server server{ serveRequests };
+	for (uint64_t threadCount: { 1ull, 8ull, 32ull }) {
+		benchmarkUnpooledRequests(server.getPort(), threadCount, 2000);
+		benchmarkPooledRequests(server.getPort(), threadCount, 20000, 50);
+		benchmarkPooledRequests(server.getPort(), threadCount, 20000, 4);
+	}
+	return test_state::getInstance().finish("HttpsClientBenchmark");
+}
@@ -0,0 +1,78 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// HttpsResponseParser.cpp - Benchmark of the incremental https response parser, over content-length and chunked responses.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file HttpsResponseParser.cpp
+
+#include "../Common/TestUtilities.hpp"
+#include "../Common/Payloads.hpp"
+
+using namespace discord_core_api;
+using namespace discord_core_api::discord_core_internal;
+using namespace discord_core_test;
+
+/// @brief An https_connection which is handed its response directly, rather than reading it from a socket.
+class replay_connection : public https_connection {
+  public:
+	/// @brief Hands the connection the next slice of its response, as a read from its socket would.
+	void receive(std::string_view slice) {
+		inputBuffer.writeData(slice.data(), slice.size());
+		handleBuffer();
+	}
+};
+
+/// @brief Measures how quickly a response is parsed, when it arrives in reads of up to a given size.
+void benchmarkResponse(std::string_view name, std::string_view wire, uint64_t bodySize, uint64_t readSize) {
+	replay_connection connection{};
+	uint64_t iterations{ std::max<uint64_t>(10, 200'000'000 / wire.size()) };
+	uint64_t completed{};
+	auto nsPerResponse = measureNsPerIteration(iterations, [&] {
+		connection.data = https_response_data{};
+		for (uint64_t x = 0; x < wire.size(); x += readSize) {
+			connection.receive(wire.substr(x, readSize));
+		}
+		completed += connection.data.currentState == https_state::complete && connection.data.responseData.size() == bodySize;
+	});
+	check(completed == iterations, "every benchmarked response is parsed in full");
+	consume(completed);
+	printResult(std::string{ name } + ", " + std::to_string(readSize) + " byte reads", static_cast<double>(wire.size()) / nsPerResponse * 1000.0, "MB/s");
+}
+
+int32_t main() {
+	std::string headers{ "x-ratelimit-bucket: abcd1234\r\nx-ratelimit-remaining: 4\r\nx-ratelimit-reset-after: 1.5\r\n" };
+	for (uint64_t memberCount: { 1ull, 100ull, 1000ull }) {
+		auto body = generateGuildMemberList(memberCount);
+		auto name = "member list, " + std::to_string(memberCount) + " members, " + std::to_string(body.size()) + " bytes";
+		auto contentLengthResponse = generateHttpResponse("HTTP/1.1 200 OK", headers, body);
+		auto chunkedResponse	   = generateChunkedHttpResponse("HTTP/1.1 200 OK", headers, body, { 8192 });
+		for (uint64_t readSize: { 1024ull, 16384ull }) {
+			benchmarkResponse(name + ", content-length", contentLengthResponse, body.size(), readSize);
+			benchmarkResponse(name + ", chunked", chunkedResponse, body.size(), readSize);
+		}
+	}
+	return test_state::getInstance().finish("HttpsResponseParserBenchmark");
+}
@@ -0,0 +1,124 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// MessageBlock.cpp - Benchmark of the bounded message blocks against the unbounded_message_block.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file MessageBlock.cpp
+
+#include "../Common/TestUtilities.hpp"
+
+using namespace discord_core_api;
+using namespace discord_core_api::discord_core_internal;
+using namespace discord_core_test;
+
+/// @brief Sends an object, retrying while a bounded message block is full.
+template<typename message_block_type> void sendBlocking(message_block_type& block, uint64_t value) {
+	if constexpr (std::is_same_v<message_block_type, unbounded_message_block<uint64_t>>) {
+		block.send(value);
+	} else {
+		while (!block.send(value)) {
+			std::this_thread::yield();
+		}
+	}
+}
+
+/// @brief Receives an object the way a consumer of the message block would: by parking on a bounded block, or by polling an unbounded one.
+template<typename message_block_type> bool receiveBlocking(message_block_type& block, uint64_t& value) {
+	if constexpr (std::is_same_v<message_block_type, unbounded_message_block<uint64_t>>) {
+		auto deadline = hrclock::now() + std::chrono::seconds{ 5 };
+		while (!block.tryReceive(value)) {
+			if (hrclock::now() > deadline) {
+				return false;
+			}
+			std::this_thread::yield();
+		}
+		return true;
+	} else {
+		return block.receive(value, milliseconds{ 5000 });
+	}
+}
+
+/// @brief Measures how many objects per second a number of producers can push through to a single consumer.
+template<typename message_block_type> void benchmarkThroughput(std::string_view name, uint64_t producerCount) {
+	constexpr uint64_t totalValues{ 2000000 };
+	uint64_t valuesPerProducer{ totalValues / producerCount };
+	message_block_type block{};
+	uint64_t receivedCount{};
+	auto seconds = runOnThreads(producerCount + 1, [&](uint64_t index) {
+		if (index < producerCount) {
+			for (uint64_t x = 0; x < valuesPerProducer; ++x) {
+				sendBlocking(block, x);
+			}
+		} else {
+			uint64_t value{};
+			for (uint64_t x = 0; x < valuesPerProducer * producerCount; ++x) {
+				if (!receiveBlocking(block, value)) {
+					break;
+				}
+				consume(value);
+				++receivedCount;
+			}
+		}
+	});
+	check(receivedCount == valuesPerProducer * producerCount, "every throughput value is received");
+	printResult(std::string{ name } + ", " + std::to_string(producerCount) + " producer(s), throughput", static_cast<double>(receivedCount) / seconds / 1000000.0, "Mmsgs/s");
+}
+
+/// @brief Measures the round trip of an object bounced between two threads, each of which waits through waitForTimeToPass.
+template<typename message_block_type> void benchmarkRoundTrip(std::string_view name, uint64_t roundTrips) {
+	message_block_type requests{};
+	message_block_type responses{};
+	std::vector<uint64_t> samples{};
+	samples.reserve(roundTrips);
+	bool allAnswered{ true };
+	runOnThreads(2, [&](uint64_t index) {
+		uint64_t value{};
+		for (uint64_t x = 0; x < roundTrips; ++x) {
+			if (index == 0) {
+				auto sendTime = hrclock::now();
+				sendBlocking(requests, x);
+				allAnswered = !waitForTimeToPass(responses, value, 5000) && value == x && allAnswered;
+				samples.emplace_back(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(hrclock::now() - sendTime).count()));
+			} else if (!waitForTimeToPass(requests, value, 5000)) {
+				sendBlocking(responses, value);
+			}
+		}
+	});
+	check(allAnswered, "every round trip is answered");
+	printResult(std::string{ name } + ", round trip", summarizeLatencies(samples));
+}
+
+int32_t main() {
+	benchmarkThroughput<spsc_message_block<uint64_t, 1024>>("spsc_message_block", 1);
+	for (uint64_t producerCount: { 1ull, 8ull, 32ull }) {
+		benchmarkThroughput<mpsc_message_block<uint64_t, 1024>>("mpsc_message_block", producerCount);
+		benchmarkThroughput<unbounded_message_block<uint64_t>>("unbounded_message_block", producerCount);
+	}
+	benchmarkRoundTrip<spsc_message_block<uint64_t, 16>>("spsc_message_block", 20000);
+	benchmarkRoundTrip<mpsc_message_block<uint64_t, 16>>("mpsc_message_block", 20000);
+	benchmarkRoundTrip<unbounded_message_block<uint64_t>>("unbounded_message_block", 2000);
+	return test_state::getInstance().finish("MessageBlockBenchmark");
+}
@@ -0,0 +1,137 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// ObjectCache.cpp - Benchmark of the sharded object_cache against a single locked table.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file ObjectCache.cpp
+
+#include "../Common/TestUtilities.hpp"
+
+using namespace discord_core_api;
+using namespace discord_core_test;
+
+/// @brief A small cached object.
+struct cached_object {
+	snowflake id{};
+	uint64_t value{};
+};
+
+/// @brief A cheap per-thread random number generator, so that the generator does not dominate the measurement.
+struct xorshift_engine {
+	uint64_t state{};
+
+	uint64_t operator()() {
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+		return state;
+	}
+};
+
+constexpr uint64_t keyCount{ 100000 };
+constexpr uint64_t totalOperations{ 4000000 };
+
+/// @brief Runs a gateway-like mix against a cache: mostly reads, some in-place updates, and a little churn.
+/// @return millions of operations per second, across every thread.
+template<typename cache_type> double runMix(cache_type& cache, uint64_t threadCount, uint64_t readPercent) {
+	uint64_t operationsPerThread{ totalOperations / threadCount };
+	auto seconds = runOnThreads(threadCount, [&](uint64_t index) {
+		xorshift_engine randomEngine{ 0x9E3779B97F4A7C15ull * (index + 1) };
+		// Each thread churns its own keys, above the shared range, so that emplace and erase always have work to do.
+		uint64_t churnBase{ keyCount + 1 + index * operationsPerThread };
+		uint64_t churnCount{};
+		uint64_t total{};
+		for (uint64_t x = 0; x < operationsPerThread; ++x) {
+			uint64_t random{ randomEngine() };
+			snowflake key{ random % keyCount + 1 };
+			uint64_t operation{ (random >> 32) % 100 };
+			if (operation < readPercent) {
+				cache.visit(key, [&](const cached_object& value) {
+					total += value.value;
+				});
+			} else if (operation < readPercent + (100 - readPercent) / 2) {
+				cache.modify(key, [](cached_object& value) {
+					++value.value;
+				});
+			} else if (operation % 2 == 0) {
+				cache.emplace(cached_object{ churnBase + churnCount++, 1 });
+			} else if (churnCount > 0) {
+				cache.erase(snowflake{ churnBase + --churnCount });
+			}
+		}
+		consume(total);
+	});
+	return static_cast<double>(threadCount * operationsPerThread) / seconds / 1000000.0;
+}
+
+template<uint64_t shard_count> void benchmarkCache(uint64_t threadCount, uint64_t readPercent) {
+	object_cache<cached_object, shard_count> cache{};
+	for (uint64_t x = 1; x <= keyCount; ++x) {
+		cache.emplace(cached_object{ x, x });
+	}
+	auto throughput = runMix(cache, threadCount, readPercent);
+	check(cache.count() >= keyCount, "the shared keys survive the mix");
+	printResult(std::to_string(shard_count) + " shard(s), " + std::to_string(threadCount) + " thread(s), " + std::to_string(readPercent) + "% reads", throughput, "Mops/s");
+}
+
+void benchmarkVoiceStates(uint64_t threadCount) {
+	object_cache<voice_state_data_light> cache{};
+	voice_state_data_light value{};
+	for (uint64_t x = 1; x <= keyCount; ++x) {
+		value.guildId	= x % 64 + 1;
+		value.userId	= x;
+		value.channelId = x;
+		cache.emplace(value);
+	}
+	uint64_t operationsPerThread{ totalOperations / threadCount };
+	auto seconds = runOnThreads(threadCount, [&](uint64_t index) {
+		xorshift_engine randomEngine{ 0x9E3779B97F4A7C15ull * (index + 1) };
+		voice_state_data_light key{};
+		uint64_t total{};
+		for (uint64_t x = 0; x < operationsPerThread; ++x) {
+			uint64_t userId{ randomEngine() % keyCount + 1 };
+			key.guildId = userId % 64 + 1;
+			key.userId	= userId;
+			cache.visit(two_id_key{ key }, [&](const voice_state_data_light& cached) {
+				total += cached.channelId.operator const uint64_t&();
+			});
+		}
+		consume(total);
+	});
+	printResult("voice states by two_id_key, " + std::to_string(threadCount) + " thread(s)", static_cast<double>(threadCount * operationsPerThread) / seconds / 1000000.0,
+		"Mops/s");
+}
+
+int32_t main() {
+	for (uint64_t threadCount: { 1ull, 8ull, 32ull }) {
+		for (uint64_t readPercent: { 90ull, 50ull }) {
+			benchmarkCache<1>(threadCount, readPercent);
+			benchmarkCache<16>(threadCount, readPercent);
+		}
+		benchmarkVoiceStates(threadCount);
+	}
+	return test_state::getInstance().finish("ObjectCacheBenchmark");
+}
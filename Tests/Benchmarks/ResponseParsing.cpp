@@ -0,0 +1,75 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// ResponseParsing.cpp - Benchmark of parsing https response bodies directly against the previous prettify/minify round trip.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file ResponseParsing.cpp
+
+#include "../Common/TestUtilities.hpp"
+#include "../Common/Payloads.hpp"
+
+using namespace discord_core_api;
+using namespace discord_core_api::discord_core_internal;
+using namespace discord_core_test;
+
+/// @brief Parses a GET /guilds/{guild.id}/members response body, the way https_client::getParseErrors() does now and the way it did before.
+void benchmarkMemberList(uint64_t memberCount) {
+	jsonifier::string responseData{ generateGuildMemberList(memberCount) };
+	jsonifier::jsonifier_core<false> parser{};
+	uint64_t iterations{ std::max<uint64_t>(10, 100'000'000 / responseData.size()) };
+
+	jsonifier::vector<guild_member_data> directValue{};
+	parser.parseJson(directValue, responseData);
+	bool isDirectClean{ parser.getErrors().size() == 0 };
+	jsonifier::vector<guild_member_data> roundTripValue{};
+	parser.parseJson(roundTripValue, parser.minifyJson(parser.prettifyJson(responseData)));
+	check(isDirectClean && parser.getErrors().size() == 0, "the generated member list parses cleanly both ways");
+	check(directValue.size() == memberCount && roundTripValue.size() == memberCount, "both ways parse every member");
+
+	auto roundTrip = measureNsPerIteration(iterations, [&] {
+		jsonifier::vector<guild_member_data> valueNew{};
+		parser.parseJson(valueNew, parser.minifyJson(parser.prettifyJson(responseData)));
+		consume(valueNew.size());
+	});
+	auto direct = measureNsPerIteration(iterations, [&] {
+		jsonifier::vector<guild_member_data> valueNew{};
+		parser.parseJson(valueNew, responseData);
+		consume(valueNew.size());
+	});
+	auto toMegabytesPerSecond = [&](double nanoseconds) {
+		return static_cast<double>(responseData.size()) / nanoseconds * 1000.0;
+	};
+	std::string name{ "member list, " + std::to_string(memberCount) + " members, " + std::to_string(responseData.size()) + " bytes" };
+	printResult(name + ", prettify/minify round trip", toMegabytesPerSecond(roundTrip), "MB/s");
+	printResult(name + ", direct parse", toMegabytesPerSecond(direct), "MB/s");
+}
+
+int32_t main() {
+	for (uint64_t memberCount: { 1ull, 100ull, 1000ull }) {
+		benchmarkMemberList(memberCount);
+	}
+	return test_state::getInstance().finish("ResponseParsingBenchmark");
+}
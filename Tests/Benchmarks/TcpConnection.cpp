@@ -0,0 +1,300 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// TcpConnection.cpp - Benchmark of the syscalls, and time, which tcp_connection spends per frame, against a local tls echo server, with and without
+/// the poll which every health check used to make, and driven both by processIO() and by an epoll loop like base_socket_agent's.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file TcpConnection.cpp
+
+#include "../Common/LocalServer.hpp"
+
+#if defined(__linux__)
+	#include <sys/eventfd.h>
+	#include <sys/epoll.h>
+	#include <dlfcn.h>
+#endif
+
+using namespace discord_core_api;
+using namespace discord_core_api::discord_core_internal;
+using namespace discord_core_test;
+
+/// @brief The kinds of syscall which are counted, one for each libc function which the connection and openssl reach the socket through.
+enum class syscall_kind { poll = 0, epoll_wait = 1, read = 2, write = 3, setsockopt = 4 };
+
+static constexpr std::string_view syscallNames[]{ "poll", "epoll_wait", "read", "write", "setsockopt" };
+
+using syscall_counts = std::array<uint64_t, std::size(syscallNames)>;
+
+/// @brief Counts the syscalls made by the threads which ask for it - the server's threads don't.
+struct syscall_counter {
+	inline static thread_local bool isCounting{};
+	inline static std::array<std::atomic<uint64_t>, std::size(syscallNames)> counts{};
+
+	DCA_INLINE static void record(syscall_kind kind) {
+		if (isCounting) {
+			counts[static_cast<uint64_t>(kind)].fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	DCA_INLINE static syscall_counts getCounts() {
+		syscall_counts returnValue{};
+		for (uint64_t x = 0; x < returnValue.size(); ++x) {
+			returnValue[x] = counts[x].load(std::memory_order_relaxed);
+		}
+		return returnValue;
+	}
+};
+
+#if defined(__linux__)
+// these interpose libc's definitions, for the library and for openssl's socket bio alike, counting each call before passing it on. they are declared
+// under names of their own, so that they don't collide with the fortified inline wrappers in the system headers.
+template<typename function_type> function_type* getNextDefinition(const char* name) {
+	return reinterpret_cast<function_type*>(dlsym(RTLD_NEXT, name));
+}
+
+extern "C" int countedPoll(pollfd* fds, nfds_t fdCount, int timeout) __asm__("poll");
+extern "C" int countedPoll(pollfd* fds, nfds_t fdCount, int timeout) {
+	static auto nextDefinition = getNextDefinition<int(pollfd*, nfds_t, int)>("poll");
+	syscall_counter::record(syscall_kind::poll);
+	return nextDefinition(fds, fdCount, timeout);
+}
+
+extern "C" int countedEpollWait(int epollFd, epoll_event* events, int maxEventCount, int timeout) __asm__("epoll_wait");
+extern "C" int countedEpollWait(int epollFd, epoll_event* events, int maxEventCount, int timeout) {
+	static auto nextDefinition = getNextDefinition<int(int, epoll_event*, int, int)>("epoll_wait");
+	syscall_counter::record(syscall_kind::epoll_wait);
+	return nextDefinition(epollFd, events, maxEventCount, timeout);
+}
+
+extern "C" ssize_t countedRead(int fd, void* buffer, size_t size) __asm__("read");
+extern "C" ssize_t countedRead(int fd, void* buffer, size_t size) {
+	static auto nextDefinition = getNextDefinition<ssize_t(int, void*, size_t)>("read");
+	syscall_counter::record(syscall_kind::read);
+	return nextDefinition(fd, buffer, size);
+}
+
+extern "C" ssize_t countedWrite(int fd, const void* buffer, size_t size) __asm__("write");
+extern "C" ssize_t countedWrite(int fd, const void* buffer, size_t size) {
+	static auto nextDefinition = getNextDefinition<ssize_t(int, const void*, size_t)>("write");
+	syscall_counter::record(syscall_kind::write);
+	return nextDefinition(fd, buffer, size);
+}
+
+extern "C" int countedSetsockopt(int fd, int level, int name, const void* value, socklen_t length) __asm__("setsockopt");
+extern "C" int countedSetsockopt(int fd, int level, int name, const void* value, socklen_t length) {
+	static auto nextDefinition = getNextDefinition<int(int, int, int, const void*, socklen_t)>("setsockopt");
+	syscall_counter::record(syscall_kind::setsockopt);
+	return nextDefinition(fd, level, name, value, length);
+}
+#endif
+
+/// @brief A connection which counts the bytes echoed back to it, standing in for a shard's websocket connection.
+class frame_connection : public tcp_connection<frame_connection> {
+  public:
+	uint64_t receivedBytes{};
+
+	frame_connection(const jsonifier::string& hostNew, uint16_t portNew) : tcp_connection<frame_connection>{ hostNew, portNew } {
+	}
+
+	void handleBuffer() override {
+		receivedBytes += getInputBuffer().size();
+	}
+};
+
+/// @brief Sends every byte it receives straight back.
+void echoBytes(SSL* ssl) {
+	char buffer[16384];
+	size_t readBytes{};
+	while (SSL_read_ex(ssl, buffer, sizeof(buffer), &readBytes) == 1 && writeAll(ssl, std::string_view{ buffer, readBytes })) {
+	}
+}
+
+/// @brief Prints the syscalls made per frame, which are only counted on linux.
+void printSyscalls([[maybe_unused]] const std::string& name, [[maybe_unused]] const syscall_counts& countsBefore, [[maybe_unused]] const syscall_counts& countsAfter,
+	[[maybe_unused]] uint64_t frameCount) {
+#if defined(__linux__)
+	uint64_t totalCount{};
+	std::string breakdown{};
+	for (uint64_t x = 0; x < countsAfter.size(); ++x) {
+		totalCount += countsAfter[x] - countsBefore[x];
+		std::ostringstream stream{};
+		stream << (x > 0 ? ", " : " (") << syscallNames[x] << " " << static_cast<double>(countsAfter[x] - countsBefore[x]) / static_cast<double>(frameCount);
+		breakdown += stream.str();
+	}
+	printResult(name + ", per frame", static_cast<double>(totalCount) / static_cast<double>(frameCount), "syscalls" + breakdown + ")");
+#endif
+}
+
+/// @brief How the connection's io is driven.
+enum class io_driver {
+	process_io = 0,///< tcp_connection::processIO(), which polls the one socket - as the https connections are driven.
+	epoll	   = 1,///< An edge-triggered epoll loop, with an eventfd to wake it for queued writes - as base_socket_agent drives its shards.
+};
+
+#if defined(__linux__)
+/// @brief Drives a connection the way base_socket_agent drives a shard: its socket is registered edge-triggered with an epoll instance, writes queued
+/// from outside the loop wake it through an eventfd, and it is serviced through tcp_connection::processEvents(), being passed over again without
+/// a wait for as long as it reports undrained events.
+class epoll_loop {
+  public:
+	epoll_loop(frame_connection& connectionNew) : connection{ connectionNew } {
+		epollFd = epoll_create1(EPOLL_CLOEXEC);
+		wakeFd	= eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+		epoll_event event{};
+		event.events   = EPOLLIN;
+		event.data.u64 = wakeKey;
+		epoll_ctl(epollFd, EPOLL_CTL_ADD, wakeFd, &event);
+		event.events   = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+		event.data.u64 = connectionKey;
+		epoll_ctl(epollFd, EPOLL_CTL_ADD, static_cast<SOCKET>(connection.socket), &event);
+	}
+
+	/// @brief Wakes the loop, as websocket_client::onMessageQueued() does once a frame has been queued.
+	void wake() {
+		uint64_t value{ 1 };
+		[[maybe_unused]] auto result = write(wakeFd, &value, sizeof(value));
+	}
+
+	/// @brief Makes one pass, as base_socket_agent::processEvents() does.
+	void processEvents(int32_t maximumWait) {
+		std::array<epoll_event, 2> events{};
+		auto eventCount = epoll_wait(epollFd, events.data(), static_cast<int32_t>(events.size()), pendingEvents != 0 ? 0 : maximumWait);
+		uint32_t eventsNew{ pendingEvents };
+		for (int32_t x = 0; x < eventCount; ++x) {
+			if (events[x].data.u64 == wakeKey) {
+				uint64_t value{};
+				[[maybe_unused]] auto result = read(wakeFd, &value, sizeof(value));
+				if (connection.hasPendingWrites()) {
+					eventsNew |= EPOLLOUT;
+				}
+				continue;
+			}
+			eventsNew |= events[x].events;
+		}
+		pendingEvents = eventsNew != 0 ? connection.processEvents(eventsNew) : 0;
+	}
+
+	~epoll_loop() {
+		close(wakeFd);
+		close(epollFd);
+	}
+
+  protected:
+	static constexpr uint64_t connectionKey{ 0 };
+	static constexpr uint64_t wakeKey{ 1 };
+	frame_connection& connection;
+	uint32_t pendingEvents{};
+	int32_t epollFd{ -1 };
+	int32_t wakeFd{ -1 };
+};
+#endif
+
+/// @brief Sends frames in bursts, waiting for each burst to be echoed before sending the next, and reports the syscalls and time spent per frame.
+/// @param burstSize the number of frames written back to back - one for a heartbeat, more for a burst of presence or voice state updates.
+/// @param driver how the connection's io is driven.
+void benchmarkFrames(uint16_t port, std::string_view name, uint64_t frameSize, uint64_t burstSize, uint64_t burstCount, io_driver driver) {
+	frame_connection connection{ "127.0.0.1", port };
+	if (!connection.finishConnecting()) {
+		check(false, "the connection to the echo server completes its handshake");
+		return;
+	}
+#if defined(__linux__)
+	std::optional<epoll_loop> loop{};
+	if (driver == io_driver::epoll) {
+		loop.emplace(connection);
+	}
+#endif
+	auto processIO = [&] {
+#if defined(__linux__)
+		if (loop) {
+			return loop->processEvents(1000);
+		}
+#endif
+		connection.processIO(1000);
+	};
+	jsonifier::string frame{};
+	frame.resize(frameSize);
+	std::fill(frame.begin(), frame.end(), 'a');
+	auto countsBefore = syscall_counter::getCounts();
+
+	syscall_counter::isCounting = true;
+	auto startTime				= hrclock::now();
+	for (uint64_t x = 0; x < burstCount && connection.areWeStillConnected(); ++x) {
+		for (uint64_t y = 0; y < burstSize; ++y) {
+			connection.writeData(static_cast<jsonifier::string_view>(frame), false);
+#if defined(__linux__)
+			if (loop) {
+				loop->wake();
+			}
+#endif
+		}
+		auto targetBytes = (x + 1) * burstSize * frameSize;
+		while (connection.receivedBytes < targetBytes && connection.areWeStillConnected()) {
+			processIO();
+		}
+	}
+	auto seconds				= std::chrono::duration<double>(hrclock::now() - startTime).count();
+	syscall_counter::isCounting = false;
+
+	auto countsAfter = syscall_counter::getCounts();
+	uint64_t frameCount{ burstCount * burstSize };
+	check(connection.receivedBytes == frameCount * frameSize, "every frame is echoed back");
+	printResult(name, static_cast<double>(frameCount) / seconds, "frames/s");
+	printSyscalls(std::string{ name }, countsBefore, countsAfter, frameCount);
+}
+
+/// @brief Runs each kind of frame through the connection.
+void benchmarkFrameKinds(uint16_t port, const std::string& name, io_driver driver) {
+	benchmarkFrames(port, name + ", heartbeats, 1 frame of 64 bytes", 64, 1, 5000, driver);
+	benchmarkFrames(port, name + ", updates, bursts of 32 frames of 256 bytes", 256, 32, 500, driver);
+	benchmarkFrames(port, name + ", dispatches, 1 frame of 16384 bytes", 16384, 1, 1000, driver);
+}
+
+int32_t main() {
+	check(ssl_context_holder::initialize(), "the client tls context is created");
+	local_tls_server server{ echoBytes };
+	static constexpr std::pair<io_driver, std::string_view> drivers[]{
+#if defined(__linux__)
+		{ io_driver::epoll, "epoll loop" },
+#endif
+		{ io_driver::process_io, "processIO" }
+	};
+	// before and after: every health check polling the socket, as it once did, against health tracked from the io results.
+	for (auto& [driver, driverName]: drivers) {
+		for (bool pollOnHealthCheck: { true, false }) {
+			connection_settings::pollOnHealthCheck = pollOnHealthCheck;
+			benchmarkFrameKinds(server.getPort(), std::string{ driverName } + (pollOnHealthCheck ? ", poll per health check" : ", tracked health"), driver);
+		}
+	}
+	connection_settings::pollOnHealthCheck = false;
+	static constexpr std::pair<tcp_write_policy, std::string_view> writePolicies[]{ { tcp_write_policy::os_default, "os default" },
+		{ tcp_write_policy::no_delay, "no delay" }, { tcp_write_policy::cork, "cork" } };
+	for (auto& [writePolicy, policyName]: writePolicies) {
+		connection_settings::writePolicy = writePolicy;
+		benchmarkFrameKinds(server.getPort(), std::string{ drivers[0].second } + ", " + std::string{ policyName }, drivers[0].first);
+	}
+	return test_state::getInstance().finish("TcpConnectionBenchmark");
+}
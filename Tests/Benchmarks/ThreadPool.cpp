@@ -0,0 +1,95 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// ThreadPool.cpp - Benchmark of co_routine_thread_pool dispatch latency and throughput.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file ThreadPool.cpp
+
+#include "../Common/TestUtilities.hpp"
+
+using namespace discord_core_api;
+using namespace discord_core_api::discord_core_internal;
+using namespace discord_core_test;
+
+pool_task timeSubmitToResume(co_routine_thread_pool& pool, std::vector<uint64_t>& samples, std::atomic<uint64_t>& finished) {
+	auto submitTime = hrclock::now();
+	co_await resume_on_pool{ pool };
+	samples.emplace_back(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(hrclock::now() - submitTime).count()));
+	finished.fetch_add(1, std::memory_order_release);
+}
+
+/// @brief Measures the time from submitting a task until a worker resumes it, one task at a time.
+/// @param idleTime how long to leave the pool idle before each submission, so that its workers have parked.
+void benchmarkSubmitToResume(co_routine_thread_pool& pool, std::string_view name, uint64_t sampleCount, std::chrono::microseconds idleTime) {
+	std::vector<uint64_t> samples{};
+	samples.reserve(sampleCount);
+	std::atomic<uint64_t> finished{};
+	bool allFinished{ true };
+	for (uint64_t x = 0; x < sampleCount; ++x) {
+		if (idleTime.count() > 0) {
+			std::this_thread::sleep_for(idleTime);
+		}
+		timeSubmitToResume(pool, samples, finished);
+		allFinished = waitForCount(finished, x + 1, std::chrono::seconds{ 5 }) && allFinished;
+	}
+	check(allFinished, "every timed task is resumed");
+	printResult(name, summarizeLatencies(samples));
+}
+
+pool_task hopAcrossPool(co_routine_thread_pool& pool, uint64_t hopCount, std::atomic<uint64_t>& finished) {
+	for (uint64_t x = 0; x < hopCount; ++x) {
+		co_await resume_on_pool{ pool };
+	}
+	finished.fetch_add(1, std::memory_order_release);
+}
+
+/// @brief Measures how many hops per second the pool sustains, with tasks submitted from outside and resubmitted from inside.
+void benchmarkThroughput(co_routine_thread_pool& pool, uint64_t submitterCount) {
+	constexpr uint64_t totalTasks{ 64000 };
+	constexpr uint64_t hopCount{ 16 };
+	uint64_t tasksPerSubmitter{ totalTasks / submitterCount };
+	std::atomic<uint64_t> finished{};
+	auto startTime = hrclock::now();
+	runOnThreads(submitterCount, [&](uint64_t) {
+		for (uint64_t x = 0; x < tasksPerSubmitter; ++x) {
+			hopAcrossPool(pool, hopCount, finished);
+		}
+	});
+	check(waitForCount(finished, tasksPerSubmitter * submitterCount, std::chrono::seconds{ 60 }), "every throughput task finishes");
+	auto seconds = std::chrono::duration<double>(hrclock::now() - startTime).count();
+	printResult(std::to_string(submitterCount) + " submitting thread(s), throughput", static_cast<double>(tasksPerSubmitter * submitterCount * hopCount) / seconds / 1000000.0,
+		"Mhops/s");
+}
+
+int32_t main() {
+	co_routine_thread_pool pool{};
+	benchmarkSubmitToResume(pool, "submit to resume, busy pool", 100000, std::chrono::microseconds{ 0 });
+	benchmarkSubmitToResume(pool, "submit to resume, parked pool", 1000, std::chrono::microseconds{ 2000 });
+	for (uint64_t submitterCount: { 1ull, 8ull, 32ull }) {
+		benchmarkThroughput(pool, submitterCount);
+	}
+	return test_state::getInstance().finish("ThreadPoolBenchmark");
+}
@@ -0,0 +1,331 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// LocalServer.hpp - Header file for the loopback servers which the connection tests and benchmarks talk to.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file LocalServer.hpp
+#pragma once
+
+#include "TestUtilities.hpp"
+#include "Payloads.hpp"
+#include <openssl/x509.h>
+#include <openssl/evp.h>
+#include <functional>
+#include <csignal>
+#include <string>
+
+namespace discord_core_test {
+
+	/// @brief Opens a listening socket on an ephemeral port of the loopback interface.
+	/// @param port set to the port which was bound.
+	/// @param backlog the number of connections which may wait to be accepted.
+	/// @return the listening socket, or INVALID_SOCKET if it could not be opened.
+	DCA_INLINE SOCKET listenOnLoopback(uint16_t& port, int32_t backlog = SOMAXCONN) {
+#if !defined(_WIN32)
+		// a peer which hangs up mid-write must fail the write, rather than kill the test.
+		std::signal(SIGPIPE, SIG_IGN);
+#endif
+		SOCKET listener = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+		if (!isValidSocket(listener)) {
+			return INVALID_SOCKET;
+		}
+		sockaddr_in address{};
+		address.sin_family		= AF_INET;
+		address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		socklen_t addressLength{ sizeof(address) };
+		if (::bind(listener, reinterpret_cast<sockaddr*>(&address), addressLength) == SOCKET_ERROR || ::listen(listener, backlog) == SOCKET_ERROR ||
+			::getsockname(listener, reinterpret_cast<sockaddr*>(&address), &addressLength) == SOCKET_ERROR) {
+			close(listener);
+			return INVALID_SOCKET;
+		}
+		port = ntohs(address.sin_port);
+		return listener;
+	}
+
+	/// @brief Accepts connections on a loopback port, handing each one to a handler on a thread of its own.
+	class local_listener {
+	  public:
+		using handler_type = std::function<void(SOCKET)>;
+
+		DCA_INLINE uint16_t getPort() const {
+			return port;
+		}
+
+		/// @brief Collects the number of connections which have been accepted so far.
+		DCA_INLINE uint64_t getConnectionCount() const {
+			return connectionCount.load(std::memory_order_acquire);
+		}
+
+		DCA_INLINE ~local_listener() {
+			stop();
+		}
+
+	  protected:
+		std::vector<SOCKET> connectionSockets{};
+		std::vector<std::jthread> connectionThreads{};
+		std::atomic<uint64_t> connectionCount{};
+		std::jthread acceptThread{};
+		SOCKET listener{ INVALID_SOCKET };
+		std::mutex accessMutex{};
+		handler_type handler{};
+		uint16_t port{};
+
+		DCA_INLINE local_listener(handler_type handlerNew) : handler{ std::move(handlerNew) } {
+			listener = listenOnLoopback(port);
+			check(isValidSocket(listener), "the local listener opened its port");
+		}
+
+		/// @brief Starts accepting connections - called by the derived listener, once it is fully constructed.
+		DCA_INLINE void start() {
+			if (isValidSocket(listener)) {
+				acceptThread = std::jthread{ [this] {
+					acceptConnections();
+				} };
+			}
+		}
+
+		/// @brief Closes the port and every connection accepted on it, then waits for their handlers to return - called by the derived listener, before
+		/// the members its handler uses are destroyed.
+		DCA_INLINE void stop() {
+			if (isValidSocket(listener)) {
+				::shutdown(listener, SHUT_RDWR);
+			}
+			if (acceptThread.joinable()) {
+				acceptThread.join();
+			}
+			if (isValidSocket(listener)) {
+				close(listener);
+				listener = INVALID_SOCKET;
+			}
+			std::unique_lock lock{ accessMutex };
+			for (auto& value: connectionSockets) {
+				::shutdown(value, SHUT_RDWR);
+			}
+			auto threads = std::move(connectionThreads);
+			lock.unlock();
+			threads.clear();
+			for (auto& value: connectionSockets) {
+				close(value);
+			}
+			connectionSockets.clear();
+		}
+
+		DCA_INLINE void acceptConnections() {
+			while (true) {
+				SOCKET connection = ::accept(listener, nullptr, nullptr);
+				if (!isValidSocket(connection)) {
+					return;
+				}
+				int32_t value{ 1 };
+				::setsockopt(connection, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<char*>(&value), sizeof(value));
+				std::unique_lock lock{ accessMutex };
+				connectionSockets.emplace_back(connection);
+				connectionThreads.emplace_back([this, connection] {
+					handler(connection);
+				});
+				connectionCount.fetch_add(1, std::memory_order_release);
+			}
+		}
+	};
+
+	/// @brief A listener which accepts tcp connections and then never says a word on them, so that a peer's tls handshake never completes.
+	class blackhole_listener : public local_listener {
+	  public:
+		DCA_INLINE blackhole_listener()
+			: local_listener{ [](SOCKET connection) {
+				  char buffer[1024];
+				  // the peer's client hello is read and dropped, until the listener hangs up.
+				  while (::recv(connection, buffer, sizeof(buffer), 0) > 0) {
+				  }
+			  } } {
+			start();
+		}
+	};
+
+	/// @brief A listener which never accepts, and whose accept queue is filled by a connection of its own, so that the connections made to it never
+	/// complete.
+	/// @details relies on linux dropping the syns which arrive while a listener's accept queue is full, rather than refusing them.
+	class unresponsive_listener {
+	  public:
+		DCA_INLINE unresponsive_listener() {
+			listener = listenOnLoopback(port, 0);
+			check(isValidSocket(listener), "the unresponsive listener opened its port");
+			sockaddr_in address{};
+			address.sin_family		= AF_INET;
+			address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+			address.sin_port		= htons(port);
+			queuedConnection		= ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+			check(::connect(queuedConnection, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0, "the unresponsive listener's accept queue is filled");
+		}
+
+		DCA_INLINE uint16_t getPort() const {
+			return port;
+		}
+
+		DCA_INLINE ~unresponsive_listener() {
+			close(queuedConnection);
+			close(listener);
+		}
+
+	  protected:
+		SOCKET queuedConnection{ INVALID_SOCKET };
+		SOCKET listener{ INVALID_SOCKET };
+		uint16_t port{};
+	};
+
+	/// @brief A tls server on a loopback port, with a self-signed certificate generated at startup, which hands each connection it accepts to a handler
+	/// once its handshake completes.
+	class local_tls_server : public local_listener {
+	  public:
+		using tls_handler_type = std::function<void(SSL*)>;
+
+		DCA_INLINE local_tls_server(tls_handler_type tlsHandlerNew)
+			: local_listener{ [this](SOCKET connection) {
+				  serveConnection(connection);
+			  } },
+			  tlsHandler{ std::move(tlsHandlerNew) }, context{ createContext() } {
+			check(context != nullptr, "the local tls server created its context");
+			start();
+		}
+
+		DCA_INLINE ~local_tls_server() {
+			stop();
+			if (context) {
+				SSL_CTX_free(context);
+			}
+		}
+
+	  protected:
+		tls_handler_type tlsHandler{};
+		SSL_CTX* context{};
+
+		/// @brief Creates a server context, with a freshly generated P-256 key and a self-signed certificate for it.
+		DCA_INLINE static SSL_CTX* createContext() {
+			EVP_PKEY* key{};
+			auto keyContext = EVP_PKEY_CTX_new_id(EVP_PKEY_EC, nullptr);
+			if (!keyContext || EVP_PKEY_keygen_init(keyContext) <= 0 || EVP_PKEY_CTX_set_ec_paramgen_curve_nid(keyContext, NID_X9_62_prime256v1) <= 0 ||
+				EVP_PKEY_keygen(keyContext, &key) <= 0) {
+				EVP_PKEY_CTX_free(keyContext);
+				return nullptr;
+			}
+			EVP_PKEY_CTX_free(keyContext);
+			auto certificate = X509_new();
+			X509_set_version(certificate, 2);
+			ASN1_INTEGER_set(X509_get_serialNumber(certificate), 1);
+			X509_gmtime_adj(X509_getm_notBefore(certificate), 0);
+			X509_gmtime_adj(X509_getm_notAfter(certificate), 24 * 60 * 60);
+			X509_set_pubkey(certificate, key);
+			auto name = X509_get_subject_name(certificate);
+			X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC, reinterpret_cast<const uint8_t*>("127.0.0.1"), -1, -1, 0);
+			X509_set_issuer_name(certificate, name);
+			SSL_CTX* returnValue{};
+			if (X509_sign(certificate, key, EVP_sha256()) > 0) {
+				returnValue = SSL_CTX_new(TLS_server_method());
+				if (returnValue && (SSL_CTX_use_certificate(returnValue, certificate) != 1 || SSL_CTX_use_PrivateKey(returnValue, key) != 1)) {
+					SSL_CTX_free(returnValue);
+					returnValue = nullptr;
+				}
+			}
+			X509_free(certificate);
+			EVP_PKEY_free(key);
+			return returnValue;
+		}
+
+		DCA_INLINE void serveConnection(SOCKET connection) {
+			if (!context) {
+				return;
+			}
+			auto ssl = SSL_new(context);
+			SSL_set_fd(ssl, static_cast<int32_t>(connection));
+			if (SSL_accept(ssl) == 1) {
+				tlsHandler(ssl);
+				SSL_shutdown(ssl);
+			}
+			SSL_free(ssl);
+		}
+	};
+
+	/// @brief Reads one http/1.1 request, with its body if it has a content-length, from a tls connection.
+	/// @param ssl the connection to read from.
+	/// @param buffer the bytes read from the connection which have yet to be consumed, which carries over between calls.
+	/// @param request set to the request which was read.
+	/// @return `false` if the connection closed before a whole request arrived.
+	DCA_INLINE bool readHttpRequest(SSL* ssl, std::string& buffer, std::string& request) {
+		char readBuffer[16384];
+		auto readMore = [&] {
+			size_t readBytes{};
+			if (SSL_read_ex(ssl, readBuffer, sizeof(readBuffer), &readBytes) != 1) {
+				return false;
+			}
+			buffer.append(readBuffer, readBytes);
+			return true;
+		};
+		uint64_t headerEnd{};
+		while ((headerEnd = buffer.find("\r\n\r\n")) == std::string::npos) {
+			if (!readMore()) {
+				return false;
+			}
+		}
+		uint64_t requestSize{ headerEnd + 4 };
+		auto lengthStart = buffer.find("Content-Length: ");
+		if (lengthStart != std::string::npos && lengthStart < headerEnd) {
+			requestSize += std::stoull(buffer.substr(lengthStart + std::string_view{ "Content-Length: " }.size()));
+		}
+		while (buffer.size() < requestSize) {
+			if (!readMore()) {
+				return false;
+			}
+		}
+		request = buffer.substr(0, requestSize);
+		buffer.erase(0, requestSize);
+		return true;
+	}
+
+	/// @brief Writes all of a string to a tls connection.
+	/// @param ssl the connection to write to.
+	/// @param data the data to write.
+	/// @return `false` if the connection failed before all of it was written.
+	DCA_INLINE bool writeAll(SSL* ssl, std::string_view data) {
+		while (data.size() > 0) {
+			size_t writtenBytes{};
+			if (SSL_write_ex(ssl, data.data(), data.size(), &writtenBytes) != 1) {
+				return false;
+			}
+			data.remove_prefix(writtenBytes);
+		}
+		return true;
+	}
+
+	/// @brief Points a connection at a port of the loopback interface, for the requests it makes until it next disconnects.
+	/// @details the https path reconnects to port 443 of its workload's host, so a connection which is pointed elsewhere has to be connected up front.
+	/// @param connection the connection to point at the port.
+	/// @param port the port to connect to.
+	DCA_INLINE void connectLocally(discord_core_api::discord_core_internal::https_connection& connection, uint16_t port) {
+		using namespace discord_core_api::discord_core_internal;
+		*static_cast<tcp_connection<https_connection>*>(&connection) = https_connection{ "127.0.0.1", port };
+	}
+
+}
@@ -0,0 +1,372 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// Payloads.hpp - Header file for generating the gateway and rest payloads used by the tests and benchmarks.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file Payloads.hpp
+#pragma once
+
+#include <string_view>
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <limits>
+#include <bit>
+#include <string>
+#include <vector>
+
+namespace discord_core_test {
+
+	/// @brief Builds a snowflake string that is unique for each pair of arguments.
+	/// @param kind a small number identifying the kind of entity.
+	/// @param index the index of the entity.
+	/// @return the snowflake, as a json string.
+	inline std::string makeSnowflake(uint64_t kind, uint64_t index) {
+		return "\"" + std::to_string(1000000000000000000ull + kind * 10000000000ull + index) + "\"";
+	}
+
+	/// @brief Builds a guild member object, in the shape discord sends it.
+	/// @param index the index of the member.
+	/// @param roleCount the number of roles in the guild, some of which the member holds.
+	/// @return the json object.
+	inline std::string generateGuildMember(uint64_t index, uint64_t roleCount) {
+		std::string returnValue{ "{\"user\":{\"id\":" + makeSnowflake(1, index) + ",\"username\":\"user" + std::to_string(index) +
+			"\",\"discriminator\":\"0\",\"global_name\":\"User \\\"" + std::to_string(index) + "\\\"\",\"public_flags\":0},\"roles\":[" };
+		for (uint64_t x = 0; x < roleCount && x < 3; ++x) {
+			returnValue += (x > 0 ? "," : "") + makeSnowflake(3, (index + x) % roleCount);
+		}
+		returnValue += "],\"nick\":\"nick {" + std::to_string(index) + "}\",\"joined_at\":\"2021-05-13T00:00:00.000000+00:00\",\"deaf\":false,\"mute\":false,\"flags\":0,\"pending\":false}";
+		return returnValue;
+	}
+
+	/// @brief Builds a guild object, as found in the "d" field of GUILD_CREATE.
+	/// @param memberCount the number of members to include.
+	/// @param channelCount the number of channels to include.
+	/// @param roleCount the number of roles to include.
+	/// @return the json object.
+	inline std::string generateGuild(uint64_t memberCount, uint64_t channelCount, uint64_t roleCount) {
+		std::string returnValue{ "{\"id\":" + makeSnowflake(0, 1) + ",\"name\":\"Benchmark Guild\",\"owner_id\":" + makeSnowflake(1, 0) +
+			",\"member_count\":" + std::to_string(memberCount) + ",\"large\":true,\"unavailable\":false,\"joined_at\":\"2021-05-13T00:00:00.000000+00:00\",\"channels\":[" };
+		for (uint64_t x = 0; x < channelCount; ++x) {
+			returnValue += (x > 0 ? "," : "") + std::string{ "{\"id\":" } + makeSnowflake(2, x) + ",\"type\":0,\"name\":\"channel-" + std::to_string(x) +
+				"\",\"position\":" + std::to_string(x) + ",\"topic\":\"a topic with [brackets], {braces} and \\\"quotes\\\"\",\"permission_overwrites\":[]}";
+		}
+		returnValue += "],\"roles\":[";
+		for (uint64_t x = 0; x < roleCount; ++x) {
+			returnValue += (x > 0 ? "," : "") + std::string{ "{\"id\":" } + makeSnowflake(3, x) + ",\"name\":\"role-" + std::to_string(x) +
+				"\",\"color\":0,\"hoist\":false,\"position\":" + std::to_string(x) + ",\"permissions\":\"1071698660929\",\"managed\":false,\"mentionable\":false,\"flags\":0}";
+		}
+		returnValue += "],\"members\":[";
+		for (uint64_t x = 0; x < memberCount; ++x) {
+			returnValue += (x > 0 ? "," : "") + generateGuildMember(x, roleCount);
+		}
+		returnValue += "],\"features\":[\"COMMUNITY\",\"NEWS\"],\"emojis\":[],\"stickers\":[],\"threads\":[],\"presences\":[],\"voice_states\":[],\"preferred_locale\":\"en-US\"}";
+		return returnValue;
+	}
+
+	/// @brief Builds a complete GUILD_CREATE dispatch frame.
+	/// @param memberCount the number of members to include.
+	/// @param channelCount the number of channels to include.
+	/// @param roleCount the number of roles to include.
+	/// @param sequence the frame's sequence number.
+	/// @return the json frame.
+	inline std::string generateGuildCreateFrame(uint64_t memberCount, uint64_t channelCount, uint64_t roleCount, int64_t sequence = 2) {
+		return "{\"t\":\"GUILD_CREATE\",\"s\":" + std::to_string(sequence) + ",\"op\":0,\"d\":" + generateGuild(memberCount, channelCount, roleCount) + "}";
+	}
+
+	/// @brief Encodes json as an etf term, in the shape discord's gateway sends it when etf encoding is requested.
+	/// @details objects become maps, arrays become lists, strings and keys become binaries, and true, false and null become atoms. the
+	/// json is expected to be well formed, as the payloads built above are.
+	class json_to_etf_encoder {
+	  public:
+		/// @brief Encode a json value.
+		/// @param json the json to encode.
+		/// @return the etf term, preceded by the format version.
+		static std::string encode(std::string_view json) {
+			json_to_etf_encoder encoder{ json };
+			encoder.returnValue.push_back(static_cast<char>(131));
+			encoder.encodeValue();
+			return std::move(encoder.returnValue);
+		}
+
+	  protected:
+		std::string_view json{};
+		std::string returnValue{};
+		uint64_t index{};
+
+		json_to_etf_encoder(std::string_view jsonNew) : json{ jsonNew } {};
+
+		void skipWhitespace() {
+			while (index < json.size() && (json[index] == ' ' || json[index] == '\n' || json[index] == '\r' || json[index] == '\t')) {
+				++index;
+			}
+		}
+
+		void writeByte(uint8_t value) {
+			returnValue.push_back(static_cast<char>(value));
+		}
+
+		void writeUint32(uint32_t value) {
+			for (int32_t x = 3; x >= 0; --x) {
+				writeByte(static_cast<uint8_t>(value >> (x * 8)));
+			}
+		}
+
+		void patchUint32(uint64_t position, uint32_t value) {
+			for (int32_t x = 3; x >= 0; --x) {
+				returnValue[position + 3 - static_cast<uint64_t>(x)] = static_cast<char>(static_cast<uint8_t>(value >> (x * 8)));
+			}
+		}
+
+		void writeAtom(std::string_view atom) {
+			writeByte(115);
+			writeByte(static_cast<uint8_t>(atom.size()));
+			returnValue += atom;
+		}
+
+		void writeBinary(std::string_view string) {
+			writeByte(109);
+			writeUint32(static_cast<uint32_t>(string.size()));
+			returnValue += string;
+		}
+
+		std::string readString() {
+			std::string string{};
+			++index;
+			while (json[index] != '"') {
+				if (json[index] == '\\') {
+					++index;
+					switch (json[index]) {
+						case 'n': {
+							string.push_back('\n');
+							break;
+						}
+						case 't': {
+							string.push_back('\t');
+							break;
+						}
+						case 'r': {
+							string.push_back('\r');
+							break;
+						}
+						default: {
+							string.push_back(json[index]);
+							break;
+						}
+					}
+				} else {
+					string.push_back(json[index]);
+				}
+				++index;
+			}
+			++index;
+			return string;
+		}
+
+		void encodeNumber() {
+			uint64_t start{ index };
+			bool isFloat{};
+			while (index < json.size() && (json[index] == '-' || json[index] == '+' || json[index] == '.' || json[index] == 'e' || json[index] == 'E' ||
+					   (json[index] >= '0' && json[index] <= '9'))) {
+				isFloat = isFloat || json[index] == '.' || json[index] == 'e' || json[index] == 'E';
+				++index;
+			}
+			std::string number{ json.substr(start, index - start) };
+			if (isFloat) {
+				uint64_t bits{ std::bit_cast<uint64_t>(std::stod(number)) };
+				writeByte(70);
+				for (int32_t x = 7; x >= 0; --x) {
+					writeByte(static_cast<uint8_t>(bits >> (x * 8)));
+				}
+				return;
+			}
+			int64_t value{ std::stoll(number) };
+			if (value >= 0 && value <= 255) {
+				writeByte(97);
+				writeByte(static_cast<uint8_t>(value));
+			} else if (value >= std::numeric_limits<int32_t>::min() && value <= std::numeric_limits<int32_t>::max()) {
+				writeByte(98);
+				writeUint32(static_cast<uint32_t>(static_cast<int32_t>(value)));
+			} else {
+				uint64_t magnitude{ value < 0 ? 0ull - static_cast<uint64_t>(value) : static_cast<uint64_t>(value) };
+				uint8_t digits[8]{};
+				uint8_t length{};
+				for (; magnitude > 0; magnitude >>= 8) {
+					digits[length++] = static_cast<uint8_t>(magnitude);
+				}
+				writeByte(110);
+				writeByte(length);
+				writeByte(value < 0 ? 1 : 0);
+				for (uint8_t x = 0; x < length; ++x) {
+					writeByte(digits[x]);
+				}
+			}
+		}
+
+		void encodeValue() {
+			skipWhitespace();
+			switch (json[index]) {
+				case '{': {
+					++index;
+					writeByte(116);
+					uint64_t lengthPosition{ returnValue.size() };
+					writeUint32(0);
+					uint32_t length{};
+					skipWhitespace();
+					while (json[index] != '}') {
+						writeBinary(readString());
+						skipWhitespace();
+						++index;
+						encodeValue();
+						++length;
+						skipWhitespace();
+						if (json[index] == ',') {
+							++index;
+							skipWhitespace();
+						}
+					}
+					++index;
+					patchUint32(lengthPosition, length);
+					return;
+				}
+				case '[': {
+					++index;
+					skipWhitespace();
+					if (json[index] == ']') {
+						++index;
+						writeByte(106);
+						return;
+					}
+					writeByte(108);
+					uint64_t lengthPosition{ returnValue.size() };
+					writeUint32(0);
+					uint32_t length{};
+					while (json[index] != ']') {
+						encodeValue();
+						++length;
+						skipWhitespace();
+						if (json[index] == ',') {
+							++index;
+						}
+					}
+					++index;
+					writeByte(106);
+					patchUint32(lengthPosition, length);
+					return;
+				}
+				case '"': {
+					writeBinary(readString());
+					return;
+				}
+				case 't': {
+					index += 4;
+					writeAtom("true");
+					return;
+				}
+				case 'f': {
+					index += 5;
+					writeAtom("false");
+					return;
+				}
+				case 'n': {
+					index += 4;
+					writeAtom("nil");
+					return;
+				}
+				default: {
+					encodeNumber();
+					return;
+				}
+			}
+		}
+	};
+
+	/// @brief Builds a complete GUILD_CREATE dispatch frame, encoded as etf.
+	/// @param memberCount the number of members to include.
+	/// @param channelCount the number of channels to include.
+	/// @param roleCount the number of roles to include.
+	/// @param sequence the frame's sequence number.
+	/// @return the etf frame.
+	inline std::string generateGuildCreateEtfFrame(uint64_t memberCount, uint64_t channelCount, uint64_t roleCount, int64_t sequence = 2) {
+		return json_to_etf_encoder::encode(generateGuildCreateFrame(memberCount, channelCount, roleCount, sequence));
+	}
+
+	/// @brief Builds the body of a list guild members response.
+	/// @param memberCount the number of members to include.
+	/// @return the json array.
+	inline std::string generateGuildMemberList(uint64_t memberCount) {
+		std::string returnValue{ "[" };
+		for (uint64_t x = 0; x < memberCount; ++x) {
+			returnValue += (x > 0 ? "," : "") + generateGuildMember(x, 16);
+		}
+		returnValue += "]";
+		return returnValue;
+	}
+
+	/// @brief Frames a body as an https response with a Content-Length.
+	/// @param statusLine the status line, without its line ending.
+	/// @param headers any further header lines, each ending in "\r\n".
+	/// @param body the body.
+	/// @return the response, as it arrives on the wire.
+	inline std::string generateHttpResponse(std::string_view statusLine, std::string_view headers, std::string_view body) {
+		std::string returnValue{ statusLine };
+		returnValue += "\r\nContent-Type: application/json\r\n";
+		returnValue += headers;
+		returnValue += "Content-Length: " + std::to_string(body.size()) + "\r\n\r\n";
+		returnValue += body;
+		return returnValue;
+	}
+
+	/// @brief Frames a body as a chunked https response, ending in a trailer.
+	/// @details the chunk sizes alternate between lower and upper case hex, and every other size line carries a chunk extension.
+	/// @param statusLine the status line, without its line ending.
+	/// @param headers any further header lines, each ending in "\r\n".
+	/// @param body the body.
+	/// @param chunkSizes the sizes of the chunks, which are cycled through until the body is used up.
+	/// @return the response, as it arrives on the wire.
+	inline std::string generateChunkedHttpResponse(std::string_view statusLine, std::string_view headers, std::string_view body, const std::vector<uint64_t>& chunkSizes) {
+		std::string returnValue{ statusLine };
+		returnValue += "\r\nContent-Type: application/json\r\n";
+		returnValue += headers;
+		returnValue += "Transfer-Encoding: chunked\r\n\r\n";
+		for (uint64_t x = 0; body.size() > 0; ++x) {
+			auto chunkSize = std::min<uint64_t>(std::max<uint64_t>(chunkSizes[x % chunkSizes.size()], 1), body.size());
+			char sizeLine[16]{};
+			auto sizeLineEnd = std::to_chars(sizeLine, sizeLine + sizeof(sizeLine), chunkSize, 16).ptr;
+			for (auto iter = sizeLine; iter < sizeLineEnd && x % 2 == 1; ++iter) {
+				*iter = (*iter >= 'a' && *iter <= 'f') ? static_cast<char>(*iter - 'a' + 'A') : *iter;
+			}
+			returnValue.append(sizeLine, sizeLineEnd);
+			returnValue += x % 2 == 1 ? ";name=value\r\n" : "\r\n";
+			returnValue += body.substr(0, chunkSize);
+			returnValue += "\r\n";
+			body.remove_prefix(chunkSize);
+		}
+		returnValue += "0\r\nx-trailer: 1\r\n\r\n";
+		return returnValue;
+	}
+
+}
@@ -0,0 +1,245 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// TestUtilities.hpp - Header file for the helpers shared by the test and benchmark executables.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file TestUtilities.hpp
+#pragma once
+
+#include <discordcoreapi/Index.hpp>
+#include <source_location>
+#include <string_view>
+#include <algorithm>
+#include <iostream>
+#include <coroutine>
+#include <barrier>
+#include <thread>
+#include <vector>
+
+namespace discord_core_test {
+
+	using hrclock = std::chrono::high_resolution_clock;
+
+	/// @brief Tracks the checks made by a single test executable.
+	class test_state {
+	  public:
+		/// @brief Collects the test_state of this executable.
+		/// @return the test_state.
+		DCA_INLINE static test_state& getInstance() {
+			static test_state state{};
+			return state;
+		}
+
+		/// @brief Records the outcome of a single check, printing it if it failed.
+		/// @param condition whether or not the check passed.
+		/// @param description what was being checked.
+		/// @param location where the check was made.
+		DCA_INLINE void check(bool condition, std::string_view description, const std::source_location& location) {
+			std::unique_lock lock{ accessMutex };
+			++checkCount;
+			if (!condition) {
+				++failureCount;
+				std::cerr << location.file_name() << ":" << location.line() << ": check failed: " << description << std::endl;
+			}
+		}
+
+		/// @brief Prints a summary of the checks.
+		/// @param testName the name of the test.
+		/// @return the exit code for the executable, which is non-zero if any check failed.
+		DCA_INLINE int32_t finish(std::string_view testName) {
+			std::unique_lock lock{ accessMutex };
+			std::cout << testName << ": " << checkCount - failureCount << "/" << checkCount << " checks passed." << std::endl;
+			return failureCount == 0 && checkCount > 0 ? 0 : 1;
+		}
+
+	  protected:
+		std::mutex accessMutex{};
+		uint64_t failureCount{};
+		uint64_t checkCount{};
+	};
+
+	/// @brief Records the outcome of a single check.
+	/// @param condition whether or not the check passed.
+	/// @param description what was being checked.
+	/// @param location where the check was made.
+	DCA_INLINE void check(bool condition, std::string_view description, const std::source_location& location = std::source_location::current()) {
+		test_state::getInstance().check(condition, description, location);
+	}
+
+	/// @brief Views a string as bytes.
+	/// @param value the string to view.
+	/// @return the byte view.
+	DCA_INLINE jsonifier::string_view_base<uint8_t> toView(std::string_view value) {
+		return { reinterpret_cast<const uint8_t*>(value.data()), value.size() };
+	}
+
+	/// @brief Copies a byte view into a string.
+	/// @param value the bytes to copy.
+	/// @return the string.
+	DCA_INLINE std::string toString(jsonifier::string_view_base<uint8_t> value) {
+		return { reinterpret_cast<const char*>(value.data()), value.size() };
+	}
+
+	/// @brief Keeps the result of a benchmarked expression alive, so that it is not optimized away.
+	inline std::atomic<uint64_t> benchmarkSink{};
+
+	/// @brief Feeds a value into the benchmarkSink.
+	/// @param value the value to keep alive.
+	DCA_INLINE void consume(uint64_t value) {
+		benchmarkSink.fetch_add(value, std::memory_order_relaxed);
+	}
+
+	/// @brief Times a function, called a fixed number of times.
+	/// @tparam function_type the type of the function.
+	/// @param iterations the number of times to call the function.
+	/// @param function the function to time.
+	/// @return the mean time per call, in nanoseconds.
+	template<typename function_type> DCA_INLINE double measureNsPerIteration(uint64_t iterations, function_type&& function) {
+		auto startTime = hrclock::now();
+		for (uint64_t x = 0; x < iterations; ++x) {
+			function();
+		}
+		return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(hrclock::now() - startTime).count()) / static_cast<double>(iterations);
+	}
+
+	/// @brief Runs a function on a number of threads at once, releasing them together.
+	/// @tparam function_type the type of the function, which receives the index of the thread it runs on.
+	/// @param threadCount the number of threads to run the function on.
+	/// @param function the function to run.
+	/// @return the time from the threads being released until the last of them finished, in seconds.
+	template<typename function_type> DCA_INLINE double runOnThreads(uint64_t threadCount, function_type&& function) {
+		std::barrier startBarrier{ static_cast<std::ptrdiff_t>(threadCount + 1) };
+		std::vector<std::jthread> threads{};
+		threads.reserve(threadCount);
+		for (uint64_t x = 0; x < threadCount; ++x) {
+			threads.emplace_back([&, x] {
+				startBarrier.arrive_and_wait();
+				function(x);
+			});
+		}
+		startBarrier.arrive_and_wait();
+		auto startTime = hrclock::now();
+		threads.clear();
+		return std::chrono::duration<double>(hrclock::now() - startTime).count();
+	}
+
+	/// @brief A fire-and-forget coroutine, which runs until its first suspension on the calling thread and destroys itself when it finishes.
+	struct pool_task {
+		struct promise_type {
+			DCA_INLINE pool_task get_return_object() {
+				return {};
+			}
+
+			DCA_INLINE std::suspend_never initial_suspend() noexcept {
+				return {};
+			}
+
+			DCA_INLINE std::suspend_never final_suspend() noexcept {
+				return {};
+			}
+
+			DCA_INLINE void return_void() {
+			}
+
+			DCA_INLINE void unhandled_exception() {
+				std::terminate();
+			}
+		};
+	};
+
+	/// @brief An awaitable which resumes the awaiting coroutine on one of a co_routine_thread_pool's workers.
+	struct resume_on_pool {
+		discord_core_api::discord_core_internal::co_routine_thread_pool& pool;
+
+		DCA_INLINE bool await_ready() const {
+			return false;
+		}
+
+		DCA_INLINE void await_suspend(std::coroutine_handle<> coroHandle) {
+			pool.submitTask(coroHandle);
+		}
+
+		DCA_INLINE void await_resume() {
+		}
+	};
+
+	/// @brief Waits for an atomic counter to reach a value.
+	/// @param counter the counter to wait on.
+	/// @param target the value to wait for.
+	/// @param timeout the longest time to wait.
+	/// @return `true` if the counter reached the value, `false` if the wait timed out.
+	DCA_INLINE bool waitForCount(const std::atomic<uint64_t>& counter, uint64_t target, std::chrono::milliseconds timeout) {
+		auto deadline = hrclock::now() + timeout;
+		while (counter.load(std::memory_order_acquire) < target) {
+			if (hrclock::now() > deadline) {
+				return false;
+			}
+			std::this_thread::yield();
+		}
+		return true;
+	}
+
+	/// @brief The spread of a set of latency samples.
+	struct latency_summary {
+		double p50{};///< The median, in microseconds.
+		double p99{};///< The 99th percentile, in microseconds.
+		double max{};///< The largest sample, in microseconds.
+	};
+
+	/// @brief Summarizes a set of latency samples.
+	/// @param samples the samples, in nanoseconds, which are sorted in place.
+	/// @return the summary.
+	DCA_INLINE latency_summary summarizeLatencies(std::vector<uint64_t>& samples) {
+		latency_summary returnValue{};
+		if (samples.empty()) {
+			return returnValue;
+		}
+		std::sort(samples.begin(), samples.end());
+		auto percentile = [&](double fraction) {
+			return static_cast<double>(samples[static_cast<uint64_t>(fraction * static_cast<double>(samples.size() - 1))]) / 1000.0;
+		};
+		returnValue.p50 = percentile(0.50);
+		returnValue.p99 = percentile(0.99);
+		returnValue.max = static_cast<double>(samples.back()) / 1000.0;
+		return returnValue;
+	}
+
+	/// @brief Prints a single benchmark result.
+	/// @param name the name of the measurement.
+	/// @param value the measured value.
+	/// @param unit the unit of the measured value.
+	DCA_INLINE void printResult(std::string_view name, double value, std::string_view unit) {
+		std::cout << name << ": " << value << " " << unit << std::endl;
+	}
+
+	/// @brief Prints a latency summary.
+	/// @param name the name of the measurement.
+	/// @param summary the summary to print.
+	DCA_INLINE void printResult(std::string_view name, const latency_summary& summary) {
+		std::cout << name << ": p50 " << summary.p50 << " us, p99 " << summary.p99 << " us, max " << summary.max << " us" << std::endl;
+	}
+
+}
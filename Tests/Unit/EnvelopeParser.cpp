@@ -0,0 +1,122 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// EnvelopeParser.cpp - Tests for the single-pass gateway envelope parsers.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file EnvelopeParser.cpp
+
+#include "../Common/TestUtilities.hpp"
+#include "../Common/Payloads.hpp"
+
+using namespace discord_core_api;
+using namespace discord_core_api::discord_core_internal;
+using namespace discord_core_test;
+
+void testGuildCreateFrame() {
+	auto guild = generateGuild(25, 5, 5);
+	std::string frame{ "{\"t\":\"GUILD_CREATE\",\"s\":42,\"op\":0,\"d\":" + guild + "}" };
+	websocket_message message{};
+	auto data = json_envelope_parser::parseJsonEnvelope(toView(frame), message);
+	check(message.op == 0, "op is read");
+	check(message.s.has_value() && message.s.value() == 42, "s is read");
+	check(message.t.has_value() && message.t.value() == "GUILD_CREATE", "t is read");
+	check(toString(data) == guild, "d is returned as a view of the whole guild object");
+	check(reinterpret_cast<const char*>(data.data()) == frame.data() + frame.find("\"d\":") + 4, "d points into the frame, without being copied");
+}
+
+void testKeyOrderAndWhitespace() {
+	std::string frame{ " {\n\t\"d\" : { \"a\" : [1, {\"b\": \"}\\\"]\"}] } ,\n\"op\" : 0 , \"s\" : 7 , \"t\" : \"MESSAGE_CREATE\" }\n" };
+	websocket_message message{};
+	auto data = json_envelope_parser::parseJsonEnvelope(toView(frame), message);
+	check(toString(data) == "{ \"a\" : [1, {\"b\": \"}\\\"]\"}] }", "d is delimited correctly when it precedes the other keys");
+	check(message.op == 0 && message.s.value_or(0) == 7 && message.t.value_or("") == "MESSAGE_CREATE", "op, s and t are read after d");
+}
+
+void testNullsAndMissingFields() {
+	std::string hello{ "{\"t\":null,\"s\":null,\"op\":10,\"d\":{\"heartbeat_interval\":41250,\"_trace\":[\"[\\\"gateway-prd\\\"]\"]}}" };
+	websocket_message message{};
+	auto data = json_envelope_parser::parseJsonEnvelope(toView(hello), message);
+	check(message.op == 10, "op is read from a hello frame");
+	check(!message.s.has_value(), "a null s is left unset");
+	check(!message.t.has_value(), "a null t is left unset");
+	check(toString(data) == "{\"heartbeat_interval\":41250,\"_trace\":[\"[\\\"gateway-prd\\\"]\"]}", "d is read from a hello frame");
+
+	std::string heartbeatAck{ "{\"op\":11}" };
+	websocket_message ackMessage{};
+	auto ackData = json_envelope_parser::parseJsonEnvelope(toView(heartbeatAck), ackMessage);
+	check(ackMessage.op == 11, "op is read from a heartbeat ack");
+	check(toString(ackData) == "null", "a missing d reads as null");
+
+	std::string invalidSession{ "{\"t\":null,\"s\":null,\"op\":9,\"d\":false}" };
+	websocket_message sessionMessage{};
+	auto sessionData = json_envelope_parser::parseJsonEnvelope(toView(invalidSession), sessionMessage);
+	check(sessionMessage.op == 9 && toString(sessionData) == "false", "a scalar d is returned as-is");
+}
+
+void testMalformedFrames() {
+	for (std::string frame: { std::string{ "{\"op\":0,\"d\":{\"a\":\"unterminated}" }, std::string{ "[\"op\",0]" }, std::string{ "{\"op\" 0}" }, std::string{} }) {
+		bool threw{};
+		try {
+			websocket_message message{};
+			json_envelope_parser::parseJsonEnvelope(toView(frame), message);
+		} catch (const json_envelope_error&) {
+			threw = true;
+		}
+		check(threw, "a malformed frame throws json_envelope_error");
+	}
+}
+
+void testEtfEnvelope() {
+	etf_serializer data{};
+	data["id"]	 = "123456789";
+	data["name"] = "Guild";
+	etf_serializer frame{};
+	frame["t"]	= "GUILD_CREATE";
+	frame["s"]	= int64_t{ 42 };
+	frame["op"] = int64_t{ 0 };
+	frame["d"]	= data;
+	auto bytes	= frame.operator jsonifier::string_base<uint8_t>();
+	jsonifier::string_view_base<uint8_t> view{ bytes.data(), bytes.size() };
+	etf_parser parser{};
+	auto envelope = parser.parseEtfEnvelope(view);
+	check(envelope.op == 0, "etf op is read");
+	check(envelope.haveS && envelope.s == 42, "etf s is read");
+	check(envelope.haveT && envelope.t == "GUILD_CREATE", "etf t is read");
+	check(envelope.haveData, "etf d is located");
+	auto json = toString(parser.parseEtfDataToJson(view, envelope));
+	check(json.front() == '{' && json.back() == '}', "only the etf d term is transcoded");
+	check(json.find("\"name\":\"Guild\"") != std::string::npos && json.find("\"id\":\"123456789\"") != std::string::npos, "the etf d term keeps its fields");
+	check(json.find("GUILD_CREATE") == std::string::npos, "the etf envelope is not transcoded");
+}
+
+int32_t main() {
+	testGuildCreateFrame();
+	testKeyOrderAndWhitespace();
+	testNullsAndMissingFields();
+	testMalformedFrames();
+	testEtfEnvelope();
+	return test_state::getInstance().finish("EnvelopeParser");
+}
@@ -0,0 +1,277 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// EpochCache.cpp - Tests for the epoch_cache, its snapshots and the entity_cache.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file EpochCache.cpp
+
+#include "../Common/TestUtilities.hpp"
+
+using namespace discord_core_api;
+using namespace discord_core_test;
+
+/// @brief A small cached object, whose two values are only ever changed together.
+struct cached_object {
+	snowflake id{};
+	uint64_t value{};
+	uint64_t doubledValue{};
+};
+
+/// @brief Retires enough objects to push the epoch_domain through several reclamation passes.
+void forceReclamation() {
+	epoch_cache<cached_object> scratch{};
+	scratch.emplace(cached_object{ 1, 0, 0 });
+	for (uint64_t x = 0; x < discord_core_internal::epoch_domain::reclaimThreshold * 4; ++x) {
+		scratch.modify(snowflake{ 1 }, [](cached_object& value) {
+			++value.value;
+		});
+	}
+}
+
+void testSingleThreaded() {
+	epoch_cache<cached_object> cache{};
+	for (uint64_t x = 1; x <= 1000; ++x) {
+		cache.emplace(cached_object{ x, x, x * 2 });
+	}
+	check(cache.count() == 1000, "emplaced objects are counted, across several grows");
+	cache.emplace(cached_object{ 5, 50, 100 });
+	check(cache.count() == 1000 && cache.find(snowflake{ 5 })->value == 50, "emplace replaces an object with the same key");
+	check(cache.contains(snowflake{ 1000 }) && !cache.contains(snowflake{ 1001 }), "contains finds emplaced keys only");
+	check(!cache.find(snowflake{ 1001 }), "find returns an empty snapshot for a missing key");
+
+	check(cache.modify(snowflake{ 7 },
+			  [](cached_object& value) {
+				  value.value = 70;
+			  }) &&
+			cache.find(snowflake{ 7 })->value == 70,
+		"modify publishes a new version");
+	check(!cache.modify(snowflake{ 1001 },
+			  [](cached_object&) {
+			  }),
+		"modify reports a missing key");
+
+	uint64_t visited{};
+	check(cache.visit(snowflake{ 9 },
+			  [&](const cached_object& value) {
+				  visited = value.value;
+			  }) &&
+			visited == 9,
+		"visit reads an object in place");
+
+	cache.erase(snowflake{ 1 });
+	cache.erase(snowflake{ 1001 });
+	check(cache.count() == 999 && !cache.contains(snowflake{ 1 }), "erase removes only the object with that key");
+
+	uint64_t forEachCount{};
+	cache.forEach([&](const cached_object&) {
+		++forEachCount;
+	});
+	check(forEachCount == 999, "forEach visits every object");
+
+	epoch_cache<voice_state_data_light> voiceStates{};
+	voice_state_data_light voiceState{};
+	voiceState.guildId	 = 1;
+	voiceState.userId	 = 2;
+	voiceState.channelId = 3;
+	voiceStates.emplace(voiceState);
+	voiceState.userId	 = 4;
+	voiceState.channelId = 5;
+	voiceStates.emplace(voiceState);
+	voice_state_data_light key{};
+	key.guildId = 1;
+	key.userId	= 4;
+	auto snapshot = voiceStates.find(two_id_key{ key });
+	check(voiceStates.count() == 2 && snapshot && snapshot->channelId == snowflake{ 5 }, "two_id_key lookups find the object with both ids");
+	voiceStates.erase(two_id_key{ key });
+	check(voiceStates.count() == 1 && snapshot->channelId == snowflake{ 5 }, "a snapshot outlives the erase of its object");
+}
+
+void testSnapshotsOutliveWriters() {
+	epoch_cache<cached_object> cache{};
+	cache.emplace(cached_object{ 1, 1, 2 });
+	cache.emplace(cached_object{ 2, 2, 4 });
+	auto modified = cache.find(snowflake{ 1 });
+	auto erased	  = cache.find(snowflake{ 2 });
+	cache.modify(snowflake{ 1 }, [](cached_object& value) {
+		value.value		   = 10;
+		value.doubledValue = 20;
+	});
+	cache.erase(snowflake{ 2 });
+	for (uint64_t x = 3; x < 3000; ++x) {
+		cache.emplace(cached_object{ x, x, x * 2 });
+	}
+	forceReclamation();
+	check(modified->value == 1 && modified->doubledValue == 2, "a snapshot keeps the version it was taken at, after a modify and reclamation");
+	check(erased->value == 2 && erased->doubledValue == 4, "a snapshot keeps its object alive, after an erase and reclamation");
+	check(cache.find(snowflake{ 1 })->value == 10, "new readers see the modified version");
+}
+
+void testNestedSnapshots() {
+	epoch_cache<cached_object> cache{};
+	cache.emplace(cached_object{ 1, 1, 2 });
+	cache.emplace(cached_object{ 2, 2, 4 });
+	// The second snapshot is taken while the first still holds the slot this thread pinned last, and must claim a slot of its own.
+	auto first	= cache.find(snowflake{ 1 });
+	auto second = cache.find(snowflake{ 2 });
+	first		= {};
+	cache.erase(snowflake{ 2 });
+	for (uint64_t x = 3; x < 3000; ++x) {
+		cache.emplace(cached_object{ x, x, x * 2 });
+		cache.erase(snowflake{ x });
+	}
+	forceReclamation();
+	check(second->value == 2 && second->doubledValue == 4, "a snapshot keeps its pin after an earlier snapshot on the same thread is released");
+	for (uint64_t x = 0; x < 1000; ++x) {
+		first = cache.find(snowflake{ 1 });
+	}
+	check(first && first->value == 1, "repeated finds on one thread reuse their slot and still pin");
+}
+
+void testCrossThreadRelease() {
+	epoch_cache<cached_object> cache{};
+	for (uint64_t x = 1; x <= 1000; ++x) {
+		cache.emplace(cached_object{ x, x, x * 2 });
+	}
+	std::atomic_bool stop{};
+	std::atomic<uint64_t> tornReads{};
+	std::jthread writer{ [&] {
+		for (uint64_t x = 0; !stop.load(std::memory_order_relaxed); ++x) {
+			cache.modify(snowflake{ x % 1000 + 1 }, [](cached_object& value) {
+				++value.value;
+				value.doubledValue = value.value * 2;
+			});
+		}
+	} };
+	for (uint64_t round = 0; round < 200; ++round) {
+		std::vector<cache_snapshot<cached_object>> snapshots{};
+		for (uint64_t x = 0; x < 50; ++x) {
+			snapshots.emplace_back(cache.find(snowflake{ (round * 50 + x) % 1000 + 1 }));
+		}
+		// The snapshots are taken here and released on another thread, as they would be when a coroutine resumes elsewhere.
+		std::jthread releaser{ [&, snapshotsNew = std::move(snapshots)]() mutable {
+			for (auto& value: snapshotsNew) {
+				if (!value || value->doubledValue != value->value * 2) {
+					tornReads.fetch_add(1, std::memory_order_relaxed);
+				}
+			}
+			snapshotsNew.clear();
+		} };
+	}
+	stop.store(true, std::memory_order_relaxed);
+	writer.join();
+	check(tornReads.load() == 0, "snapshots released on another thread stay valid while a writer churns");
+}
+
+void testConcurrentReadersAndWriters(uint64_t threadCount) {
+	constexpr uint64_t keyCount{ 2000 };
+	epoch_cache<cached_object> cache{};
+	for (uint64_t x = 1; x <= keyCount; ++x) {
+		cache.emplace(cached_object{ x, x, x * 2 });
+	}
+	std::atomic<uint64_t> tornReads{};
+	std::atomic<uint64_t> missedReads{};
+	runOnThreads(threadCount, [&](uint64_t index) {
+		if (index % 4 == 0) {
+			// Writers update the shared keys, and grow the table with keys of their own, which they then erase.
+			uint64_t base{ keyCount + 1 + index * keyCount };
+			for (uint64_t x = 0; x < keyCount; ++x) {
+				cache.modify(snowflake{ x + 1 }, [](cached_object& value) {
+					++value.value;
+					value.doubledValue = value.value * 2;
+				});
+				cache.emplace(cached_object{ base + x, base + x, (base + x) * 2 });
+			}
+			for (uint64_t x = 0; x < keyCount; ++x) {
+				cache.erase(snowflake{ base + x });
+			}
+		} else {
+			for (uint64_t round = 0; round < 4; ++round) {
+				for (uint64_t x = 1; x <= keyCount; ++x) {
+					bool found = cache.visit(snowflake{ x }, [&](const cached_object& value) {
+						if (value.doubledValue != value.value * 2) {
+							tornReads.fetch_add(1, std::memory_order_relaxed);
+						}
+					});
+					auto snapshot = cache.find(snowflake{ (x * 7) % keyCount + 1 });
+					if (!found || !snapshot) {
+						missedReads.fetch_add(1, std::memory_order_relaxed);
+					} else if (snapshot->doubledValue != snapshot->value * 2) {
+						tornReads.fetch_add(1, std::memory_order_relaxed);
+					}
+				}
+			}
+		}
+	});
+	uint64_t writerCount{ (threadCount + 3) / 4 };
+	bool allUpdated{ true };
+	for (uint64_t x = 1; x <= keyCount; ++x) {
+		allUpdated = allUpdated && cache.find(snowflake{ x })->value == x + writerCount;
+	}
+	check(tornReads.load() == 0, "readers never observe a half-applied modify, with " + std::to_string(threadCount) + " threads");
+	check(missedReads.load() == 0, "readers always find existing keys while the table grows, with " + std::to_string(threadCount) + " threads");
+	check(allUpdated && cache.count() == keyCount, "every modify, emplace and erase is applied exactly once, with " + std::to_string(threadCount) + " threads");
+}
+
+void testEntityCache(bool snapshotReads) {
+	std::string mode{ snapshotReads ? "with snapshot reads" : "without snapshot reads" };
+	entity_cache<cached_object> cache{};
+	cache.setSnapshotReads(snapshotReads);
+	for (uint64_t x = 1; x <= 100; ++x) {
+		cache.emplace(cached_object{ x, x, x * 2 });
+	}
+	cache.modify(snowflake{ 3 }, [](cached_object& value) {
+		value.value = 30;
+	});
+	cache.erase(snowflake{ 4 });
+	auto snapshot = cache.find(snowflake{ 3 });
+	uint64_t visited{};
+	cache.visit(snowflake{ 5 }, [&](const cached_object& value) {
+		visited = value.value;
+	});
+	uint64_t forEachCount{};
+	cache.forEach([&](const cached_object&) {
+		++forEachCount;
+	});
+	check(snapshot && snapshot->value == 30 && visited == 5, "entity_cache reads its objects, " + mode);
+	check(cache.count() == 99 && forEachCount == 99 && !cache.contains(snowflake{ 4 }), "entity_cache erases its objects, " + mode);
+	cache.modify(snowflake{ 3 }, [](cached_object& value) {
+		value.value = 300;
+	});
+	check(snapshot->value == 30, "an entity_cache snapshot is unaffected by later writes, " + mode);
+}
+
+int32_t main() {
+	testSingleThreaded();
+	testSnapshotsOutliveWriters();
+	testNestedSnapshots();
+	testCrossThreadRelease();
+	for (uint64_t threadCount: { 1ull, 8ull, 32ull }) {
+		testConcurrentReadersAndWriters(threadCount);
+	}
+	testEntityCache(true);
+	testEntityCache(false);
+	return test_state::getInstance().finish("EpochCache");
+}
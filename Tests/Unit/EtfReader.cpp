@@ -0,0 +1,189 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// EtfReader.cpp - Tests for reading etf gateway payloads straight into their structures.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file EtfReader.cpp
+
+#include "../Common/TestUtilities.hpp"
+#include "../Common/Payloads.hpp"
+
+using namespace discord_core_api;
+using namespace discord_core_api::discord_core_internal;
+using namespace discord_core_test;
+
+struct etf_test_item {
+	snowflake id{};
+	jsonifier::string name{};
+	bool flag{};
+};
+
+struct etf_test_payload {
+	snowflake id{};
+	jsonifier::string name{};
+	int32_t count{};
+	double ratio{};
+	channel_type type{};
+	jsonifier::vector<etf_test_item> items{};
+	jsonifier::vector<snowflake> ids{};
+	std::optional<int32_t> present{};
+	std::optional<int32_t> absent{ 5 };
+	unique_ptr<etf_test_item> pointer{};
+	jsonifier::raw_json_data extra{};
+};
+
+namespace jsonifier {
+
+	template<> struct core<etf_test_item> {
+		using value_type				 = etf_test_item;
+		static constexpr auto parseValue = createValue("id", &value_type::id, "name", &value_type::name, "flag", &value_type::flag);
+	};
+
+	template<> struct core<etf_test_payload> {
+		using value_type				 = etf_test_payload;
+		static constexpr auto parseValue = createValue("id", &value_type::id, "name", &value_type::name, "count", &value_type::count, "ratio", &value_type::ratio, "type",
+			&value_type::type, "items", &value_type::items, "ids", &value_type::ids, "present", &value_type::present, "absent", &value_type::absent, "pointer",
+			&value_type::pointer, "extra", &value_type::extra);
+	};
+
+}
+
+/// @brief Collects the "d" term of an etf frame, in the form the websocket client hands it to the event handlers.
+jsonifier::string_view_base<uint8_t> collectDataTerm(etf_parser& parser, const std::string& frame) {
+	auto view	  = toView(frame);
+	auto envelope = parser.parseEtfEnvelope(view);
+	return parser.parseEtfDataTerm(view, envelope);
+}
+
+void testMetadataIsRecognised() {
+	check(etf_object_t<etf_test_item> && etf_object_t<etf_test_payload>, "the member layout of jsonifier::core is recognised for the test structures");
+	check(etf_object_t<guild_data> && etf_object_t<guild_member_data> && etf_object_t<ready_data>, "the member layout of jsonifier::core is recognised for the event structures");
+	check(!etf_object_t<jsonifier::raw_json_data> && !etf_object_t<jsonifier::string>, "types without core metadata are not read as objects");
+}
+
+void testMembers() {
+	std::string payload{ "{\"id\":\"12345678901234567\",\"name\":\"guild \\\"one\\\"\",\"unknown\":{\"nested\":[1,2,{\"a\":null}]},\"count\":-70000,\"ratio\":2.5,\"type\":"
+						 "13,\"items\":[{\"id\":\"1\",\"name\":\"first\",\"flag\":true},{\"id\":99,\"name\":\"second\",\"flag\":false}],\"ids\":[\"7\",70000000000],"
+						 "\"present\":11,\"absent\":null,\"pointer\":{\"id\":\"3\",\"name\":\"pointed\",\"flag\":true},\"extra\":{\"key\":\"value\"}}" };
+	auto etf = json_to_etf_encoder::encode(payload);
+	jsonifier::jsonifier_core<false> parser{};
+	etf_test_payload value{};
+	parseGatewayData(parser, value, toView(etf));
+	check(value.id.id == 12345678901234567ull && value.name == "guild \"one\"", "snowflakes and strings are read from binaries");
+	check(value.count == -70000 && value.ratio == 2.5, "integers and floats are read");
+	check(value.type == channel_type::Guild_Stage_Voice, "enums are read from integers");
+	check(value.items.size() == 2 && value.items[0].name == "first" && value.items[0].flag && value.items[1].name == "second" && !value.items[1].flag,
+		"lists of objects are read");
+	check(value.items[1].id.id == 99 && value.ids.size() == 2 && value.ids[0].id == 7 && value.ids[1].id == 70000000000ull,
+		"snowflakes are read from integers as well as binaries");
+	check(value.present.has_value() && value.present.value() == 11, "optionals are filled from a value");
+	check(!value.absent.has_value(), "optionals are reset by nil");
+	check(value.pointer && value.pointer->id.id == 3 && value.pointer->name == "pointed", "unique_ptrs are allocated and read");
+	check(value.extra.getType() == jsonifier::json_type::Object && value.extra.get<jsonifier::raw_json_data::object_type>()["key"].get<jsonifier::string>() == "value",
+		"a type without a native path is parsed through json");
+}
+
+void testMatchesJson() {
+	auto etf = generateGuildCreateEtfFrame(25, 5, 5);
+	etf_parser etfParserNew{};
+	auto view	  = toView(etf);
+	auto envelope = etfParserNew.parseEtfEnvelope(view);
+	jsonifier::jsonifier_core<false> parser{};
+	guild_data viaJson{};
+	parser.parseJson<jsonifier::parse_options{ .partialRead = true }>(viaJson, etfParserNew.parseEtfDataToJson(view, envelope));
+	check(parser.getErrors().size() == 0, "the etf GUILD_CREATE payload transcodes to valid json");
+	guild_data direct{};
+	parseGatewayData(parser, direct, etfParserNew.parseEtfDataTerm(view, envelope));
+	check(direct.id == viaJson.id && direct.name == viaJson.name && direct.ownerId == viaJson.ownerId && direct.memberCount == viaJson.memberCount,
+		"the guild's fields match those parsed through json");
+	check(direct.members.size() == 25 && direct.members.size() == viaJson.members.size(), "every member is read");
+	bool membersMatch{ direct.members.size() == viaJson.members.size() };
+	for (uint64_t x = 0; x < direct.members.size() && membersMatch; ++x) {
+		membersMatch = direct.members[x].user.id == viaJson.members[x].user.id && direct.members[x].nick == viaJson.members[x].nick &&
+			direct.members[x].roles.size() == viaJson.members[x].roles.size() && static_cast<uint64_t>(direct.members[x].joinedAt) == static_cast<uint64_t>(viaJson.members[x].joinedAt);
+		for (uint64_t y = 0; y < direct.members[x].roles.size() && membersMatch; ++y) {
+			membersMatch = direct.members[x].roles[y] == viaJson.members[x].roles[y];
+		}
+	}
+	check(membersMatch, "the members match those parsed through json");
+	bool channelsAndRolesMatch{ direct.channels.size() == 5 && direct.roles.size() == 5 };
+	for (uint64_t x = 0; x < direct.channels.size() && x < direct.roles.size() && channelsAndRolesMatch; ++x) {
+		channelsAndRolesMatch = direct.channels[x].id == viaJson.channels[x].id && direct.channels[x].name == viaJson.channels[x].name &&
+			direct.roles[x].id == viaJson.roles[x].id && direct.roles[x].name == viaJson.roles[x].name && direct.roles[x].position == viaJson.roles[x].position;
+	}
+	check(channelsAndRolesMatch, "the channels and roles match those parsed through json");
+}
+
+void testNilAndMissingData() {
+	etf_parser etfParserNew{};
+	jsonifier::jsonifier_core<false> parser{};
+	bool resumable{ true };
+	parseGatewayData(parser, resumable, collectDataTerm(etfParserNew, json_to_etf_encoder::encode("{\"op\":9,\"d\":false,\"s\":null,\"t\":null}")));
+	check(!resumable, "a scalar d term is read");
+	bool untouched{ true };
+	parseGatewayData(parser, untouched, collectDataTerm(etfParserNew, json_to_etf_encoder::encode("{\"op\":11}")));
+	check(untouched, "a missing d term reads as nil, and leaves the value alone");
+	etf_test_payload value{};
+	value.name = "kept";
+	parseGatewayData(parser, value, collectDataTerm(etfParserNew, json_to_etf_encoder::encode("{\"op\":0,\"d\":null}")));
+	check(value.name == "kept", "a nil d term leaves an object alone");
+}
+
+void testJsonAndTruncatedData() {
+	jsonifier::jsonifier_core<false> parser{};
+	std::string json{ "{\"id\":\"5\",\"name\":\"json\",\"items\":[{\"id\":\"6\"}]}" };
+	etf_test_payload value{};
+	parseGatewayData(parser, value, toView(json));
+	check(value.id.id == 5 && value.name == "json" && value.items.size() == 1, "json payloads are still parsed by jsonifier");
+
+	auto etf = json_to_etf_encoder::encode("{\"id\":\"5\",\"name\":\"a longer name than the cut\",\"items\":[{\"id\":\"6\"},{\"id\":\"7\"}]}");
+	bool threw{};
+	try {
+		etf_reader reader{};
+		etf_test_payload truncated{};
+		reader.parseEtf(parser, truncated, toView(std::string_view{ etf }.substr(0, etf.size() / 2)));
+	} catch (const etf_parse_error&) {
+		threw = true;
+	}
+	check(threw, "truncated etf throws etf_parse_error from etf_reader");
+	bool propagated{};
+	try {
+		etf_test_payload truncated{};
+		parseGatewayData(parser, truncated, toView(std::string_view{ etf }.substr(0, etf.size() / 2)));
+	} catch (...) {
+		propagated = true;
+	}
+	check(!propagated, "truncated etf is reported rather than propagated by parseGatewayData");
+}
+
+int32_t main() {
+	testMetadataIsRecognised();
+	testMembers();
+	testMatchesJson();
+	testNilAndMissingData();
+	testJsonAndTruncatedData();
+	return test_state::getInstance().finish("EtfReader");
+}
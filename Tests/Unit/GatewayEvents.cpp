@@ -0,0 +1,89 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// GatewayEvents.cpp - Tests for the dispatch event perfect hash.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file GatewayEvents.cpp
+
+#include "../Common/TestUtilities.hpp"
+
+using namespace discord_core_api;
+using namespace discord_core_api::discord_core_internal;
+using namespace discord_core_test;
+
+void testEveryNameMapsToItsEnumerator() {
+	bool allMatched{ true };
+	for (uint64_t x = 1; x < gatewayEventNames.size(); ++x) {
+		// Copy the name, so that the lookup compares characters rather than relying on the table's storage.
+		std::string name{ gatewayEventNames[x].data(), gatewayEventNames[x].size() };
+		gateway_event_type value = event_converter{ jsonifier::string_view{ name.data(), name.size() } };
+		if (value != static_cast<gateway_event_type>(x)) {
+			allMatched = false;
+			std::cerr << "\"" << name << "\" mapped to " << static_cast<uint64_t>(value) << ", rather than " << x << std::endl;
+		}
+	}
+	check(allMatched, "every dispatch event name maps to its own enumerator");
+	check(gatewayEventNames.size() == static_cast<uint64_t>(gateway_event_type::Webhooks_Update) + 1, "gatewayEventNames covers every enumerator");
+}
+
+void testNamedEnumerators() {
+	check(static_cast<gateway_event_type>(event_converter{ "READY" }) == gateway_event_type::Ready, "READY maps to Ready");
+	check(static_cast<gateway_event_type>(event_converter{ "RESUMED" }) == gateway_event_type::Resumed, "RESUMED maps to Resumed");
+	check(static_cast<gateway_event_type>(event_converter{ "GUILD_CREATE" }) == gateway_event_type::Guild_Create, "GUILD_CREATE maps to Guild_Create");
+	check(static_cast<gateway_event_type>(event_converter{ "MESSAGE_CREATE" }) == gateway_event_type::Message_Create, "MESSAGE_CREATE maps to Message_Create");
+	check(static_cast<gateway_event_type>(event_converter{ "WEBHOOKS_UPDATE" }) == gateway_event_type::Webhooks_Update, "WEBHOOKS_UPDATE maps to Webhooks_Update");
+}
+
+void testUnknownNames() {
+	bool allUnknown{ true };
+	for (jsonifier::string_view name: { "", "ready", "READY ", " READY", "READ", "READYY", "GUILD_", "GUILD_CREATED", "MESSAGE_POLL_VOTE_ADD", "ENTITLEMENT_CREATE",
+			 "GUILD_AUDIT_LOG_ENTRY_CREATE", "VOICE_CHANNEL_EFFECT_SEND" }) {
+		if (static_cast<gateway_event_type>(event_converter{ name }) != gateway_event_type::Unknown) {
+			allUnknown = false;
+			std::cerr << "\"" << name << "\" did not map to Unknown" << std::endl;
+		}
+	}
+	check(allUnknown, "unrecognized names map to Unknown");
+
+	// Every single-character change to a known name must also be rejected, since the table holds one name per slot.
+	bool allMutationsUnknown{ true };
+	for (uint64_t x = 1; x < gatewayEventNames.size(); ++x) {
+		for (uint64_t y = 0; y < gatewayEventNames[x].size(); ++y) {
+			std::string name{ gatewayEventNames[x].data(), gatewayEventNames[x].size() };
+			name[y] = name[y] == 'A' ? 'B' : 'A';
+			gateway_event_type value = event_converter{ jsonifier::string_view{ name.data(), name.size() } };
+			allMutationsUnknown = allMutationsUnknown && (value == gateway_event_type::Unknown || gatewayEventNames[static_cast<uint64_t>(value)] == jsonifier::string_view{ name.data(), name.size() });
+		}
+	}
+	check(allMutationsUnknown, "single-character changes to known names never map to a different event");
+}
+
+int32_t main() {
+	testEveryNameMapsToItsEnumerator();
+	testNamedEnumerators();
+	testUnknownNames();
+	return test_state::getInstance().finish("GatewayEvents");
+}
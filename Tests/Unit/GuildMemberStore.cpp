@@ -0,0 +1,233 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// GuildMemberStore.cpp - Tests for the columnar guild_member_store.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file GuildMemberStore.cpp
+
+#include "../Common/TestUtilities.hpp"
+#include <random>
+#include <map>
+
+using namespace discord_core_api;
+using namespace discord_core_test;
+
+/// @brief Builds a guild_member whose fields are all derived from its ids and a revision number.
+guild_member_cache_data makeMember(uint64_t guildId, uint64_t userId, uint64_t roleCount, uint64_t nickLength, uint64_t revision = 0) {
+	guild_member_cache_data returnValue{};
+	returnValue.guildId		   = guildId;
+	returnValue.user.id		   = userId;
+	returnValue.permissionsVal = uint64_t{ userId * 31 + revision };
+	returnValue.joinedAt	   = uint64_t{ 1600000000000 + userId + revision };
+	returnValue.flags		   = static_cast<guild_member_flags>((userId + revision) % 8);
+	if ((userId + revision) % 3 != 0) {
+		jsonifier::string avatar{ "a_0123456789abcdef0123456789abcde" };
+		avatar += static_cast<char>('0' + revision % 10);
+		returnValue.avatar = avatar;
+	}
+	for (uint64_t x = 0; x < roleCount; ++x) {
+		returnValue.roles.emplace_back(guildId * 1000 + x + revision);
+	}
+	for (uint64_t x = 0; x < nickLength; ++x) {
+		returnValue.nick += static_cast<char>('a' + (userId + x + revision) % 26);
+	}
+	return returnValue;
+}
+
+bool membersMatch(const guild_member_cache_data& lhs, const guild_member_cache_data& rhs) {
+	return lhs.guildId == rhs.guildId && lhs.user.id == rhs.user.id && std::equal(lhs.roles.begin(), lhs.roles.end(), rhs.roles.begin(), rhs.roles.end()) && lhs.nick == rhs.nick &&
+		static_cast<uint64_t>(lhs.permissionsVal) == static_cast<uint64_t>(rhs.permissionsVal) && static_cast<uint64_t>(lhs.joinedAt) == static_cast<uint64_t>(rhs.joinedAt) &&
+		lhs.flags == rhs.flags && lhs.avatar == rhs.avatar;
+}
+
+two_id_key makeKey(uint64_t guildId, uint64_t userId) {
+	guild_member_cache_data key{};
+	key.guildId = guildId;
+	key.user.id = userId;
+	return two_id_key{ key };
+}
+
+bool findMatches(guild_member_store& store, const guild_member_cache_data& expected) {
+	guild_member_cache_data found{};
+	return store.find(makeKey(expected.guildId.operator const uint64_t&(), expected.user.id.operator const uint64_t&()), found) && membersMatch(found, expected);
+}
+
+void testRoundTrip() {
+	guild_member_store store{};
+	std::vector<guild_member_cache_data> members{};
+	for (uint64_t guildId = 1; guildId <= 3; ++guildId) {
+		for (uint64_t userId = 1; userId <= 100; ++userId) {
+			members.emplace_back(makeMember(guildId, userId, userId % 6, userId % 40));
+			store.emplace(members.back());
+		}
+	}
+	bool allMatched{ true };
+	for (auto& value: members) {
+		allMatched = allMatched && findMatches(store, value);
+	}
+	check(allMatched, "every field of every member round-trips through the store");
+	check(store.count() == 300, "members are counted across guilds");
+	guild_member_cache_data found{};
+	check(!store.find(makeKey(1, 101), found) && !store.find(makeKey(4, 1), found), "find reports a missing member or guild");
+	check(store.contains(makeKey(2, 50)) && !store.contains(makeKey(2, 101)), "contains finds stored members only");
+}
+
+void testReplace() {
+	guild_member_store store{};
+	store.emplace(makeMember(1, 1, 2, 5));
+	store.emplace(makeMember(1, 2, 2, 5));
+	auto grown = makeMember(1, 1, 8, 30, 1);
+	store.emplace(grown);
+	check(findMatches(store, grown) && store.count() == 2, "a member can be replaced with more roles and a longer nick");
+	auto shrunk = makeMember(1, 1, 0, 0, 2);
+	store.emplace(shrunk);
+	check(findMatches(store, shrunk), "a member can be replaced with no roles and no nick");
+	check(findMatches(store, makeMember(1, 2, 2, 5)), "replacing a member leaves its neighbours intact");
+}
+
+void testErase() {
+	guild_member_store store{};
+	for (uint64_t userId = 1; userId <= 10; ++userId) {
+		store.emplace(makeMember(1, userId, userId % 4, userId));
+	}
+	// Erasing a middle row moves the last row into its place.
+	store.erase(makeKey(1, 3));
+	store.erase(makeKey(1, 3));
+	store.erase(makeKey(2, 3));
+	bool allMatched{ true };
+	for (uint64_t userId = 1; userId <= 10; ++userId) {
+		allMatched = allMatched && (userId == 3 ? !store.contains(makeKey(1, userId)) : findMatches(store, makeMember(1, userId, userId % 4, userId)));
+	}
+	check(allMatched && store.count() == 9, "erase removes one row, and the row moved into its place stays intact");
+	for (uint64_t userId = 1; userId <= 10; ++userId) {
+		store.erase(makeKey(1, userId));
+	}
+	check(store.count() == 0 && !store.contains(makeKey(1, 10)), "erasing every member empties the guild");
+	store.emplace(makeMember(1, 5, 3, 3));
+	check(findMatches(store, makeMember(1, 5, 3, 3)), "a guild can be refilled after it is emptied");
+}
+
+void testAgainstReference() {
+	guild_member_store store{};
+	std::map<std::pair<uint64_t, uint64_t>, guild_member_cache_data> reference{};
+	std::mt19937_64 randomEngine{ 8 };
+	uint64_t mismatches{};
+	auto verifyAll = [&] {
+		for (auto& [key, value]: reference) {
+			mismatches += findMatches(store, value) ? 0 : 1;
+		}
+	};
+	for (uint64_t x = 0; x < 200000; ++x) {
+		uint64_t guildId{ randomEngine() % 4 + 1 };
+		uint64_t userId{ randomEngine() % 500 + 1 };
+		uint64_t operation{ randomEngine() % 10 };
+		if (operation < 6) {
+			// Roles and nicks that change size on every revision leave stale entries behind in the pools, which forces compaction.
+			auto member = makeMember(guildId, userId, randomEngine() % 10, randomEngine() % 40, x);
+			store.emplace(member);
+			reference[{ guildId, userId }] = member;
+		} else if (operation < 8) {
+			store.erase(makeKey(guildId, userId));
+			reference.erase({ guildId, userId });
+		} else if (auto iter = reference.find({ guildId, userId }); iter != reference.end()) {
+			mismatches += findMatches(store, iter->second) ? 0 : 1;
+		} else {
+			mismatches += store.contains(makeKey(guildId, userId)) ? 1 : 0;
+		}
+		if (x % 20000 == 0) {
+			verifyAll();
+		}
+	}
+	verifyAll();
+	check(mismatches == 0, "the store agrees with a reference map through random emplaces, replaces and erases");
+	check(store.count() == reference.size(), "the store's count agrees with the reference map");
+
+	// Once churn stops, compaction keeps the pools within a small multiple of the live data.
+	uint64_t liveBytes{};
+	for (auto& [key, value]: reference) {
+		liveBytes += value.roles.size() * sizeof(snowflake) + value.nick.size();
+	}
+	check(store.getMemoryUsage() < liveBytes * 4 + reference.size() * 128 + 65536, "stale pool entries are compacted away");
+}
+
+void testConcurrentGuilds(uint64_t threadCount) {
+	constexpr uint64_t membersPerThread{ 2000 };
+	guild_member_store store{};
+	std::atomic<uint64_t> mismatches{};
+	runOnThreads(threadCount, [&](uint64_t index) {
+		// Each thread owns a guild of its own, and shares guild 1 with every other thread.
+		for (uint64_t x = 1; x <= membersPerThread; ++x) {
+			store.emplace(makeMember(index + 2, x, x % 5, x % 20));
+			store.emplace(makeMember(1, index * membersPerThread + x, x % 5, x % 20));
+		}
+		for (uint64_t x = 1; x <= membersPerThread; ++x) {
+			if (!findMatches(store, makeMember(index + 2, x, x % 5, x % 20)) || !findMatches(store, makeMember(1, index * membersPerThread + x, x % 5, x % 20))) {
+				mismatches.fetch_add(1, std::memory_order_relaxed);
+			}
+			if (x % 2 == 0) {
+				store.erase(makeKey(1, index * membersPerThread + x));
+			}
+		}
+	});
+	check(mismatches.load() == 0, "concurrent writers never see each other's rows corrupted, with " + std::to_string(threadCount) + " threads");
+	check(store.count() == threadCount * membersPerThread * 3 / 2, "concurrent emplaces and erases leave the expected count, with " + std::to_string(threadCount) + " threads");
+}
+
+/// @brief Exposes the guild_members cache settings, so that both layouts can be exercised without a config_manager.
+struct test_guild_members : public guild_members {
+	static void setLayout(bool columnar) {
+		doWeCacheGuildMembersBool = true;
+		doWeUseColumnarStoreBool  = columnar;
+	}
+};
+
+void testCacheStats(bool columnar) {
+	std::string name{ columnar ? "columnar" : "object" };
+	test_guild_members::setLayout(columnar);
+	auto emptyUsage = guild_members::getCacheMemoryUsage();
+	for (uint64_t userId = 1; userId <= 200; ++userId) {
+		guild_members::insertGuildMember(makeMember(1, userId, 4, 24));
+	}
+	check(guild_members::getCachedGuildMemberCount() == 200, name + ": guild_members reports the number of cached members");
+	check(guild_members::getCacheMemoryUsage() > emptyUsage + 200 * 4 * sizeof(snowflake), name + ": guild_members reports the memory held by its cache");
+	for (uint64_t userId = 1; userId <= 200; ++userId) {
+		guild_members::removeGuildMember(makeKey(1, userId));
+	}
+	check(guild_members::getCachedGuildMemberCount() == 0, name + ": removed members are no longer counted");
+}
+
+int32_t main() {
+	testRoundTrip();
+	testReplace();
+	testErase();
+	testAgainstReference();
+	for (uint64_t threadCount: { 1ull, 8ull, 32ull }) {
+		testConcurrentGuilds(threadCount);
+	}
+	testCacheStats(false);
+	testCacheStats(true);
+	return test_state::getInstance().finish("GuildMemberStore");
+}
@@ -0,0 +1,219 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// HttpsResponseParser.cpp - Tests for the incremental https response parser, fed responses in random slices.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file HttpsResponseParser.cpp
+
+#include "../Common/TestUtilities.hpp"
+#include "../Common/Payloads.hpp"
+#include <random>
+
+using namespace discord_core_api;
+using namespace discord_core_api::discord_core_internal;
+using namespace discord_core_test;
+
+/// @brief An https_connection which is handed its response directly, rather than reading it from a socket.
+class replay_connection : public https_connection {
+  public:
+	/// @brief Hands the connection the next slice of its response, as a read from its socket would.
+	void receive(std::string_view slice) {
+		inputBuffer.writeData(slice.data(), slice.size());
+		handleBuffer();
+	}
+};
+
+struct expected_response {
+	std::vector<std::pair<std::string, std::string>> headers{};///< Lower-cased names, with their trimmed values.
+	uint32_t responseCode{};
+	std::string body{};
+	std::string wire{};
+	std::string name{};
+};
+
+/// @brief A body which holds the byte sequences that delimit the parts of a response.
+std::string generateBody(uint64_t size) {
+	static constexpr std::string_view pattern{ "{\"content\":\"\\r\\n\\r\\n0\\r\\n\\r\\n\",\"raw\":\"\r\n\r\n0\r\n\r\n\"}" };
+	std::string returnValue{};
+	while (returnValue.size() < size) {
+		returnValue += pattern;
+	}
+	returnValue.resize(size);
+	return returnValue;
+}
+
+std::vector<expected_response> generateResponses() {
+	std::vector<expected_response> returnValue{};
+	std::string rateLimitHeaders{ "X-RateLimit-Bucket:   abcd1234  \r\nx-ratelimit-remaining:4\r\nX-RATELIMIT-RESET-AFTER: \t1.5\r\n" };
+	std::vector<std::pair<std::string, std::string>> rateLimitValues{ { "x-ratelimit-bucket", "abcd1234" }, { "x-ratelimit-remaining", "4" },
+		{ "x-ratelimit-reset-after", "1.5" } };
+	auto addResponse = [&](std::string name, uint32_t responseCode, std::string body, std::string wire) {
+		returnValue.emplace_back(expected_response{ rateLimitValues, responseCode, std::move(body), std::move(wire), std::move(name) });
+	};
+	for (uint64_t bodySize: { 0ull, 1ull, 300ull, 256ull * 1024ull }) {
+		auto body = generateBody(bodySize);
+		addResponse("content-length, " + std::to_string(bodySize) + " bytes", 200, body, generateHttpResponse("HTTP/1.1 200 OK", rateLimitHeaders, body));
+		addResponse("chunked in small chunks, " + std::to_string(bodySize) + " bytes", 200, body,
+			generateChunkedHttpResponse("HTTP/1.1 200 OK", rateLimitHeaders, body, { 1, 7, 16, 3, 64 }));
+		addResponse("chunked in large chunks, " + std::to_string(bodySize) + " bytes", 200, body,
+			generateChunkedHttpResponse("HTTP/1.1 200 OK", rateLimitHeaders, body, { 32768, 4095, 65536 }));
+	}
+	addResponse("no content", 204, "", "HTTP/1.1 204 No Content\r\n" + rateLimitHeaders + "\r\n");
+	auto errorBody = std::string{ "{\"message\":\"You are being rate limited.\",\"retry_after\":0.5,\"global\":false}" };
+	addResponse("too many requests", 429, errorBody, generateHttpResponse("HTTP/1.1 429 Too Many Requests", rateLimitHeaders, errorBody));
+	return returnValue;
+}
+
+/// @brief Checks the response a connection has parsed against the one which was sent.
+bool matchesResponse(replay_connection& connection, const expected_response& expected) {
+	auto& data = connection.data;
+	if (data.currentState != https_state::complete || static_cast<uint32_t>(data.responseCode) != expected.responseCode ||
+		std::string_view{ data.responseData.data(), data.responseData.size() } != expected.body) {
+		return false;
+	}
+	for (auto& [key, value]: expected.headers) {
+		if (!data.responseHeaders.contains(key)) {
+			return false;
+		}
+		auto valueNew = data.responseHeaders.at(key);
+		if (std::string_view{ valueNew.data(), valueNew.size() } != value) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/// @brief Hands a response to a connection in slices, as successive reads.
+/// @return `false` if the connection completed the response before its last slice.
+bool replayInSlices(replay_connection& connection, std::string_view wire, const std::vector<uint64_t>& sliceSizes) {
+	connection.data = https_response_data{};
+	bool completedEarly{};
+	for (uint64_t sliceSize: sliceSizes) {
+		completedEarly = completedEarly || connection.data.currentState == https_state::complete;
+		connection.receive(wire.substr(0, sliceSize));
+		wire.remove_prefix(sliceSize);
+	}
+	return !completedEarly;
+}
+
+std::vector<uint64_t> generateSliceSizes(uint64_t totalSize, std::mt19937_64& randomEngine, uint64_t maxSliceSize) {
+	std::vector<uint64_t> returnValue{};
+	std::uniform_int_distribution<uint64_t> distribution{ 1, maxSliceSize };
+	while (totalSize > 0) {
+		returnValue.emplace_back(std::min(distribution(randomEngine), totalSize));
+		totalSize -= returnValue.back();
+	}
+	return returnValue;
+}
+
+void testWholeResponses(const std::vector<expected_response>& responses) {
+	for (auto& value: responses) {
+		replay_connection connection{};
+		replayInSlices(connection, value.wire, { value.wire.size() });
+		check(matchesResponse(connection, value), "a whole response parses: " + value.name);
+	}
+}
+
+void testRandomSlices(const std::vector<expected_response>& responses) {
+	std::mt19937_64 randomEngine{ 17 };
+	for (uint64_t maxSliceSize: { 1ull, 7ull, 100ull, 16384ull }) {
+		for (auto& value: responses) {
+			if (maxSliceSize == 1 && value.wire.size() > 64 * 1024) {
+				continue;
+			}
+			uint64_t mismatches{};
+			uint64_t earlyCompletions{};
+			for (uint64_t x = 0; x < 8; ++x) {
+				replay_connection connection{};
+				earlyCompletions += !replayInSlices(connection, value.wire, generateSliceSizes(value.wire.size(), randomEngine, maxSliceSize));
+				mismatches += !matchesResponse(connection, value);
+			}
+			auto name = value.name + ", slices of up to " + std::to_string(maxSliceSize) + " bytes";
+			check(mismatches == 0, "a response parses from random slices: " + name);
+			check(earlyCompletions == 0, "a response completes only on its last slice: " + name);
+		}
+	}
+}
+
+/// @brief Splits each of the smaller responses in two at every offset, so that each of its delimiters is split at each of its bytes.
+void testEverySplit(const std::vector<expected_response>& responses) {
+	for (auto& value: responses) {
+		if (value.wire.size() > 4096) {
+			continue;
+		}
+		uint64_t mismatches{};
+		for (uint64_t x = 1; x < value.wire.size(); ++x) {
+			replay_connection connection{};
+			mismatches += !replayInSlices(connection, value.wire, { x, value.wire.size() - x }) || !matchesResponse(connection, value);
+		}
+		check(mismatches == 0, "a response parses when split in two at any offset: " + value.name);
+	}
+}
+
+/// @brief Parses responses back to back on one connection, as a keep-alive connection does.
+void testKeepAlive(const std::vector<expected_response>& responses) {
+	std::mt19937_64 randomEngine{ 23 };
+	replay_connection connection{};
+	uint64_t mismatches{};
+	for (uint64_t x = 0; x < 4; ++x) {
+		for (auto& value: responses) {
+			replayInSlices(connection, value.wire, generateSliceSizes(value.wire.size(), randomEngine, 4096));
+			mismatches += !matchesResponse(connection, value);
+		}
+	}
+	check(mismatches == 0, "responses parse back to back on one connection");
+}
+
+/// @brief Checks that a serialized request ends exactly where its body does, so that a keep-alive server finds the next request straight after it.
+void testRequestFraming() {
+	replay_connection connection{};
+	https_workload_data workload{ https_workload_type::Post_Message };
+	workload.workloadClass = https_workload_class::Post;
+	workload.baseUrl	   = "https://discord.com/api/v10";
+	workload.relativePath  = "/channels/1/messages";
+	workload.content	   = "{\"content\":\"\r\n\r\n\"}";
+	auto request		   = connection.buildRequest(workload);
+	std::string_view requestView{ request.data(), request.size() };
+	auto headerEnd = requestView.find("\r\n\r\n");
+	check(headerEnd != std::string_view::npos && requestView.substr(headerEnd + 4) == std::string_view{ workload.content.data(), workload.content.size() },
+		"a request with a body ends with its body, straight after the headers");
+	check(requestView.find("Content-Length: " + std::to_string(workload.content.size()) + "\r\n") < headerEnd, "a request with a body carries its Content-Length");
+	workload.workloadClass = https_workload_class::Get;
+	workload.content	   = "";
+	request				   = connection.buildRequest(workload);
+	requestView			   = std::string_view{ request.data(), request.size() };
+	check(requestView.find("\r\n\r\n") == requestView.size() - 4, "a request without a body ends with its headers");
+}
+
+int32_t main() {
+	testRequestFraming();
+	auto responses = generateResponses();
+	testWholeResponses(responses);
+	testRandomSlices(responses);
+	testEverySplit(responses);
+	testKeepAlive(responses);
+	return test_state::getInstance().finish("HttpsResponseParser");
+}
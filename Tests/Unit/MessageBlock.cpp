@@ -0,0 +1,260 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// MessageBlock.cpp - Tests for the spsc_message_block, the mpsc_message_block and the collector_message_block.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file MessageBlock.cpp
+
+#include "../Common/TestUtilities.hpp"
+
+using namespace discord_core_api;
+using namespace discord_core_api::discord_core_internal;
+using namespace discord_core_test;
+
+template<typename message_block_type> void testSingleThreaded(std::string_view name) {
+	message_block_type block{};
+	uint64_t value{};
+	check(!block.tryReceive(value), std::string{ name } + ": a new message block is empty");
+	bool allSent{ true };
+	for (uint64_t x = 0; x < 8; ++x) {
+		allSent = block.send(x) && allSent;
+	}
+	check(allSent, std::string{ name } + ": the message block takes objects up to its capacity");
+	check(!block.send(uint64_t{ 8 }), std::string{ name } + ": a full message block refuses an object");
+	bool allInOrder{ true };
+	for (uint64_t x = 0; x < 8; ++x) {
+		allInOrder = block.tryReceive(value) && value == x && allInOrder;
+	}
+	check(allInOrder, std::string{ name } + ": objects are received in the order they were sent");
+	check(!block.tryReceive(value), std::string{ name } + ": a drained message block is empty");
+	// Send and receive in uneven batches, so that the positions wrap around the ring many times over.
+	uint64_t nextSent{};
+	uint64_t nextReceived{};
+	allInOrder = true;
+	for (uint64_t x = 0; x < 1000; ++x) {
+		for (uint64_t y = 0; y < x % 7 + 1; ++y) {
+			allInOrder = block.send(nextSent++) && allInOrder;
+		}
+		while (block.tryReceive(value)) {
+			allInOrder = value == nextReceived++ && allInOrder;
+		}
+	}
+	check(allInOrder && nextReceived == nextSent, std::string{ name } + ": objects stay in order as the ring wraps around");
+	block.send(uint64_t{ 1 });
+	block.send(uint64_t{ 2 });
+	block.clearContents();
+	check(!block.tryReceive(value), std::string{ name } + ": clearContents discards every waiting object");
+	check(block.send(uint64_t{ 3 }) && block.tryReceive(value) && value == 3, std::string{ name } + ": a cleared message block is still usable");
+}
+
+template<typename message_block_type> void testMoveOnly(std::string_view name) {
+	message_block_type block{};
+	bool allSent{ true };
+	for (uint64_t x = 0; x < 4; ++x) {
+		allSent = block.send(makeUnique<uint64_t>(x)) && allSent;
+	}
+	unique_ptr<uint64_t> value{};
+	bool allReceived{ allSent };
+	for (uint64_t x = 0; x < 4; ++x) {
+		allReceived = block.tryReceive(value) && value && *value == x && allReceived;
+	}
+	check(allReceived, std::string{ name } + ": move-only objects are moved through the message block");
+}
+
+void testSpscStress() {
+	constexpr uint64_t valueCount{ 1000000 };
+	spsc_message_block<uint64_t, 1024> block{};
+	bool allInOrder{ true };
+	uint64_t receivedCount{};
+	runOnThreads(2, [&](uint64_t index) {
+		if (index == 0) {
+			for (uint64_t x = 0; x < valueCount; ++x) {
+				while (!block.send(x)) {
+					std::this_thread::yield();
+				}
+			}
+		} else {
+			uint64_t value{};
+			for (uint64_t x = 0; x < valueCount; ++x) {
+				if (!block.receive(value, milliseconds{ 5000 })) {
+					allInOrder = false;
+					break;
+				}
+				allInOrder = value == x && allInOrder;
+				++receivedCount;
+			}
+		}
+	});
+	check(receivedCount == valueCount, "spsc: every value sent is received");
+	check(allInOrder, "spsc: values are received in the order they were sent");
+}
+
+void testMpscStress(uint64_t producerCount) {
+	constexpr uint64_t valuesPerProducer{ 100000 };
+	mpsc_message_block<uint64_t, 256> block{};
+	std::vector<uint64_t> nextSequences(producerCount);
+	bool allInOrder{ true };
+	uint64_t receivedCount{};
+	runOnThreads(producerCount + 1, [&](uint64_t index) {
+		if (index < producerCount) {
+			// Each value carries the producer that sent it in its upper half, and that producer's sequence number in its lower half.
+			for (uint64_t x = 0; x < valuesPerProducer; ++x) {
+				while (!block.send((index << 32) | x)) {
+					std::this_thread::yield();
+				}
+			}
+		} else {
+			uint64_t value{};
+			for (uint64_t x = 0; x < producerCount * valuesPerProducer; ++x) {
+				if (!block.receive(value, milliseconds{ 5000 })) {
+					allInOrder = false;
+					break;
+				}
+				uint64_t producer = value >> 32;
+				uint64_t sequence = value & 0xffffffffull;
+				allInOrder		  = producer < producerCount && sequence == nextSequences[producer]++ && allInOrder;
+				++receivedCount;
+			}
+		}
+	});
+	uint64_t dummy{};
+	check(receivedCount == producerCount * valuesPerProducer && !block.tryReceive(dummy),
+		"mpsc: every value is received exactly once, with " + std::to_string(producerCount) + " producers");
+	check(allInOrder, "mpsc: each producer's values are received in the order it sent them, with " + std::to_string(producerCount) + " producers");
+}
+
+void testCollectorOverflow() {
+	collector_message_block<uint64_t, 8> block{};
+	for (uint64_t x = 0; x < 8; ++x) {
+		block.send(x);
+	}
+	check(!block.hasOverflowed(), "collector: objects up to the capacity stay in the bounded block");
+	for (uint64_t x = 8; x < 1000; ++x) {
+		block.send(x);
+	}
+	check(block.hasOverflowed(), "collector: objects past the capacity go to the unbounded block");
+	uint64_t value{};
+	bool allInOrder{ true };
+	for (uint64_t x = 0; x < 1000; ++x) {
+		allInOrder = block.tryReceive(value) && value == x && allInOrder;
+	}
+	check(allInOrder && !block.tryReceive(value), "collector: no object is dropped on overflow, and all arrive in the order they were sent");
+	block.send(uint64_t{ 1000 });
+	check(block.tryReceive(value) && value == 1000, "collector: an overflowed block keeps taking objects");
+}
+
+void testCollectorStress(uint64_t producerCount) {
+	constexpr uint64_t valuesPerProducer{ 20000 };
+	collector_message_block<uint64_t, 32> block{};
+	std::vector<uint64_t> nextSequences(producerCount);
+	bool allInOrder{ true };
+	uint64_t receivedCount{};
+	runOnThreads(producerCount + 1, [&](uint64_t index) {
+		if (index < producerCount) {
+			// Nothing waits for room here, so the bounded block overflows almost at once.
+			for (uint64_t x = 0; x < valuesPerProducer; ++x) {
+				block.send((index << 32) | x);
+			}
+		} else {
+			uint64_t value{};
+			for (uint64_t x = 0; x < producerCount * valuesPerProducer; ++x) {
+				if (!block.receive(value, milliseconds{ 5000 })) {
+					allInOrder = false;
+					break;
+				}
+				uint64_t producer = value >> 32;
+				uint64_t sequence = value & 0xffffffffull;
+				allInOrder		  = producer < producerCount && sequence == nextSequences[producer]++ && allInOrder;
+				++receivedCount;
+			}
+		}
+	});
+	uint64_t dummy{};
+	check(receivedCount == producerCount * valuesPerProducer && !block.tryReceive(dummy),
+		"collector: every value is received exactly once, with " + std::to_string(producerCount) + " producers");
+	check(allInOrder, "collector: each producer's values are received in the order it sent them, with " + std::to_string(producerCount) + " producers");
+}
+
+template<typename message_block_type> void testTimedReceive(std::string_view name) {
+	message_block_type block{};
+	uint64_t value{};
+	auto startTime = hrclock::now();
+	bool received  = block.receive(value, milliseconds{ 50 });
+	auto waitTime  = hrclock::now() - startTime;
+	check(!received && waitTime >= milliseconds{ 50 } && waitTime < milliseconds{ 1000 }, std::string{ name } + ": a receive on an empty message block times out");
+	startTime = hrclock::now();
+	check(waitForTimeToPass(block, value, 20), std::string{ name } + ": waitForTimeToPass reports a timeout on an empty message block");
+	check(hrclock::now() - startTime >= milliseconds{ 20 }, std::string{ name } + ": waitForTimeToPass waits out its timeout");
+	std::jthread sender{ [&] {
+		std::this_thread::sleep_for(milliseconds{ 20 });
+		block.send(uint64_t{ 42 });
+	} };
+	startTime = hrclock::now();
+	received  = block.receive(value, milliseconds{ 5000 });
+	waitTime  = hrclock::now() - startTime;
+	check(received && value == 42, std::string{ name } + ": a parked receive gets an object sent after it parked");
+	check(waitTime < milliseconds{ 1000 }, std::string{ name } + ": a parked receive is woken by the send, rather than its timeout");
+}
+
+template<typename message_block_type> void testPingPong(std::string_view name) {
+	constexpr uint64_t roundTrips{ 10000 };
+	message_block_type requests{};
+	message_block_type responses{};
+	bool allAnswered{ true };
+	runOnThreads(2, [&](uint64_t index) {
+		uint64_t value{};
+		for (uint64_t x = 0; x < roundTrips; ++x) {
+			if (index == 0) {
+				requests.send(x);
+				allAnswered = responses.receive(value, milliseconds{ 5000 }) && value == x && allAnswered;
+			} else if (requests.receive(value, milliseconds{ 5000 })) {
+				responses.send(value);
+			}
+		}
+	});
+	check(allAnswered, std::string{ name } + ": every round trip completes, with both sides parking in between");
+}
+
+int32_t main() {
+	testSingleThreaded<spsc_message_block<uint64_t, 8>>("spsc");
+	testSingleThreaded<mpsc_message_block<uint64_t, 8>>("mpsc");
+	testMoveOnly<spsc_message_block<unique_ptr<uint64_t>, 4>>("spsc");
+	testMoveOnly<mpsc_message_block<unique_ptr<uint64_t>, 4>>("mpsc");
+	testSpscStress();
+	for (uint64_t producerCount: { 1ull, 3ull, 7ull, 31ull }) {
+		testMpscStress(producerCount);
+	}
+	testCollectorOverflow();
+	for (uint64_t producerCount: { 1ull, 4ull }) {
+		testCollectorStress(producerCount);
+	}
+	testTimedReceive<spsc_message_block<uint64_t, 8>>("spsc");
+	testTimedReceive<mpsc_message_block<uint64_t, 8>>("mpsc");
+	testTimedReceive<collector_message_block<uint64_t, 8>>("collector");
+	testPingPong<spsc_message_block<uint64_t, 8>>("spsc");
+	testPingPong<mpsc_message_block<uint64_t, 8>>("mpsc");
+	return test_state::getInstance().finish("MessageBlock");
+}
@@ -0,0 +1,220 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// ObjectCache.cpp - Tests for the sharded object_cache.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file ObjectCache.cpp
+
+#include "../Common/TestUtilities.hpp"
+
+using namespace discord_core_api;
+using namespace discord_core_test;
+
+/// @brief A small cached object, whose two values are only ever changed together.
+struct cached_object {
+	snowflake id{};
+	uint64_t value{};
+	uint64_t doubledValue{};
+};
+
+void testSingleThreaded() {
+	object_cache<cached_object> cache{};
+	for (uint64_t x = 1; x <= 1000; ++x) {
+		cache.emplace(cached_object{ x, x, x * 2 });
+	}
+	check(cache.count() == 1000, "emplaced objects are counted");
+	check(cache.contains(snowflake{ 500 }) && !cache.contains(snowflake{ 1001 }), "contains finds emplaced keys only");
+
+	uint64_t visited{};
+	check(cache.visit(snowflake{ 7 },
+			  [&](const cached_object& value) {
+				  visited = value.value;
+			  }) &&
+			visited == 7,
+		"visit reads an object in place");
+	check(!cache.visit(snowflake{ 1001 },
+			  [&](const cached_object&) {
+			  }),
+		"visit reports a missing key");
+	check(cache.modify(snowflake{ 7 },
+			  [](cached_object& value) {
+				  value.value = 70;
+			  }) &&
+			cache[snowflake{ 7 }].value == 70,
+		"modify changes an object in place");
+
+	check(cache[snowflake{ 2000 }].id == snowflake{ 2000 } && cache.count() == 1001, "operator[] inserts a missing snowflake key, with its id set");
+	cache.erase(snowflake{ 2000 });
+	cache.erase(snowflake{ 1 });
+	check(cache.count() == 999 && !cache.contains(snowflake{ 1 }), "erase removes objects");
+
+	uint64_t iterated{};
+	for (auto& value: cache) {
+		iterated += value->id == snowflake{ value->value } || value->id == snowflake{ 7 } ? 1 : 0;
+	}
+	check(iterated == 999, "iteration walks every shard");
+
+	object_cache<voice_state_data_light> voiceStates{};
+	voice_state_data_light voiceState{};
+	voiceState.guildId	 = 1;
+	voiceState.userId	 = 2;
+	voiceState.channelId = 3;
+	voiceStates.emplace(voiceState);
+	voiceState.userId = 4;
+	voiceState.channelId = 5;
+	voiceStates.emplace(voiceState);
+	voice_state_data_light key{};
+	key.guildId = 1;
+	key.userId	= 4;
+	snowflake channelId{};
+	voiceStates.visit(two_id_key{ key }, [&](const voice_state_data_light& value) {
+		channelId = value.channelId;
+	});
+	check(voiceStates.count() == 2 && channelId == snowflake{ 5 }, "two_id_key lookups find the object with both ids");
+	key.userId	   = 6;
+	auto& inserted = voiceStates[two_id_key{ key }];
+	check(inserted.guildId == snowflake{ 1 } && inserted.userId == snowflake{ 6 } && voiceStates.count() == 3 && voiceStates.contains(two_id_key{ key }),
+		"operator[] inserts a missing two_id_key, with both of its ids set");
+}
+
+void testIteratorEquality() {
+	object_cache<cached_object, 1> cache{};
+	for (uint64_t x = 1; x <= 3; ++x) {
+		cache.emplace(cached_object{ x, x, x * 2 });
+	}
+	auto first	= cache.begin();
+	auto second = cache.begin();
+	++second;
+	check(first == cache.begin() && !(first == second), "iterators within one shard compare equal only at the same object");
+	uint64_t distance{};
+	for (auto iter = cache.begin(); !(iter == cache.end()); ++iter) {
+		++distance;
+	}
+	check(distance == 3, "an iterator reaches end after every object of a single shard");
+}
+
+void testConcurrentOwnedKeys(uint64_t threadCount) {
+	constexpr uint64_t keysPerThread{ 2000 };
+	object_cache<cached_object> cache{};
+	std::atomic<uint64_t> tornReads{};
+	runOnThreads(threadCount, [&](uint64_t index) {
+		uint64_t base{ index * keysPerThread + 1 };
+		for (uint64_t x = 0; x < keysPerThread; ++x) {
+			cache.emplace(cached_object{ base + x, base + x, (base + x) * 2 });
+		}
+		for (uint64_t round = 0; round < 4; ++round) {
+			for (uint64_t x = 0; x < keysPerThread; ++x) {
+				cache.modify(snowflake{ base + x }, [](cached_object& value) {
+					++value.value;
+					value.doubledValue = value.value * 2;
+				});
+				// Read a neighbour's key too, so that readers and writers share shards.
+				cache.visit(snowflake{ (base + x + keysPerThread) % (threadCount * keysPerThread) + 1 }, [&](const cached_object& value) {
+					if (value.doubledValue != value.value * 2) {
+						tornReads.fetch_add(1, std::memory_order_relaxed);
+					}
+				});
+			}
+		}
+		for (uint64_t x = 0; x < keysPerThread; x += 2) {
+			cache.erase(snowflake{ base + x });
+		}
+	});
+	check(tornReads.load() == 0, "visit never observes a half-applied modify, with " + std::to_string(threadCount) + " threads");
+	check(cache.count() == threadCount * keysPerThread / 2, "concurrent emplace and erase leave the expected count, with " + std::to_string(threadCount) + " threads");
+	bool allUpdated{ true };
+	for (uint64_t x = 2; x <= threadCount * keysPerThread; x += 2) {
+		allUpdated = allUpdated && cache.visit(snowflake{ x }, [&](const cached_object& value) {
+			allUpdated = allUpdated && value.value == x + 4;
+		});
+	}
+	check(allUpdated, "every modify is applied exactly once, with " + std::to_string(threadCount) + " threads");
+}
+
+void testConcurrentSharedKeys(uint64_t threadCount) {
+	constexpr uint64_t sharedKeyCount{ 64 };
+	constexpr uint64_t incrementsPerThread{ 20000 };
+	object_cache<cached_object> cache{};
+	runOnThreads(threadCount, [&](uint64_t index) {
+		for (uint64_t x = 0; x < incrementsPerThread; ++x) {
+			snowflake key{ (x + index) % sharedKeyCount + 1 };
+			// Every thread races to create the same keys through operator[], then increments them.
+			cache[key];
+			cache.modify(key, [](cached_object& value) {
+				++value.value;
+			});
+		}
+	});
+	uint64_t total{};
+	for (auto& value: cache) {
+		total += value->value;
+	}
+	check(cache.count() == sharedKeyCount, "racing operator[] calls insert each key once, with " + std::to_string(threadCount) + " threads");
+	check(total == threadCount * incrementsPerThread, "no increment is lost on shared keys, with " + std::to_string(threadCount) + " threads");
+}
+
+void testConcurrentVoiceStates(uint64_t threadCount) {
+	constexpr uint64_t usersPerThread{ 1000 };
+	constexpr uint64_t guildCount{ 4 };
+	object_cache<voice_state_data_light> cache{};
+	std::atomic<uint64_t> missedReads{};
+	runOnThreads(threadCount, [&](uint64_t index) {
+		voice_state_data_light value{};
+		for (uint64_t x = 0; x < usersPerThread; ++x) {
+			value.guildId	= x % guildCount + 1;
+			value.userId	= index * usersPerThread + x + 1;
+			value.channelId = value.userId;
+			cache.emplace(value);
+		}
+		for (uint64_t x = 0; x < usersPerThread; ++x) {
+			value.guildId = x % guildCount + 1;
+			value.userId  = index * usersPerThread + x + 1;
+			if (!cache.visit(two_id_key{ value }, [&](const voice_state_data_light& cached) {
+					if (cached.channelId != value.userId) {
+						missedReads.fetch_add(1, std::memory_order_relaxed);
+					}
+				})) {
+				missedReads.fetch_add(1, std::memory_order_relaxed);
+			}
+			if (x % 4 == 0) {
+				cache.erase(two_id_key{ value });
+			}
+		}
+	});
+	check(missedReads.load() == 0, "two_id_key lookups find every voice state, with " + std::to_string(threadCount) + " threads");
+	check(cache.count() == threadCount * usersPerThread * 3 / 4, "two_id_key erases remove only their own voice states, with " + std::to_string(threadCount) + " threads");
+}
+
+int32_t main() {
+	testSingleThreaded();
+	testIteratorEquality();
+	for (uint64_t threadCount: { 1ull, 8ull, 32ull }) {
+		testConcurrentOwnedKeys(threadCount);
+		testConcurrentSharedKeys(threadCount);
+		testConcurrentVoiceStates(threadCount);
+	}
+	return test_state::getInstance().finish("ObjectCache");
+}
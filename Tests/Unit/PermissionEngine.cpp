@@ -0,0 +1,142 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// PermissionEngine.cpp - Tests for the incremental updates of the permission_engine.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file PermissionEngine.cpp
+
+#include "../Common/TestUtilities.hpp"
+
+using namespace discord_core_api;
+using namespace discord_core_test;
+
+constexpr uint64_t viewChannel{ static_cast<uint64_t>(permission::View_Channel) };
+constexpr uint64_t sendMessages{ static_cast<uint64_t>(permission::Send_Messages) };
+constexpr uint64_t manageMessages{ static_cast<uint64_t>(permission::Manage_Messages) };
+constexpr uint64_t administrator{ static_cast<uint64_t>(permission::administrator) };
+
+role_data makeRole(uint64_t roleId, uint64_t permissionsNew) {
+	role_data returnValue{};
+	returnValue.id			= roleId;
+	returnValue.permissions = permissionsNew;
+	return returnValue;
+}
+
+over_write_data makeOverwrite(uint64_t id, permission_overwrites_type type, uint64_t allow, uint64_t deny) {
+	over_write_data returnValue{};
+	returnValue.type  = type;
+	returnValue.allow = allow;
+	returnValue.deny  = deny;
+	returnValue.id	  = id;
+	return returnValue;
+}
+
+channel_data makeChannel(uint64_t guildId, uint64_t channelId, jsonifier::vector<over_write_data> overwrites) {
+	channel_data returnValue{};
+	returnValue.permissionOverwrites = std::move(overwrites);
+	returnValue.guildId				 = guildId;
+	returnValue.id					 = channelId;
+	return returnValue;
+}
+
+/// @brief Seeds a guild with an @everyone role that can view channels, a role that can send messages, and a channel that hides itself from @everyone
+/// but shows itself to the second role.
+void seedTestGuild(uint64_t guildId) {
+	permission_engine::seedGuild(guildId, 1, { makeRole(guildId, viewChannel), makeRole(200, sendMessages) },
+		{ makeChannel(guildId, 500,
+			{ makeOverwrite(guildId, permission_overwrites_type::role_data, 0, viewChannel), makeOverwrite(200, permission_overwrites_type::role_data, viewChannel, 0) }) });
+	permission_engine::updateMember(guildId, 1, {});
+	permission_engine::updateMember(guildId, 2, { snowflake{ 200 } });
+	permission_engine::updateMember(guildId, 3, {});
+}
+
+void testSeed() {
+	seedTestGuild(100);
+	check(permission_engine::computeBasePermissions(100, 2) == (viewChannel | sendMessages), "a member's base permissions combine @everyone and their roles");
+	check(permission_engine::computeBasePermissions(100, 3) == viewChannel, "a member without roles gets the @everyone permissions");
+	check(permission_engine::computeBasePermissions(100, 1) == permission_engine::allPermissions, "the owner gets every permission");
+	check(permission_engine::computePermissions(100, 3, 500) == 0, "an @everyone overwrite applies within its channel");
+	check(permission_engine::computePermissions(100, 2, 500) == (viewChannel | sendMessages), "a role overwrite applies over the @everyone overwrite");
+	permission_engine::removeGuild(100);
+}
+
+void testRoleUpdates() {
+	seedTestGuild(101);
+	permission_engine::updateRole(101, 200, sendMessages | manageMessages);
+	check(permission_engine::computeBasePermissions(101, 2) == (viewChannel | sendMessages | manageMessages), "a role update refreshes the members who hold it");
+	check(permission_engine::computeBasePermissions(101, 3) == viewChannel, "a role update leaves other members alone");
+	permission_engine::updateRole(101, 101, viewChannel | sendMessages);
+	check(permission_engine::computeBasePermissions(101, 3) == (viewChannel | sendMessages), "an @everyone update refreshes every member");
+	permission_engine::updateRole(101, 200, administrator);
+	check(permission_engine::computePermissions(101, 2, 500) == permission_engine::allPermissions, "a role gaining administrator bypasses channel overwrites");
+	permission_engine::removeRole(101, 200);
+	check(permission_engine::computeBasePermissions(101, 2) == (viewChannel | sendMessages), "a removed role no longer contributes to its former members");
+	permission_engine::removeGuild(101);
+}
+
+void testOverwriteUpdates() {
+	seedTestGuild(102);
+	permission_engine::updateChannel(makeChannel(102, 500, { makeOverwrite(3, permission_overwrites_type::user_data, viewChannel | manageMessages, 0) }));
+	check(permission_engine::computePermissions(102, 3, 500) == (viewChannel | manageMessages), "a channel update replaces its overwrites, including member overwrites");
+	check(permission_engine::computePermissions(102, 2, 500) == (viewChannel | sendMessages), "a channel update drops overwrites it no longer has");
+	permission_engine::updateChannel(makeChannel(102, 501, { makeOverwrite(102, permission_overwrites_type::role_data, 0, viewChannel | sendMessages) }));
+	check(permission_engine::computePermissions(102, 2, 501) == 0, "a new channel's overwrites are tracked");
+	check(permission_engine::computePermissions(102, 2, 500) == (viewChannel | sendMessages), "a new channel leaves the other channels alone");
+	permission_engine::removeGuild(102);
+}
+
+void testMemberUpdates() {
+	seedTestGuild(103);
+	permission_engine::updateMember(103, 3, { snowflake{ 200 } });
+	check(permission_engine::computeBasePermissions(103, 3) == (viewChannel | sendMessages), "a member update applies the member's new roles");
+	check(permission_engine::computePermissions(103, 3, 500) == (viewChannel | sendMessages), "a member update applies the role overwrites of the member's new roles");
+	permission_engine::updateMember(103, 2, {});
+	check(permission_engine::computePermissions(103, 2, 500) == 0, "a member losing a role loses its overwrites too");
+	permission_engine::updateGuildOwner(103, 2);
+	check(permission_engine::computeBasePermissions(103, 2) == permission_engine::allPermissions, "a new owner gets every permission");
+	check(permission_engine::computeBasePermissions(103, 1) == viewChannel, "the previous owner loses their owner permissions");
+	permission_engine::removeGuild(103);
+}
+
+void testReseed() {
+	seedTestGuild(104);
+	permission_engine::updateRole(104, 200, manageMessages);
+	permission_engine::seedGuild(104, 1, { makeRole(104, 0), makeRole(200, sendMessages) },
+		{ makeChannel(104, 500, { makeOverwrite(200, permission_overwrites_type::role_data, 0, sendMessages) }) });
+	check(permission_engine::computeBasePermissions(104, 2) == sendMessages, "a GUILD_CREATE replaces the role table and refreshes tracked members");
+	check(permission_engine::computeBasePermissions(104, 3) == 0, "a GUILD_CREATE keeps tracking members without roles");
+	check(permission_engine::computePermissions(104, 2, 500) == 0, "a GUILD_CREATE replaces the channel overwrites");
+	permission_engine::removeGuild(104);
+}
+
+int32_t main() {
+	testSeed();
+	testRoleUpdates();
+	testOverwriteUpdates();
+	testMemberUpdates();
+	testReseed();
+	return test_state::getInstance().finish("PermissionEngine");
+}
@@ -0,0 +1,117 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// RingBuffer.cpp - Tests for the contiguous_ring_buffer.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file RingBuffer.cpp
+
+#include "../Common/TestUtilities.hpp"
+
+using namespace discord_core_api;
+using namespace discord_core_api::discord_core_internal;
+using namespace discord_core_test;
+
+struct test_ring_buffer : public contiguous_ring_buffer<char> {
+	using contiguous_ring_buffer<char>::capacity;
+};
+
+std::string makePattern(uint64_t size, uint64_t seed) {
+	std::string returnValue(size, '\0');
+	for (uint64_t x = 0; x < size; ++x) {
+		returnValue[x] = static_cast<char>('a' + (x + seed) % 26);
+	}
+	return returnValue;
+}
+
+void testGrowth() {
+	test_ring_buffer buffer{};
+	std::string data{ makePattern(test_ring_buffer::initialCapacity * 3, 0) };
+	buffer.writeData(data.data(), data.size());
+	check(buffer.capacity >= data.size(), "a write larger than the buffer grows it");
+	check(std::string_view{ buffer.readData() } == data, "a grown buffer keeps the written values");
+}
+
+void testShrink() {
+	test_ring_buffer buffer{};
+	std::string data{ makePattern(test_ring_buffer::initialCapacity * 3, 0) };
+	buffer.writeData(data.data(), data.size());
+	buffer.readData();
+	auto grownCapacity = buffer.capacity;
+	std::string small{ makePattern(512, 7) };
+	bool allRead{ true };
+	for (uint64_t x = 0; x < test_ring_buffer::shrinkDelay - 1; ++x) {
+		buffer.writeData(small.data(), small.size());
+		allRead = std::string_view{ buffer.readData() } == small && allRead;
+	}
+	check(buffer.capacity == grownCapacity, "a grown buffer doesn't shrink before it has stayed drained for shrinkDelay writes");
+	buffer.writeData(small.data(), small.size());
+	allRead = std::string_view{ buffer.readData() } == small && allRead;
+	check(buffer.capacity == test_ring_buffer::initialCapacity, "a grown buffer shrinks back to its initial capacity once it has stayed drained");
+	check(allRead, "writes across the shrink keep their values");
+}
+
+void testShrinkKeepsUnread() {
+	test_ring_buffer buffer{};
+	std::string data{ makePattern(test_ring_buffer::initialCapacity * 3, 0) };
+	buffer.writeData(data.data(), data.size());
+	buffer.readData();
+	std::string unread{ makePattern(1024, 3) };
+	buffer.writeData(unread.data(), unread.size());
+	std::string small{ makePattern(16, 5) };
+	for (uint64_t x = 0; x < test_ring_buffer::shrinkDelay; ++x) {
+		buffer.writeData(small.data(), small.size());
+		unread += small;
+	}
+	check(buffer.capacity == test_ring_buffer::initialCapacity, "a grown buffer holding a few unread values still shrinks");
+	check(std::string_view{ buffer.readData() } == unread, "a shrink carries the unread values over");
+}
+
+void testBusyBufferStaysGrown() {
+	test_ring_buffer buffer{};
+	std::string data{ makePattern(test_ring_buffer::initialCapacity * 3, 0) };
+	buffer.writeData(data.data(), data.size());
+	buffer.readData();
+	auto grownCapacity = buffer.capacity;
+	std::string large{ makePattern(test_ring_buffer::shrinkThreshold + 1, 1) };
+	std::string small{ makePattern(512, 2) };
+	for (uint64_t x = 0; x < test_ring_buffer::shrinkDelay * 4; ++x) {
+		if (x % (test_ring_buffer::shrinkDelay / 2) == 0) {
+			buffer.writeData(large.data(), large.size());
+		} else {
+			buffer.writeData(small.data(), small.size());
+		}
+		buffer.readData();
+	}
+	check(buffer.capacity == grownCapacity, "a grown buffer which keeps seeing large writes stays grown");
+}
+
+int32_t main() {
+	testGrowth();
+	testShrink();
+	testShrinkKeepsUnread();
+	testBusyBufferStaysGrown();
+	return test_state::getInstance().finish("RingBuffer");
+}
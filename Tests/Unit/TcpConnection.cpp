@@ -0,0 +1,180 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// TcpConnection.cpp - Tests for the non-blocking connect and handshake of tcp_connection, against local peers which never answer.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file TcpConnection.cpp
+
+#include "../Common/LocalServer.hpp"
+
+#if defined(__linux__)
+	#include <dlfcn.h>
+#endif
+
+using namespace discord_core_api;
+using namespace discord_core_api::discord_core_internal;
+using namespace discord_core_test;
+
+static constexpr milliseconds stageTimeout{ 300 };
+static constexpr milliseconds timeoutSlack{ 2000 };
+
+#if defined(__linux__)
+/// @brief Whether connect() should complete before returning, as it can over loopback, rather than leave a non-blocking connect in progress.
+inline std::atomic_bool forceImmediateConnect{};
+
+// this interposes libc's connect, for the library's calls too. it is declared under a name of its own, so that it doesn't collide with the
+// declaration in the system headers.
+extern "C" int immediateConnect(int fd, const sockaddr* address, socklen_t addressLength) __asm__("connect");
+extern "C" int immediateConnect(int fd, const sockaddr* address, socklen_t addressLength) {
+	static auto nextDefinition = reinterpret_cast<int (*)(int, const sockaddr*, socklen_t)>(dlsym(RTLD_NEXT, "connect"));
+	if (!forceImmediateConnect.load(std::memory_order_acquire)) {
+		return nextDefinition(fd, address, addressLength);
+	}
+	auto flags = fcntl(fd, F_GETFL, 0);
+	fcntl(fd, F_SETFL, flags & ~O_NONBLOCK);
+	auto returnValue = nextDefinition(fd, address, addressLength);
+	fcntl(fd, F_SETFL, flags);
+	return returnValue;
+}
+#endif
+
+/// @brief Checks that a connection to a peer which accepts but never speaks tls is abandoned once the handshake timeout passes.
+void testHandshakeTimeout() {
+	blackhole_listener listener{};
+	auto startTime = hrclock::now();
+	https_connection connection{ "127.0.0.1", listener.getPort() };
+	auto constructionTime = hrclock::now() - startTime;
+	check(connection.currentStatus == connection_status::NO_Error, "a connection to the blackhole listener starts connecting");
+	check(constructionTime < milliseconds{ 100 }, "constructing a connection does not wait on its handshake");
+	bool isConnected = connection.finishConnecting();
+	auto elapsedTime = hrclock::now() - startTime;
+	check(!isConnected && connection.currentStatus == connection_status::CONNECTION_Error, "the connection to the blackhole listener fails");
+	check(connection.connectState == connect_state::Handshaking && listener.getConnectionCount() == 1, "the connection fails handshaking, having connected");
+	check(elapsedTime >= stageTimeout && elapsedTime < stageTimeout + timeoutSlack, "the handshake is abandoned once its timeout passes");
+}
+
+/// @brief Checks that polling a connection whose handshake never completes returns straight away, as a shard's io thread does between its other
+/// connections, until the handshake timeout passes.
+void testPollingDoesNotBlock() {
+	blackhole_listener listener{};
+	auto startTime = hrclock::now();
+	https_connection connection{ "127.0.0.1", listener.getPort() };
+	hrclock::duration longestPoll{};
+	uint64_t pollCount{};
+	while (connection.currentStatus == connection_status::NO_Error && hrclock::now() - startTime < stageTimeout + timeoutSlack) {
+		auto pollTime = hrclock::now();
+		connection.processIO(0);
+		longestPoll = std::max(longestPoll, hrclock::now() - pollTime);
+		++pollCount;
+		std::this_thread::sleep_for(milliseconds{ 1 });
+	}
+	auto elapsedTime = hrclock::now() - startTime;
+	check(connection.currentStatus == connection_status::CONNECTION_Error, "a polled connection to the blackhole listener fails");
+	check(elapsedTime >= stageTimeout && elapsedTime < stageTimeout + timeoutSlack, "a polled handshake is abandoned once its timeout passes");
+	check(pollCount > 1 && longestPoll < milliseconds{ 50 }, "each poll of a stalled handshake returns straight away");
+}
+
+#if defined(__linux__)
+/// @brief Checks that a connection whose syn is never answered is abandoned once the connect timeout passes.
+void testConnectTimeout() {
+	unresponsive_listener listener{};
+	auto startTime = hrclock::now();
+	https_connection connection{ "127.0.0.1", listener.getPort() };
+	check(connection.currentStatus == connection_status::NO_Error && connection.connectState == connect_state::Connecting,
+		"a connection to the unresponsive listener starts connecting");
+	bool isConnected = connection.finishConnecting();
+	auto elapsedTime = hrclock::now() - startTime;
+	check(!isConnected && connection.currentStatus == connection_status::CONNECTION_Error, "the connection to the unresponsive listener fails");
+	check(connection.connectState == connect_state::Connecting, "the connection fails connecting");
+	check(elapsedTime >= stageTimeout && elapsedTime < stageTimeout + timeoutSlack, "the connect is abandoned once its timeout passes");
+}
+#endif
+
+/// @brief Checks that a connection to a peer which does speak tls connects, and that a request written while it was still connecting is sent once
+/// its handshake completes.
+void testQueuedWriteIsFlushed() {
+	static constexpr std::string_view responseBody{ "{\"url\":\"wss://gateway.discord.gg\"}" };
+	local_tls_server server{ [](SSL* ssl) {
+		std::string buffer{};
+		std::string request{};
+		if (readHttpRequest(ssl, buffer, request)) {
+			writeAll(ssl, generateHttpResponse("HTTP/1.1 200 OK", "", responseBody));
+		}
+	} };
+	https_connection connection{ "127.0.0.1", server.getPort() };
+	https_workload_data workload{ https_workload_type::Get_Gateway_Bot };
+	workload.workloadClass = https_workload_class::Get;
+	workload.relativePath  = "/gateway/bot";
+	workload.baseUrl	   = "https://127.0.0.1";
+	connection.writeData(connection.buildRequest(workload), true);
+	check(connection.connectState != connect_state::Connected && connection.hasPendingWrites(), "a request written while connecting is queued");
+	check(connection.finishConnecting() && connection.connectState == connect_state::Connected, "the connection to the tls server completes its handshake");
+	auto startTime = hrclock::now();
+	while (connection.data.currentState != https_state::complete && connection.areWeStillConnected() && hrclock::now() - startTime < timeoutSlack) {
+		connection.processIO(10);
+	}
+	check(connection.data.currentState == https_state::complete && static_cast<uint32_t>(connection.data.responseCode) == 200 &&
+			std::string_view{ connection.data.responseData.data(), connection.data.responseData.size() } == responseBody,
+		"the queued request is sent once the handshake completes, and answered");
+}
+
+#if defined(__linux__)
+/// @brief Checks that a connection whose connect completes inside the constructor starts its handshake straight away, rather than waiting to be
+/// polled readable by a server which is itself waiting for the ClientHello.
+void testImmediateConnect() {
+	local_tls_server server{ [](SSL*) {
+	} };
+	forceImmediateConnect.store(true, std::memory_order_release);
+	auto startTime = hrclock::now();
+	https_connection connection{ "127.0.0.1", server.getPort() };
+	forceImmediateConnect.store(false, std::memory_order_release);
+	check(connection.currentStatus == connection_status::NO_Error && connection.connectState != connect_state::Connecting,
+		"a connect which completes straight away skips the connecting stage");
+	while (connection.connectState != connect_state::Connected && connection.currentStatus == connection_status::NO_Error) {
+		connection.processIO(10);
+	}
+	auto elapsedTime = hrclock::now() - startTime;
+	check(connection.connectState == connect_state::Connected && connection.currentStatus == connection_status::NO_Error,
+		"a connection which connected straight away completes its handshake");
+	check(elapsedTime < stageTimeout, "the handshake of a connection which connected straight away is not left waiting for its timeout");
+}
+#endif
+
+int32_t main() {
+	check(ssl_context_holder::initialize(), "the client tls context is created");
+	connection_settings::connectTimeout	  = stageTimeout;
+	connection_settings::handshakeTimeout = stageTimeout;
+	testHandshakeTimeout();
+	testPollingDoesNotBlock();
+#if defined(__linux__)
+	testConnectTimeout();
+#endif
+	testQueuedWriteIsFlushed();
+#if defined(__linux__)
+	testImmediateConnect();
+#endif
+	return test_state::getInstance().finish("TcpConnection");
+}
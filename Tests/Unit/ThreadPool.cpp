@@ -0,0 +1,150 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// ThreadPool.cpp - Tests for the work-stealing deque and the co_routine_thread_pool.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file ThreadPool.cpp
+
+#include "../Common/TestUtilities.hpp"
+
+using namespace discord_core_api;
+using namespace discord_core_api::discord_core_internal;
+using namespace discord_core_test;
+
+void testDequeSingleThreaded() {
+	work_stealing_deque<uint64_t> deque{};
+	check(deque.empty(), "a new deque is empty");
+	// Push past the initial capacity, so that the ring grows.
+	for (uint64_t x = 0; x < 1000; ++x) {
+		deque.push(x);
+	}
+	uint64_t value{};
+	check(deque.steal(value) && value == 0, "steal takes the oldest value");
+	check(deque.pop(value) && value == 999, "pop takes the newest value");
+	bool allInOrder{ true };
+	for (uint64_t x = 998; x >= 1; --x) {
+		allInOrder = deque.pop(value) && value == x && allInOrder;
+	}
+	check(allInOrder, "pop drains the deque newest first, across the grown ring");
+	check(!deque.pop(value) && !deque.steal(value) && deque.empty(), "an emptied deque reports itself empty");
+}
+
+void testDequeConcurrent(uint64_t thiefCount) {
+	constexpr uint64_t valueCount{ 200000 };
+	work_stealing_deque<uint64_t> deque{};
+	std::vector<std::atomic<uint64_t>> takenCounts(valueCount);
+	std::atomic_bool ownerDone{};
+	runOnThreads(thiefCount + 1, [&](uint64_t index) {
+		uint64_t value{};
+		if (index == 0) {
+			// The owner pushes in bursts and pops some of its own work back, as a worker does.
+			for (uint64_t x = 0; x < valueCount; ++x) {
+				deque.push(x);
+				if (x % 3 == 0 && deque.pop(value)) {
+					takenCounts[value].fetch_add(1, std::memory_order_relaxed);
+				}
+			}
+			while (deque.pop(value)) {
+				takenCounts[value].fetch_add(1, std::memory_order_relaxed);
+			}
+			ownerDone.store(true, std::memory_order_release);
+		} else {
+			while (!ownerDone.load(std::memory_order_acquire) || !deque.empty()) {
+				if (deque.steal(value)) {
+					takenCounts[value].fetch_add(1, std::memory_order_relaxed);
+				}
+			}
+		}
+	});
+	uint64_t missing{};
+	uint64_t duplicated{};
+	for (auto& value: takenCounts) {
+		missing	   += value.load() == 0 ? 1 : 0;
+		duplicated += value.load() > 1 ? 1 : 0;
+	}
+	check(missing == 0 && duplicated == 0, "every value is taken exactly once, with " + std::to_string(thiefCount) + " thieves");
+}
+
+pool_task hopAcrossPool(co_routine_thread_pool& pool, uint64_t hopCount, std::atomic<uint64_t>& hops, std::atomic<uint64_t>& finished) {
+	for (uint64_t x = 0; x < hopCount; ++x) {
+		// The first hop goes through the injection queue, every later one through a worker's own deque.
+		co_await resume_on_pool{ pool };
+		hops.fetch_add(1, std::memory_order_relaxed);
+	}
+	finished.fetch_add(1, std::memory_order_release);
+}
+
+void testPoolRunsEveryTask(uint64_t submitterCount) {
+	constexpr uint64_t tasksPerSubmitter{ 2000 };
+	constexpr uint64_t hopCount{ 8 };
+	co_routine_thread_pool pool{};
+	std::atomic<uint64_t> hops{};
+	std::atomic<uint64_t> finished{};
+	runOnThreads(submitterCount, [&](uint64_t) {
+		for (uint64_t x = 0; x < tasksPerSubmitter; ++x) {
+			hopAcrossPool(pool, hopCount, hops, finished);
+		}
+	});
+	bool completed = waitForCount(finished, submitterCount * tasksPerSubmitter, std::chrono::seconds{ 60 });
+	check(completed, "every submitted task finishes, with " + std::to_string(submitterCount) + " submitting threads");
+	check(hops.load() == submitterCount * tasksPerSubmitter * hopCount, "every hop runs exactly once, with " + std::to_string(submitterCount) + " submitting threads");
+}
+
+void testParkedWorkersWake() {
+	co_routine_thread_pool pool{};
+	std::atomic<uint64_t> hops{};
+	std::atomic<uint64_t> finished{};
+	bool allWoke{ true };
+	for (uint64_t x = 0; x < 20; ++x) {
+		// Leave the pool idle for long enough that every worker parks, then submit a single task.
+		std::this_thread::sleep_for(std::chrono::milliseconds{ 20 });
+		hopAcrossPool(pool, 1, hops, finished);
+		allWoke = waitForCount(finished, x + 1, std::chrono::seconds{ 5 }) && allWoke;
+	}
+	check(allWoke, "a task submitted to a fully parked pool is picked up");
+}
+
+void testIdlePoolShutsDown() {
+	auto startTime = hrclock::now();
+	for (uint64_t x = 0; x < 10; ++x) {
+		co_routine_thread_pool pool{};
+		std::this_thread::sleep_for(std::chrono::milliseconds{ 5 });
+	}
+	check(hrclock::now() - startTime < std::chrono::seconds{ 10 }, "destroying a pool wakes and joins its parked workers");
+}
+
+int32_t main() {
+	testDequeSingleThreaded();
+	for (uint64_t thiefCount: { 1ull, 3ull, 7ull }) {
+		testDequeConcurrent(thiefCount);
+	}
+	for (uint64_t submitterCount: { 1ull, 8ull, 32ull }) {
+		testPoolRunsEveryTask(submitterCount);
+	}
+	testParkedWorkersWake();
+	testIdlePoolShutsDown();
+	return test_state::getInstance().finish("ThreadPool");
+}
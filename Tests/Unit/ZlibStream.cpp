@@ -0,0 +1,224 @@
+/*
+	MIT License
+
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2022, 2023 Chris M. (RealTimeChris)
+
+	Permission is hereby granted, free of charge, to any person obtaining a copy
+	of this software and associated documentation files (the "Software"), to deal
+	in the Software without restriction, including without limitation the rights
+	to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+	copies of the Software, and to permit persons to whom the Software is
+	furnished to do so, subject to the following conditions:
+
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+*/
+/// ZlibStream.cpp - Offline replay tests for the zlib-stream decompressor.
+/// Oct 18, 2026
+/// https://discordcoreapi.com
+/// \file ZlibStream.cpp
+
+#include "../Common/TestUtilities.hpp"
+#include "../Common/Payloads.hpp"
+#include <discordcoreapi/Utilities/ZlibDecompressor.hpp>
+#include <random>
+
+using namespace discord_core_api;
+using namespace discord_core_api::discord_core_internal;
+using namespace discord_core_test;
+
+/// @brief Produces a zlib-stream the way the gateway does: one deflate context, with each message ending in a sync flush.
+class zlib_stream_recorder {
+  public:
+	zlib_stream_recorder() {
+		deflateInit(&stream, Z_DEFAULT_COMPRESSION);
+	}
+
+	std::string compressMessage(const std::string& message) {
+		std::string returnValue{};
+		stream.next_in	= reinterpret_cast<Bytef*>(const_cast<char*>(message.data()));
+		stream.avail_in = static_cast<uInt>(message.size());
+		do {
+			char buffer[16384];
+			stream.next_out	 = reinterpret_cast<Bytef*>(buffer);
+			stream.avail_out = sizeof(buffer);
+			deflate(&stream, Z_SYNC_FLUSH);
+			returnValue.append(buffer, sizeof(buffer) - stream.avail_out);
+		} while (stream.avail_out == 0);
+		return returnValue;
+	}
+
+	~zlib_stream_recorder() {
+		deflateEnd(&stream);
+	}
+
+  protected:
+	z_stream stream{};
+};
+
+/// @brief A captured session: the original messages and their compressed form, in order.
+struct zlib_stream_capture {
+	std::vector<std::string> messages{};
+	std::vector<std::string> compressed{};
+};
+
+zlib_stream_capture recordCapture() {
+	zlib_stream_capture capture{};
+	capture.messages.emplace_back("{\"t\":null,\"s\":null,\"op\":10,\"d\":{\"heartbeat_interval\":41250}}");
+	capture.messages.emplace_back(
+		"{\"t\":\"READY\",\"s\":1,\"op\":0,\"d\":{\"v\":10,\"session_id\":\"abcdef\",\"resume_gateway_url\":\"wss://gateway.discord.gg\",\"user\":{\"id\":\"1\"},\"guilds\":[]}}");
+	for (uint64_t x = 0; x < 4; ++x) {
+		capture.messages.emplace_back(generateGuildCreateFrame(10 * (x + 1) * (x + 1), 5 + x, 5 + x, static_cast<int64_t>(x) + 2));
+		capture.messages.emplace_back("{\"t\":null,\"s\":null,\"op\":11}");
+	}
+	capture.messages.emplace_back(generateGuildCreateFrame(5000, 50, 50, 6));
+	// A highly compressible message, which expands well past the decompressor's initial output estimate.
+	capture.messages.emplace_back("{\"t\":\"MESSAGE_CREATE\",\"s\":7,\"op\":0,\"d\":{\"content\":\"" + std::string(1024 * 1024, 'a') + "\"}}");
+	zlib_stream_recorder recorder{};
+	for (auto& value: capture.messages) {
+		capture.compressed.emplace_back(recorder.compressMessage(value));
+	}
+	return capture;
+}
+
+/// @brief Splits a compressed message into websocket-sized fragments, none of which but the last ends in the suffix.
+std::vector<std::string_view> splitMessage(std::string_view message, std::mt19937_64& randomEngine, uint64_t maxFragmentSize) {
+	std::vector<std::string_view> returnValue{};
+	std::uniform_int_distribution<uint64_t> distribution{ 1, maxFragmentSize };
+	while (message.size() > 0) {
+		auto fragmentSize = std::min<uint64_t>(distribution(randomEngine), message.size());
+		while (fragmentSize < message.size() && message.substr(0, fragmentSize).ends_with(std::string_view{ reinterpret_cast<const char*>(zlibSuffix), 4 })) {
+			++fragmentSize;
+		}
+		returnValue.emplace_back(message.substr(0, fragmentSize));
+		message.remove_prefix(fragmentSize);
+	}
+	return returnValue;
+}
+
+void testCaptureIsGatewayShaped(const zlib_stream_capture& capture) {
+	bool allSuffixed{ true };
+	for (auto& value: capture.compressed) {
+		allSuffixed = allSuffixed && value.ends_with(std::string_view{ reinterpret_cast<const char*>(zlibSuffix), 4 });
+	}
+	check(allSuffixed, "every recorded message ends in the zlib-stream suffix");
+}
+
+void testWholeMessages(const zlib_stream_capture& capture) {
+	zlib_decompressor_wrapper decompressor{};
+	bool allMatched{ true };
+	for (uint64_t x = 0; x < capture.messages.size(); ++x) {
+		jsonifier::string_view_base<uint8_t> dataOut{};
+		allMatched = decompressor.decompressData(toView(capture.compressed[x]), dataOut) && toString(dataOut) == capture.messages[x] && allMatched;
+	}
+	check(allMatched, "whole messages decompress in order through one context");
+}
+
+void testFragmentedMessages(const zlib_stream_capture& capture, uint64_t maxFragmentSize, uint64_t seed) {
+	std::mt19937_64 randomEngine{ seed };
+	zlib_decompressor_wrapper decompressor{};
+	bool allMatched{ true };
+	bool noneEarly{ true };
+	for (uint64_t x = 0; x < capture.messages.size(); ++x) {
+		auto fragments = splitMessage(capture.compressed[x], randomEngine, maxFragmentSize);
+		for (uint64_t y = 0; y < fragments.size(); ++y) {
+			jsonifier::string_view_base<uint8_t> dataOut{};
+			bool completed = decompressor.decompressData(toView(fragments[y]), dataOut);
+			if (y + 1 < fragments.size()) {
+				noneEarly = noneEarly && !completed;
+			} else {
+				allMatched = completed && toString(dataOut) == capture.messages[x] && allMatched;
+			}
+		}
+	}
+	check(noneEarly, "no message completes before its suffix arrives, with fragments of up to " + std::to_string(maxFragmentSize) + " bytes");
+	check(allMatched, "fragmented messages reassemble and decompress, with fragments of up to " + std::to_string(maxFragmentSize) + " bytes");
+}
+
+void testCorruptStream(const zlib_stream_capture& capture) {
+	zlib_decompressor_wrapper decompressor{};
+	jsonifier::string_view_base<uint8_t> dataOut{};
+	decompressor.decompressData(toView(capture.compressed[0]), dataOut);
+	std::string corrupt{ "\xff\xff\xff\xff\xff\xff\xff\xff" };
+	corrupt.append(reinterpret_cast<const char*>(zlibSuffix), 4);
+	bool threw{};
+	try {
+		decompressor.decompressData(toView(corrupt), dataOut);
+	} catch (const dca_exception&) {
+		threw = true;
+	}
+	check(threw, "a corrupt message throws dca_exception");
+
+	zlib_decompressor_wrapper freshDecompressor{};
+	threw = false;
+	try {
+		freshDecompressor.decompressData(toView(capture.compressed[1]), dataOut);
+	} catch (const dca_exception&) {
+		threw = true;
+	}
+	check(threw, "a stream joined mid-session is rejected rather than misread");
+}
+
+/// @brief Decompresses a message which fills the decompressor's first output estimate exactly, so that the last inflate call has no input left to make progress on.
+void testExactlyFilledOutput() {
+	std::mt19937_64 randomEngine{ 7 };
+	std::string base{};
+	for (uint64_t x = 0; x < 1000; ++x) {
+		base += "abc"[randomEngine() % 3];
+	}
+	// Pad the message with a run that costs almost nothing to compress, until it is exactly four times its compressed size.
+	for (uint64_t x = 0; x < 4096; ++x) {
+		auto message = base + std::string(x, 'a');
+		zlib_stream_recorder recorder{};
+		auto compressed = recorder.compressMessage(message);
+		if (message.size() == compressed.size() * 4) {
+			zlib_decompressor_wrapper decompressor{};
+			jsonifier::string_view_base<uint8_t> dataOut{};
+			check(decompressor.decompressData(toView(compressed), dataOut) && toString(dataOut) == message, "a message that exactly fills the output buffer decompresses");
+			return;
+		}
+	}
+	check(false, "a message that exactly fills the output buffer can be generated");
+}
+
+/// @brief Hands the decompressor a message which was cut short before its suffix, which must neither hang nor be misread as the whole message.
+void testTruncatedMessage(const zlib_stream_capture& capture) {
+	zlib_decompressor_wrapper decompressor{};
+	jsonifier::string_view_base<uint8_t> dataOut{};
+	decompressor.decompressData(toView(capture.compressed[0]), dataOut);
+	auto& message = capture.compressed.back();
+	auto truncated = message.substr(0, message.size() / 2);
+	truncated.append(reinterpret_cast<const char*>(zlibSuffix), 4);
+	auto startTime = hrclock::now();
+	bool completed{};
+	try {
+		completed = decompressor.decompressData(toView(truncated), dataOut);
+	} catch (const dca_exception&) {
+	}
+	check(hrclock::now() - startTime < std::chrono::seconds{ 5 }, "a truncated message does not leave the decompressor spinning");
+	check(!completed || toString(dataOut) != capture.messages.back(), "a truncated message is not returned as the whole message");
+}
+
+int32_t main() {
+	auto capture = recordCapture();
+	testCaptureIsGatewayShaped(capture);
+	testWholeMessages(capture);
+	testFragmentedMessages(capture, 1, 1);
+	testFragmentedMessages(capture, 7, 2);
+	testFragmentedMessages(capture, 4096, 3);
+	testFragmentedMessages(capture, 65536, 4);
+	testCorruptStream(capture);
+	testExactlyFilledOutput();
+	testTruncatedMessage(capture);
+	return test_state::getInstance().finish("ZlibStream");
+}